@@ -78,10 +78,11 @@
 
 // -- MEMORY ALLOCATION --------------------------------------------------------
 
-// -- Contiguous (static) memory allocator --
+// -- Contiguous memory allocator --
 
-// The number of MC x KC, KC x NC, and MC x NC blocks to reserve in the
-// contiguous memory pools.
+// The number of MC x KC, KC x NC, and MC x NC blocks to allocate in the
+// contiguous memory pools when each pool is first used. The pools grow
+// beyond these numbers on demand.
 #define BLIS_NUM_MC_X_KC_BLOCKS          16
 #define BLIS_NUM_KC_X_NC_BLOCKS          1
 #define BLIS_NUM_MC_X_NC_BLOCKS          1
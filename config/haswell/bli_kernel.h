@@ -0,0 +1,290 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_KERNEL_H
+#define BLIS_KERNEL_H
+
+
+// -- LEVEL-3 MICRO-KERNEL CONSTANTS -------------------------------------------
+
+// -- Cache blocksizes --
+
+//
+// Constraints:
+//
+// (1) MC must be a multiple of:
+//     (a) MR (for zero-padding purposes)
+//     (b) NR (for zero-padding purposes when MR and NR are "swapped")
+// (2) NC must be a multiple of
+//     (a) NR (for zero-padding purposes)
+//     (b) MR (for zero-padding purposes when MR and NR are "swapped")
+// (3) KC must be a multiple of
+//     (a) MR and
+//     (b) NR (for triangular operations such as trmm and trsm).
+//
+
+#define BLIS_DEFAULT_MC_S              96
+#define BLIS_DEFAULT_KC_S              384
+#define BLIS_DEFAULT_NC_S              4080
+
+#define BLIS_DEFAULT_MC_D              72
+#define BLIS_DEFAULT_KC_D              240
+#define BLIS_DEFAULT_NC_D              4080
+
+#define BLIS_DEFAULT_MC_C              64
+#define BLIS_DEFAULT_KC_C              128
+#define BLIS_DEFAULT_NC_C              4096
+
+#define BLIS_DEFAULT_MC_Z              64
+#define BLIS_DEFAULT_KC_Z              128
+#define BLIS_DEFAULT_NC_Z              4096
+
+// -- Register blocksizes --
+
+#define BLIS_DEFAULT_MR_S              16
+#define BLIS_DEFAULT_NR_S              6
+
+#define BLIS_DEFAULT_MR_D              8
+#define BLIS_DEFAULT_NR_D              6
+
+#define BLIS_DEFAULT_MR_C              8
+#define BLIS_DEFAULT_NR_C              4
+
+#define BLIS_DEFAULT_MR_Z              8
+#define BLIS_DEFAULT_NR_Z              4
+
+// NOTE: If the micro-kernel, which is typically unrolled to a factor
+// of f, handles leftover edge cases (ie: when k % f > 0) then these
+// register blocksizes in the k dimension can be defined to 1.
+
+//#define BLIS_DEFAULT_KR_S              1
+//#define BLIS_DEFAULT_KR_D              1
+//#define BLIS_DEFAULT_KR_C              1
+//#define BLIS_DEFAULT_KR_Z              1
+
+// -- Cache blocksize extensions (for optimizing edge cases) --
+
+// NOTE: These cache blocksize "extensions" have the same constraints as
+// the corresponding default blocksizes above. When these values are
+// non-zero, blocksizes used at edge cases are extended (enlarged) if
+// such an extension would encompass the remaining portion of the
+// matrix dimension.
+
+//#define BLIS_EXTEND_MC_S               0 //(BLIS_DEFAULT_MC_S/4)
+//#define BLIS_EXTEND_KC_S               0 //(BLIS_DEFAULT_KC_S/4)
+//#define BLIS_EXTEND_NC_S               0 //(BLIS_DEFAULT_NC_S/4)
+
+//#define BLIS_EXTEND_MC_D               0 //(BLIS_DEFAULT_MC_D/4)
+//#define BLIS_EXTEND_KC_D               0 //(BLIS_DEFAULT_KC_D/4)
+//#define BLIS_EXTEND_NC_D               0 //(BLIS_DEFAULT_NC_D/4)
+
+//#define BLIS_EXTEND_MC_C               0 //(BLIS_DEFAULT_MC_C/4)
+//#define BLIS_EXTEND_KC_C               0 //(BLIS_DEFAULT_KC_C/4)
+//#define BLIS_EXTEND_NC_C               0 //(BLIS_DEFAULT_NC_C/4)
+
+//#define BLIS_EXTEND_MC_Z               0 //(BLIS_DEFAULT_MC_Z/4)
+//#define BLIS_EXTEND_KC_Z               0 //(BLIS_DEFAULT_KC_Z/4)
+//#define BLIS_EXTEND_NC_Z               0 //(BLIS_DEFAULT_NC_Z/4)
+
+// -- Register blocksize extensions (for packed micro-panels) --
+
+// NOTE: These register blocksize "extensions" determine whether the
+// leading dimensions used within the packed micro-panels are equal to
+// or greater than their corresponding register blocksizes above.
+
+//#define BLIS_EXTEND_MR_S               0
+//#define BLIS_EXTEND_NR_S               0
+
+//#define BLIS_EXTEND_MR_D               0
+//#define BLIS_EXTEND_NR_D               0
+
+//#define BLIS_EXTEND_MR_C               0
+//#define BLIS_EXTEND_NR_C               0
+
+//#define BLIS_EXTEND_MR_Z               0
+//#define BLIS_EXTEND_NR_Z               0
+
+
+
+
+// -- LEVEL-2 KERNEL CONSTANTS -------------------------------------------------
+
+
+
+
+// -- LEVEL-1F KERNEL CONSTANTS ------------------------------------------------
+
+#define BLIS_L1F_FUSE_FAC_S        8
+#define BLIS_L1F_FUSE_FAC_D        8
+
+
+
+
+// -- LEVEL-3 KERNEL DEFINITIONS -----------------------------------------------
+
+// -- gemm --
+
+#define BLIS_SGEMM_UKERNEL         bli_sgemm_opt_16x6
+#define BLIS_DGEMM_UKERNEL         bli_dgemm_opt_8x6
+
+// -- trsm-related --
+
+#define BLIS_DTRSM_L_UKERNEL       bli_dtrsm_l_opt_8x6
+#define BLIS_DTRSM_U_UKERNEL       bli_dtrsm_u_opt_8x6
+
+
+
+
+// -- LEVEL-1M KERNEL DEFINITIONS ----------------------------------------------
+
+// -- packm --
+
+#define BLIS_SPACKM_2XK_KERNEL      bli_spackm_opt_2xk
+#define BLIS_DPACKM_2XK_KERNEL      bli_dpackm_opt_2xk
+#define BLIS_CPACKM_2XK_KERNEL      bli_cpackm_opt_2xk
+#define BLIS_ZPACKM_2XK_KERNEL      bli_zpackm_opt_2xk
+
+#define BLIS_SPACKM_4XK_KERNEL      bli_spackm_opt_4xk
+#define BLIS_DPACKM_4XK_KERNEL      bli_dpackm_opt_4xk
+#define BLIS_CPACKM_4XK_KERNEL      bli_cpackm_opt_4xk
+#define BLIS_ZPACKM_4XK_KERNEL      bli_zpackm_opt_4xk
+
+#define BLIS_SPACKM_6XK_KERNEL      bli_spackm_opt_6xk
+#define BLIS_DPACKM_6XK_KERNEL      bli_dpackm_opt_6xk
+#define BLIS_CPACKM_6XK_KERNEL      bli_cpackm_opt_6xk
+#define BLIS_ZPACKM_6XK_KERNEL      bli_zpackm_opt_6xk
+
+#define BLIS_SPACKM_8XK_KERNEL      bli_spackm_opt_8xk
+#define BLIS_DPACKM_8XK_KERNEL      bli_dpackm_opt_8xk
+#define BLIS_CPACKM_8XK_KERNEL      bli_cpackm_opt_8xk
+#define BLIS_ZPACKM_8XK_KERNEL      bli_zpackm_opt_8xk
+
+#define BLIS_SPACKM_12XK_KERNEL     bli_spackm_opt_12xk
+#define BLIS_DPACKM_12XK_KERNEL     bli_dpackm_opt_12xk
+#define BLIS_CPACKM_12XK_KERNEL     bli_cpackm_opt_12xk
+#define BLIS_ZPACKM_12XK_KERNEL     bli_zpackm_opt_12xk
+
+#define BLIS_SPACKM_16XK_KERNEL     bli_spackm_opt_16xk
+#define BLIS_DPACKM_16XK_KERNEL     bli_dpackm_opt_16xk
+#define BLIS_CPACKM_16XK_KERNEL     bli_cpackm_opt_16xk
+#define BLIS_ZPACKM_16XK_KERNEL     bli_zpackm_opt_16xk
+
+// -- unpackm --
+
+
+
+
+// -- LEVEL-1F KERNEL DEFINITIONS ----------------------------------------------
+
+// -- axpy2v --
+
+#define BLIS_SAXPY2V_KERNEL        bli_saxpy2v_opt_avx
+#define BLIS_DAXPY2V_KERNEL        bli_daxpy2v_opt_avx
+
+// -- dotaxpyv --
+
+#define BLIS_SDOTAXPYV_KERNEL      bli_sdotaxpyv_opt_avx
+#define BLIS_DDOTAXPYV_KERNEL      bli_ddotaxpyv_opt_avx
+
+// -- axpyf --
+
+#define BLIS_SAXPYF_KERNEL         bli_saxpyf_opt_avx
+#define BLIS_DAXPYF_KERNEL         bli_daxpyf_opt_avx
+
+// -- dotxf --
+
+#define BLIS_SDOTXF_KERNEL         bli_sdotxf_opt_avx
+#define BLIS_DDOTXF_KERNEL         bli_ddotxf_opt_avx
+
+// -- dotxaxpyf --
+
+#define BLIS_SDOTXAXPYF_KERNEL     bli_sdotxaxpyf_opt_avx
+#define BLIS_DDOTXAXPYF_KERNEL     bli_ddotxaxpyf_opt_avx
+
+
+
+
+// -- LEVEL-1V KERNEL DEFINITIONS ----------------------------------------------
+
+// -- addv --
+
+// -- axpyv --
+
+#define BLIS_SAXPYV_KERNEL         bli_saxpyv_opt_avx
+#define BLIS_DAXPYV_KERNEL         bli_daxpyv_opt_avx
+#define BLIS_CAXPYV_KERNEL         bli_caxpyv_opt_avx
+#define BLIS_ZAXPYV_KERNEL         bli_zaxpyv_opt_avx
+
+// -- copyv --
+
+#define BLIS_SCOPYV_KERNEL         bli_scopyv_opt_avx
+#define BLIS_DCOPYV_KERNEL         bli_dcopyv_opt_avx
+#define BLIS_CCOPYV_KERNEL         bli_ccopyv_opt_avx
+#define BLIS_ZCOPYV_KERNEL         bli_zcopyv_opt_avx
+
+// -- dotv --
+
+#define BLIS_SDOTV_KERNEL          bli_sdotv_opt_avx
+#define BLIS_DDOTV_KERNEL          bli_ddotv_opt_avx
+#define BLIS_CDOTV_KERNEL          bli_cdotv_opt_avx
+#define BLIS_ZDOTV_KERNEL          bli_zdotv_opt_avx
+
+// -- dotxv --
+
+#define BLIS_SDOTXV_KERNEL         bli_sdotxv_opt_avx
+#define BLIS_DDOTXV_KERNEL         bli_ddotxv_opt_avx
+#define BLIS_CDOTXV_KERNEL         bli_cdotxv_opt_avx
+#define BLIS_ZDOTXV_KERNEL         bli_zdotxv_opt_avx
+
+// -- invertv --
+
+// -- scal2v --
+
+// -- scalv --
+
+#define BLIS_SSCALV_KERNEL         bli_sscalv_opt_avx
+#define BLIS_DSCALV_KERNEL         bli_dscalv_opt_avx
+#define BLIS_CSCALV_KERNEL         bli_cscalv_opt_avx
+#define BLIS_ZSCALV_KERNEL         bli_zscalv_opt_avx
+
+// -- setv --
+
+// -- subv --
+
+// -- swapv --
+
+
+
+#endif
+
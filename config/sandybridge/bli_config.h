@@ -71,14 +71,26 @@
 // The maximum number of BLIS threads that will run concurrently.
 #define BLIS_MAX_NUM_THREADS             24
 
+// Enable multithreading via OpenMP. Alternatively, define
+// BLIS_ENABLE_PTHREADS to use POSIX threads, which execute level-3 calls
+// on a pool of threads that persists between calls, and replace -fopenmp
+// with -pthread in make_defs.mk. (Do not define both.)
+#define BLIS_ENABLE_OPENMP
+//#define BLIS_ENABLE_PTHREADS
+
+// The number of microseconds for which an idle thread of the POSIX threads
+// pool spins while waiting for work before it goes to sleep.
+#define BLIS_THREAD_SPIN_USEC            100
+
 
 
 // -- MEMORY ALLOCATION --------------------------------------------------------
 
-// -- Contiguous (static) memory allocator --
+// -- Contiguous memory allocator --
 
-// The number of MC x KC, KC x NC, and MC x NC blocks to reserve in the
-// contiguous memory pools.
+// The number of MC x KC, KC x NC, and MC x NC blocks to allocate in the
+// contiguous memory pools when each pool is first used. The pools grow
+// beyond these numbers on demand.
 #define BLIS_NUM_MC_X_KC_BLOCKS          BLIS_MAX_NUM_THREADS
 #define BLIS_NUM_KC_X_NC_BLOCKS          1
 #define BLIS_NUM_MC_X_NC_BLOCKS          0
@@ -89,6 +101,11 @@
 // region without causing a segmentation fault.
 #define BLIS_MAX_PRELOAD_BYTE_OFFSET     128
 
+// Back the contiguous memory pools with huge pages by default? This may be
+// overridden at runtime via the BLIS_HUGE_PAGES environment variable or
+// bli_mem_huge_pages_set().
+//#define BLIS_ENABLE_HUGE_PAGES
+
 // -- Memory alignment --
 
 // It is sometimes useful to define the various memory alignments in terms
@@ -54,8 +54,8 @@
 //     (b) NR (for triangular operations such as trmm and trsm).
 //
 
-#define BLIS_DEFAULT_MC_S              64
-#define BLIS_DEFAULT_KC_S              128
+#define BLIS_DEFAULT_MC_S              128
+#define BLIS_DEFAULT_KC_S              384
 #define BLIS_DEFAULT_NC_S              4096
 
 #define BLIS_DEFAULT_MC_D              96
@@ -73,16 +73,16 @@
 // -- Register blocksizes --
 
 #define BLIS_DEFAULT_MR_S              8
-#define BLIS_DEFAULT_NR_S              4
+#define BLIS_DEFAULT_NR_S              8
 
 #define BLIS_DEFAULT_MR_D              8
 #define BLIS_DEFAULT_NR_D              4
 
 #define BLIS_DEFAULT_MR_C              8
-#define BLIS_DEFAULT_NR_C              4
+#define BLIS_DEFAULT_NR_C              2
 
-#define BLIS_DEFAULT_MR_Z              8
-#define BLIS_DEFAULT_NR_Z              4
+#define BLIS_DEFAULT_MR_Z              4
+#define BLIS_DEFAULT_NR_Z              2
 
 // NOTE: If the micro-kernel, which is typically unrolled to a factor
 // of f, handles leftover edge cases (ie: when k % f > 0) then these
@@ -145,6 +145,9 @@
 
 // -- LEVEL-1F KERNEL CONSTANTS ------------------------------------------------
 
+#define BLIS_L1F_FUSE_FAC_S        8
+#define BLIS_L1F_FUSE_FAC_D        8
+
 
 
 
@@ -152,10 +155,23 @@
 
 // -- gemm --
 
+#define BLIS_SGEMM_UKERNEL         bli_sgemm_opt_8x8_avx1
 #define BLIS_DGEMM_UKERNEL         bli_dgemm_opt_8x4_ref_u4_nodupl_avx1
+#define BLIS_CGEMM_UKERNEL         bli_cgemm_opt_8x2_avx1
+#define BLIS_ZGEMM_UKERNEL         bli_zgemm_opt_4x2_avx1
+
+// -- gemm (edge cases) --
+
+#define BLIS_DGEMM_EDGE_UKERNEL    bli_dgemm_edge_opt_8x4_avx1
 
 // -- trsm-related --
 
+#define BLIS_DGEMMTRSM_L_UKERNEL   bli_dgemmtrsm_l_opt_8x4_avx1
+#define BLIS_DGEMMTRSM_U_UKERNEL   bli_dgemmtrsm_u_opt_8x4_avx1
+
+#define BLIS_DTRSM_L_UKERNEL       bli_dtrsm_l_opt_8x4_avx1
+#define BLIS_DTRSM_U_UKERNEL       bli_dtrsm_u_opt_8x4_avx1
+
 
 
 
@@ -163,6 +179,36 @@
 
 // -- packm --
 
+#define BLIS_SPACKM_2XK_KERNEL      bli_spackm_opt_2xk
+#define BLIS_DPACKM_2XK_KERNEL      bli_dpackm_opt_2xk
+#define BLIS_CPACKM_2XK_KERNEL      bli_cpackm_opt_2xk
+#define BLIS_ZPACKM_2XK_KERNEL      bli_zpackm_opt_2xk
+
+#define BLIS_SPACKM_4XK_KERNEL      bli_spackm_opt_4xk
+#define BLIS_DPACKM_4XK_KERNEL      bli_dpackm_opt_4xk
+#define BLIS_CPACKM_4XK_KERNEL      bli_cpackm_opt_4xk
+#define BLIS_ZPACKM_4XK_KERNEL      bli_zpackm_opt_4xk
+
+#define BLIS_SPACKM_6XK_KERNEL      bli_spackm_opt_6xk
+#define BLIS_DPACKM_6XK_KERNEL      bli_dpackm_opt_6xk
+#define BLIS_CPACKM_6XK_KERNEL      bli_cpackm_opt_6xk
+#define BLIS_ZPACKM_6XK_KERNEL      bli_zpackm_opt_6xk
+
+#define BLIS_SPACKM_8XK_KERNEL      bli_spackm_opt_8xk
+#define BLIS_DPACKM_8XK_KERNEL      bli_dpackm_opt_8xk
+#define BLIS_CPACKM_8XK_KERNEL      bli_cpackm_opt_8xk
+#define BLIS_ZPACKM_8XK_KERNEL      bli_zpackm_opt_8xk
+
+#define BLIS_SPACKM_12XK_KERNEL     bli_spackm_opt_12xk
+#define BLIS_DPACKM_12XK_KERNEL     bli_dpackm_opt_12xk
+#define BLIS_CPACKM_12XK_KERNEL     bli_cpackm_opt_12xk
+#define BLIS_ZPACKM_12XK_KERNEL     bli_zpackm_opt_12xk
+
+#define BLIS_SPACKM_16XK_KERNEL     bli_spackm_opt_16xk
+#define BLIS_DPACKM_16XK_KERNEL     bli_dpackm_opt_16xk
+#define BLIS_CPACKM_16XK_KERNEL     bli_cpackm_opt_16xk
+#define BLIS_ZPACKM_16XK_KERNEL     bli_zpackm_opt_16xk
+
 // -- unpackm --
 
 
@@ -172,14 +218,29 @@
 
 // -- axpy2v --
 
+#define BLIS_SAXPY2V_KERNEL        bli_saxpy2v_opt_avx
+#define BLIS_DAXPY2V_KERNEL        bli_daxpy2v_opt_avx
+
 // -- dotaxpyv --
 
+#define BLIS_SDOTAXPYV_KERNEL      bli_sdotaxpyv_opt_avx
+#define BLIS_DDOTAXPYV_KERNEL      bli_ddotaxpyv_opt_avx
+
 // -- axpyf --
 
+#define BLIS_SAXPYF_KERNEL         bli_saxpyf_opt_avx
+#define BLIS_DAXPYF_KERNEL         bli_daxpyf_opt_avx
+
 // -- dotxf --
 
+#define BLIS_SDOTXF_KERNEL         bli_sdotxf_opt_avx
+#define BLIS_DDOTXF_KERNEL         bli_ddotxf_opt_avx
+
 // -- dotxaxpyf --
 
+#define BLIS_SDOTXAXPYF_KERNEL     bli_sdotxaxpyf_opt_avx
+#define BLIS_DDOTXAXPYF_KERNEL     bli_ddotxaxpyf_opt_avx
+
 
 
 
@@ -189,18 +250,43 @@
 
 // -- axpyv --
 
+#define BLIS_SAXPYV_KERNEL         bli_saxpyv_opt_avx
+#define BLIS_DAXPYV_KERNEL         bli_daxpyv_opt_avx
+#define BLIS_CAXPYV_KERNEL         bli_caxpyv_opt_avx
+#define BLIS_ZAXPYV_KERNEL         bli_zaxpyv_opt_avx
+
 // -- copyv --
 
+#define BLIS_SCOPYV_KERNEL         bli_scopyv_opt_avx
+#define BLIS_DCOPYV_KERNEL         bli_dcopyv_opt_avx
+#define BLIS_CCOPYV_KERNEL         bli_ccopyv_opt_avx
+#define BLIS_ZCOPYV_KERNEL         bli_zcopyv_opt_avx
+
 // -- dotv --
 
+#define BLIS_SDOTV_KERNEL          bli_sdotv_opt_avx
+#define BLIS_DDOTV_KERNEL          bli_ddotv_opt_avx
+#define BLIS_CDOTV_KERNEL          bli_cdotv_opt_avx
+#define BLIS_ZDOTV_KERNEL          bli_zdotv_opt_avx
+
 // -- dotxv --
 
+#define BLIS_SDOTXV_KERNEL         bli_sdotxv_opt_avx
+#define BLIS_DDOTXV_KERNEL         bli_ddotxv_opt_avx
+#define BLIS_CDOTXV_KERNEL         bli_cdotxv_opt_avx
+#define BLIS_ZDOTXV_KERNEL         bli_zdotxv_opt_avx
+
 // -- invertv --
 
 // -- scal2v --
 
 // -- scalv --
 
+#define BLIS_SSCALV_KERNEL         bli_sscalv_opt_avx
+#define BLIS_DSCALV_KERNEL         bli_dscalv_opt_avx
+#define BLIS_CSCALV_KERNEL         bli_cscalv_opt_avx
+#define BLIS_ZSCALV_KERNEL         bli_zscalv_opt_avx
+
 // -- setv --
 
 // -- subv --
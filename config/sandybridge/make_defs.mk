@@ -100,7 +100,7 @@ ARFLAGS        := cru
 
 # --- Determine the linker and related flags ---
 LINKER         := $(CC)
-LDFLAGS        := -lm
+LDFLAGS        := -lm -fopenmp
 
 
 
@@ -75,10 +75,11 @@
 
 // -- MEMORY ALLOCATION --------------------------------------------------------
 
-// -- Contiguous (static) memory allocator --
+// -- Contiguous memory allocator --
 
-// The number of MC x KC, KC x NC, and MC x NC blocks to reserve in the
-// contiguous memory pools.
+// The number of MC x KC, KC x NC, and MC x NC blocks to allocate in the
+// contiguous memory pools when each pool is first used. The pools grow
+// beyond these numbers on demand.
 #define BLIS_NUM_MC_X_KC_BLOCKS          BLIS_MAX_NUM_THREADS
 #define BLIS_NUM_KC_X_NC_BLOCKS          BLIS_MAX_NUM_THREADS
 #define BLIS_NUM_MC_X_NC_BLOCKS          0
@@ -89,6 +90,11 @@
 // region without causing a segmentation fault.
 #define BLIS_MAX_PRELOAD_BYTE_OFFSET     128
 
+// Back the contiguous memory pools with huge pages by default? This may be
+// overridden at runtime via the BLIS_HUGE_PAGES environment variable or
+// bli_mem_huge_pages_set().
+//#define BLIS_ENABLE_HUGE_PAGES
+
 // -- Memory alignment --
 
 // It is sometimes useful to define the various memory alignments in terms
@@ -145,6 +145,18 @@
 #define BLIS_CGEMM_UKERNEL         bli_cgemm_opt_mxn
 #define BLIS_ZGEMM_UKERNEL         bli_zgemm_opt_mxn
 
+// -- gemm (edge cases) --
+
+// NOTE: An edge micro-kernel is optional. It takes the same arguments as
+// the gemm micro-kernel above, preceded by m and n (m <= MR, n <= NR), and
+// updates only the leading m x n part of C. When one is defined, the
+// macro-kernels use it for partial tiles instead of computing them into
+// a temporary buffer and then copying the result to C.
+//#define BLIS_SGEMM_EDGE_UKERNEL    bli_sgemm_edge_opt_mxn
+//#define BLIS_DGEMM_EDGE_UKERNEL    bli_dgemm_edge_opt_mxn
+//#define BLIS_CGEMM_EDGE_UKERNEL    bli_cgemm_edge_opt_mxn
+//#define BLIS_ZGEMM_EDGE_UKERNEL    bli_zgemm_edge_opt_mxn
+
 // -- trsm-related --
 
 #define BLIS_SGEMMTRSM_L_UKERNEL   bli_sgemmtrsm_l_opt_mxn
@@ -0,0 +1,504 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// This file binds the kernels and blocksizes of the x86_64 configuration,
+// which contains the kernels of the generic, sandybridge, and haswell
+// sub-configurations. The kernel pointers and blocksizes are initialized to
+// those of the generic sub-configuration and are overwritten, if the
+// hardware allows, by bli_arch_select() when BLIS is initialized.
+
+
+// -- Kernel pointers --
+
+// Define a kernel pointer, using the type of its declaration in
+// bli_kernel_prototypes.h, and initialize it to the reference kernel.
+#define bli_x86_64_kernel_ptr( name, ref ) \
+\
+__typeof__( *bli_x86_64_ ## name ) *bli_x86_64_ ## name = ref;
+
+bli_x86_64_kernel_ptr( sgemm_ukernel,         BLIS_SGEMM_UKERNEL_REF )
+bli_x86_64_kernel_ptr( dgemm_ukernel,         BLIS_DGEMM_UKERNEL_REF )
+bli_x86_64_kernel_ptr( cgemm_ukernel,         BLIS_CGEMM_UKERNEL_REF )
+bli_x86_64_kernel_ptr( zgemm_ukernel,         BLIS_ZGEMM_UKERNEL_REF )
+
+bli_x86_64_kernel_ptr( sgemmtrsm_l_ukernel,   BLIS_SGEMMTRSM_L_UKERNEL_REF )
+bli_x86_64_kernel_ptr( dgemmtrsm_l_ukernel,   BLIS_DGEMMTRSM_L_UKERNEL_REF )
+bli_x86_64_kernel_ptr( cgemmtrsm_l_ukernel,   BLIS_CGEMMTRSM_L_UKERNEL_REF )
+bli_x86_64_kernel_ptr( zgemmtrsm_l_ukernel,   BLIS_ZGEMMTRSM_L_UKERNEL_REF )
+
+bli_x86_64_kernel_ptr( sgemmtrsm_u_ukernel,   BLIS_SGEMMTRSM_U_UKERNEL_REF )
+bli_x86_64_kernel_ptr( dgemmtrsm_u_ukernel,   BLIS_DGEMMTRSM_U_UKERNEL_REF )
+bli_x86_64_kernel_ptr( cgemmtrsm_u_ukernel,   BLIS_CGEMMTRSM_U_UKERNEL_REF )
+bli_x86_64_kernel_ptr( zgemmtrsm_u_ukernel,   BLIS_ZGEMMTRSM_U_UKERNEL_REF )
+
+bli_x86_64_kernel_ptr( strsm_l_ukernel,       BLIS_STRSM_L_UKERNEL_REF )
+bli_x86_64_kernel_ptr( dtrsm_l_ukernel,       BLIS_DTRSM_L_UKERNEL_REF )
+bli_x86_64_kernel_ptr( ctrsm_l_ukernel,       BLIS_CTRSM_L_UKERNEL_REF )
+bli_x86_64_kernel_ptr( ztrsm_l_ukernel,       BLIS_ZTRSM_L_UKERNEL_REF )
+
+bli_x86_64_kernel_ptr( strsm_u_ukernel,       BLIS_STRSM_U_UKERNEL_REF )
+bli_x86_64_kernel_ptr( dtrsm_u_ukernel,       BLIS_DTRSM_U_UKERNEL_REF )
+bli_x86_64_kernel_ptr( ctrsm_u_ukernel,       BLIS_CTRSM_U_UKERNEL_REF )
+bli_x86_64_kernel_ptr( ztrsm_u_ukernel,       BLIS_ZTRSM_U_UKERNEL_REF )
+
+bli_x86_64_kernel_ptr( spackm_2xk_kernel,     BLIS_SPACKM_2XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( dpackm_2xk_kernel,     BLIS_DPACKM_2XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( cpackm_2xk_kernel,     BLIS_CPACKM_2XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( zpackm_2xk_kernel,     BLIS_ZPACKM_2XK_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( spackm_4xk_kernel,     BLIS_SPACKM_4XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( dpackm_4xk_kernel,     BLIS_DPACKM_4XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( cpackm_4xk_kernel,     BLIS_CPACKM_4XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( zpackm_4xk_kernel,     BLIS_ZPACKM_4XK_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( spackm_6xk_kernel,     BLIS_SPACKM_6XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( dpackm_6xk_kernel,     BLIS_DPACKM_6XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( cpackm_6xk_kernel,     BLIS_CPACKM_6XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( zpackm_6xk_kernel,     BLIS_ZPACKM_6XK_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( spackm_8xk_kernel,     BLIS_SPACKM_8XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( dpackm_8xk_kernel,     BLIS_DPACKM_8XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( cpackm_8xk_kernel,     BLIS_CPACKM_8XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( zpackm_8xk_kernel,     BLIS_ZPACKM_8XK_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( spackm_12xk_kernel,    BLIS_SPACKM_12XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( dpackm_12xk_kernel,    BLIS_DPACKM_12XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( cpackm_12xk_kernel,    BLIS_CPACKM_12XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( zpackm_12xk_kernel,    BLIS_ZPACKM_12XK_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( spackm_16xk_kernel,    BLIS_SPACKM_16XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( dpackm_16xk_kernel,    BLIS_DPACKM_16XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( cpackm_16xk_kernel,    BLIS_CPACKM_16XK_KERNEL_REF )
+bli_x86_64_kernel_ptr( zpackm_16xk_kernel,    BLIS_ZPACKM_16XK_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( saxpy2v_kernel,        BLIS_SAXPY2V_KERNEL_REF )
+bli_x86_64_kernel_ptr( daxpy2v_kernel,        BLIS_DAXPY2V_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( sdotaxpyv_kernel,      BLIS_SDOTAXPYV_KERNEL_REF )
+bli_x86_64_kernel_ptr( ddotaxpyv_kernel,      BLIS_DDOTAXPYV_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( saxpyf_kernel,         BLIS_SAXPYF_KERNEL_REF )
+bli_x86_64_kernel_ptr( daxpyf_kernel,         BLIS_DAXPYF_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( sdotxf_kernel,         BLIS_SDOTXF_KERNEL_REF )
+bli_x86_64_kernel_ptr( ddotxf_kernel,         BLIS_DDOTXF_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( sdotxaxpyf_kernel,     BLIS_SDOTXAXPYF_KERNEL_REF )
+bli_x86_64_kernel_ptr( ddotxaxpyf_kernel,     BLIS_DDOTXAXPYF_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( saxpyv_kernel,         BLIS_SAXPYV_KERNEL_REF )
+bli_x86_64_kernel_ptr( daxpyv_kernel,         BLIS_DAXPYV_KERNEL_REF )
+bli_x86_64_kernel_ptr( caxpyv_kernel,         BLIS_CAXPYV_KERNEL_REF )
+bli_x86_64_kernel_ptr( zaxpyv_kernel,         BLIS_ZAXPYV_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( scopyv_kernel,         BLIS_SCOPYV_KERNEL_REF )
+bli_x86_64_kernel_ptr( dcopyv_kernel,         BLIS_DCOPYV_KERNEL_REF )
+bli_x86_64_kernel_ptr( ccopyv_kernel,         BLIS_CCOPYV_KERNEL_REF )
+bli_x86_64_kernel_ptr( zcopyv_kernel,         BLIS_ZCOPYV_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( sdotv_kernel,          BLIS_SDOTV_KERNEL_REF )
+bli_x86_64_kernel_ptr( ddotv_kernel,          BLIS_DDOTV_KERNEL_REF )
+bli_x86_64_kernel_ptr( cdotv_kernel,          BLIS_CDOTV_KERNEL_REF )
+bli_x86_64_kernel_ptr( zdotv_kernel,          BLIS_ZDOTV_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( sdotxv_kernel,         BLIS_SDOTXV_KERNEL_REF )
+bli_x86_64_kernel_ptr( ddotxv_kernel,         BLIS_DDOTXV_KERNEL_REF )
+bli_x86_64_kernel_ptr( cdotxv_kernel,         BLIS_CDOTXV_KERNEL_REF )
+bli_x86_64_kernel_ptr( zdotxv_kernel,         BLIS_ZDOTXV_KERNEL_REF )
+
+bli_x86_64_kernel_ptr( sscalv_kernel,         BLIS_SSCALV_KERNEL_REF )
+bli_x86_64_kernel_ptr( dscalv_kernel,         BLIS_DSCALV_KERNEL_REF )
+bli_x86_64_kernel_ptr( cscalv_kernel,         BLIS_CSCALV_KERNEL_REF )
+bli_x86_64_kernel_ptr( zscalv_kernel,         BLIS_ZSCALV_KERNEL_REF )
+
+
+// -- Optimized kernels --
+
+// Declare each optimized kernel to have the type of the pointer that it is
+// assigned to.
+#define bli_x86_64_kernel_decl( name, ker ) \
+\
+extern __typeof__( *bli_x86_64_ ## name ) ker;
+
+// sandybridge and haswell
+bli_x86_64_kernel_decl( spackm_2xk_kernel,     bli_spackm_opt_2xk )
+bli_x86_64_kernel_decl( dpackm_2xk_kernel,     bli_dpackm_opt_2xk )
+bli_x86_64_kernel_decl( cpackm_2xk_kernel,     bli_cpackm_opt_2xk )
+bli_x86_64_kernel_decl( zpackm_2xk_kernel,     bli_zpackm_opt_2xk )
+
+bli_x86_64_kernel_decl( spackm_4xk_kernel,     bli_spackm_opt_4xk )
+bli_x86_64_kernel_decl( dpackm_4xk_kernel,     bli_dpackm_opt_4xk )
+bli_x86_64_kernel_decl( cpackm_4xk_kernel,     bli_cpackm_opt_4xk )
+bli_x86_64_kernel_decl( zpackm_4xk_kernel,     bli_zpackm_opt_4xk )
+
+bli_x86_64_kernel_decl( spackm_6xk_kernel,     bli_spackm_opt_6xk )
+bli_x86_64_kernel_decl( dpackm_6xk_kernel,     bli_dpackm_opt_6xk )
+bli_x86_64_kernel_decl( cpackm_6xk_kernel,     bli_cpackm_opt_6xk )
+bli_x86_64_kernel_decl( zpackm_6xk_kernel,     bli_zpackm_opt_6xk )
+
+bli_x86_64_kernel_decl( spackm_8xk_kernel,     bli_spackm_opt_8xk )
+bli_x86_64_kernel_decl( dpackm_8xk_kernel,     bli_dpackm_opt_8xk )
+bli_x86_64_kernel_decl( cpackm_8xk_kernel,     bli_cpackm_opt_8xk )
+bli_x86_64_kernel_decl( zpackm_8xk_kernel,     bli_zpackm_opt_8xk )
+
+bli_x86_64_kernel_decl( spackm_12xk_kernel,    bli_spackm_opt_12xk )
+bli_x86_64_kernel_decl( dpackm_12xk_kernel,    bli_dpackm_opt_12xk )
+bli_x86_64_kernel_decl( cpackm_12xk_kernel,    bli_cpackm_opt_12xk )
+bli_x86_64_kernel_decl( zpackm_12xk_kernel,    bli_zpackm_opt_12xk )
+
+bli_x86_64_kernel_decl( spackm_16xk_kernel,    bli_spackm_opt_16xk )
+bli_x86_64_kernel_decl( dpackm_16xk_kernel,    bli_dpackm_opt_16xk )
+bli_x86_64_kernel_decl( cpackm_16xk_kernel,    bli_cpackm_opt_16xk )
+bli_x86_64_kernel_decl( zpackm_16xk_kernel,    bli_zpackm_opt_16xk )
+
+bli_x86_64_kernel_decl( saxpy2v_kernel,        bli_saxpy2v_opt_avx )
+bli_x86_64_kernel_decl( daxpy2v_kernel,        bli_daxpy2v_opt_avx )
+
+bli_x86_64_kernel_decl( sdotaxpyv_kernel,      bli_sdotaxpyv_opt_avx )
+bli_x86_64_kernel_decl( ddotaxpyv_kernel,      bli_ddotaxpyv_opt_avx )
+
+bli_x86_64_kernel_decl( saxpyf_kernel,         bli_saxpyf_opt_avx )
+bli_x86_64_kernel_decl( daxpyf_kernel,         bli_daxpyf_opt_avx )
+
+bli_x86_64_kernel_decl( sdotxf_kernel,         bli_sdotxf_opt_avx )
+bli_x86_64_kernel_decl( ddotxf_kernel,         bli_ddotxf_opt_avx )
+
+bli_x86_64_kernel_decl( sdotxaxpyf_kernel,     bli_sdotxaxpyf_opt_avx )
+bli_x86_64_kernel_decl( ddotxaxpyf_kernel,     bli_ddotxaxpyf_opt_avx )
+
+bli_x86_64_kernel_decl( saxpyv_kernel,         bli_saxpyv_opt_avx )
+bli_x86_64_kernel_decl( daxpyv_kernel,         bli_daxpyv_opt_avx )
+bli_x86_64_kernel_decl( caxpyv_kernel,         bli_caxpyv_opt_avx )
+bli_x86_64_kernel_decl( zaxpyv_kernel,         bli_zaxpyv_opt_avx )
+
+bli_x86_64_kernel_decl( scopyv_kernel,         bli_scopyv_opt_avx )
+bli_x86_64_kernel_decl( dcopyv_kernel,         bli_dcopyv_opt_avx )
+bli_x86_64_kernel_decl( ccopyv_kernel,         bli_ccopyv_opt_avx )
+bli_x86_64_kernel_decl( zcopyv_kernel,         bli_zcopyv_opt_avx )
+
+bli_x86_64_kernel_decl( sdotv_kernel,          bli_sdotv_opt_avx )
+bli_x86_64_kernel_decl( ddotv_kernel,          bli_ddotv_opt_avx )
+bli_x86_64_kernel_decl( cdotv_kernel,          bli_cdotv_opt_avx )
+bli_x86_64_kernel_decl( zdotv_kernel,          bli_zdotv_opt_avx )
+
+bli_x86_64_kernel_decl( sdotxv_kernel,         bli_sdotxv_opt_avx )
+bli_x86_64_kernel_decl( ddotxv_kernel,         bli_ddotxv_opt_avx )
+bli_x86_64_kernel_decl( cdotxv_kernel,         bli_cdotxv_opt_avx )
+bli_x86_64_kernel_decl( zdotxv_kernel,         bli_zdotxv_opt_avx )
+
+bli_x86_64_kernel_decl( sscalv_kernel,         bli_sscalv_opt_avx )
+bli_x86_64_kernel_decl( dscalv_kernel,         bli_dscalv_opt_avx )
+bli_x86_64_kernel_decl( cscalv_kernel,         bli_cscalv_opt_avx )
+bli_x86_64_kernel_decl( zscalv_kernel,         bli_zscalv_opt_avx )
+
+// sandybridge
+bli_x86_64_kernel_decl( sgemm_ukernel,         bli_sgemm_opt_8x8_avx1 )
+bli_x86_64_kernel_decl( dgemm_ukernel,         bli_dgemm_opt_8x4_ref_u4_nodupl_avx1 )
+bli_x86_64_kernel_decl( cgemm_ukernel,         bli_cgemm_opt_8x2_avx1 )
+bli_x86_64_kernel_decl( zgemm_ukernel,         bli_zgemm_opt_4x2_avx1 )
+
+bli_x86_64_kernel_decl( dgemmtrsm_l_ukernel,   bli_dgemmtrsm_l_opt_8x4_avx1 )
+
+bli_x86_64_kernel_decl( dgemmtrsm_u_ukernel,   bli_dgemmtrsm_u_opt_8x4_avx1 )
+
+bli_x86_64_kernel_decl( dtrsm_l_ukernel,       bli_dtrsm_l_opt_8x4_avx1 )
+
+bli_x86_64_kernel_decl( dtrsm_u_ukernel,       bli_dtrsm_u_opt_8x4_avx1 )
+
+// haswell
+bli_x86_64_kernel_decl( sgemm_ukernel,         bli_sgemm_opt_16x6 )
+bli_x86_64_kernel_decl( dgemm_ukernel,         bli_dgemm_opt_8x6 )
+
+bli_x86_64_kernel_decl( dtrsm_l_ukernel,       bli_dtrsm_l_opt_8x6 )
+
+bli_x86_64_kernel_decl( dtrsm_u_ukernel,       bli_dtrsm_u_opt_8x6 )
+
+
+// -- Blocksizes --
+
+// Blocksizes of the generic sub-configuration, indexed by num_t (and thus
+// ordered s, c, d, z).
+dim_t bli_x86_64_mc[ BLIS_NUM_FP_TYPES ] = {  512,  256,  256,  128 };
+dim_t bli_x86_64_kc[ BLIS_NUM_FP_TYPES ] = {  256,  256,  256,  256 };
+dim_t bli_x86_64_nc[ BLIS_NUM_FP_TYPES ] = { 4096, 4096, 4096, 4096 };
+dim_t bli_x86_64_mr[ BLIS_NUM_FP_TYPES ] = {    8,    4,    4,    2 };
+dim_t bli_x86_64_nr[ BLIS_NUM_FP_TYPES ] = {    4,    2,    4,    2 };
+
+// Blocksizes of every sub-configuration, indexed by arch_t and num_t.
+static dim_t bli_x86_64_mc_opt[ BLIS_NUM_ARCHS ][ BLIS_NUM_FP_TYPES ] =
+{
+	{  512,  256,  256,  128 }, // generic
+	{  128,   64,   96,   64 }, // sandybridge
+	{   96,   64,   72,   64 }, // haswell
+};
+
+static dim_t bli_x86_64_kc_opt[ BLIS_NUM_ARCHS ][ BLIS_NUM_FP_TYPES ] =
+{
+	{  256,  256,  256,  256 }, // generic
+	{  384,  128,  256,  128 }, // sandybridge
+	{  384,  128,  240,  128 }, // haswell
+};
+
+static dim_t bli_x86_64_nc_opt[ BLIS_NUM_ARCHS ][ BLIS_NUM_FP_TYPES ] =
+{
+	{ 4096, 4096, 4096, 4096 }, // generic
+	{ 4096, 4096, 4096, 4096 }, // sandybridge
+	{ 4080, 4096, 4080, 4096 }, // haswell
+};
+
+static dim_t bli_x86_64_mr_opt[ BLIS_NUM_ARCHS ][ BLIS_NUM_FP_TYPES ] =
+{
+	{    8,    4,    4,    2 }, // generic
+	{    8,    8,    8,    4 }, // sandybridge
+	{   16,    8,    8,    8 }, // haswell
+};
+
+static dim_t bli_x86_64_nr_opt[ BLIS_NUM_ARCHS ][ BLIS_NUM_FP_TYPES ] =
+{
+	{    4,    2,    4,    2 }, // generic
+	{    8,    2,    4,    2 }, // sandybridge
+	{    6,    4,    6,    4 }, // haswell
+};
+
+
+
+void bli_arch_select( arch_t id )
+{
+	num_t dt;
+
+	// Start from the reference kernels, which are all that the generic
+	// sub-configuration uses. (The pointers are initialized to these, but
+	// bli_init() may be called more than once.)
+	bli_x86_64_sgemm_ukernel          = BLIS_SGEMM_UKERNEL_REF;
+	bli_x86_64_dgemm_ukernel          = BLIS_DGEMM_UKERNEL_REF;
+	bli_x86_64_cgemm_ukernel          = BLIS_CGEMM_UKERNEL_REF;
+	bli_x86_64_zgemm_ukernel          = BLIS_ZGEMM_UKERNEL_REF;
+
+	bli_x86_64_sgemmtrsm_l_ukernel    = BLIS_SGEMMTRSM_L_UKERNEL_REF;
+	bli_x86_64_dgemmtrsm_l_ukernel    = BLIS_DGEMMTRSM_L_UKERNEL_REF;
+	bli_x86_64_cgemmtrsm_l_ukernel    = BLIS_CGEMMTRSM_L_UKERNEL_REF;
+	bli_x86_64_zgemmtrsm_l_ukernel    = BLIS_ZGEMMTRSM_L_UKERNEL_REF;
+
+	bli_x86_64_sgemmtrsm_u_ukernel    = BLIS_SGEMMTRSM_U_UKERNEL_REF;
+	bli_x86_64_dgemmtrsm_u_ukernel    = BLIS_DGEMMTRSM_U_UKERNEL_REF;
+	bli_x86_64_cgemmtrsm_u_ukernel    = BLIS_CGEMMTRSM_U_UKERNEL_REF;
+	bli_x86_64_zgemmtrsm_u_ukernel    = BLIS_ZGEMMTRSM_U_UKERNEL_REF;
+
+	bli_x86_64_strsm_l_ukernel        = BLIS_STRSM_L_UKERNEL_REF;
+	bli_x86_64_dtrsm_l_ukernel        = BLIS_DTRSM_L_UKERNEL_REF;
+	bli_x86_64_ctrsm_l_ukernel        = BLIS_CTRSM_L_UKERNEL_REF;
+	bli_x86_64_ztrsm_l_ukernel        = BLIS_ZTRSM_L_UKERNEL_REF;
+
+	bli_x86_64_strsm_u_ukernel        = BLIS_STRSM_U_UKERNEL_REF;
+	bli_x86_64_dtrsm_u_ukernel        = BLIS_DTRSM_U_UKERNEL_REF;
+	bli_x86_64_ctrsm_u_ukernel        = BLIS_CTRSM_U_UKERNEL_REF;
+	bli_x86_64_ztrsm_u_ukernel        = BLIS_ZTRSM_U_UKERNEL_REF;
+
+	bli_x86_64_spackm_2xk_kernel      = BLIS_SPACKM_2XK_KERNEL_REF;
+	bli_x86_64_dpackm_2xk_kernel      = BLIS_DPACKM_2XK_KERNEL_REF;
+	bli_x86_64_cpackm_2xk_kernel      = BLIS_CPACKM_2XK_KERNEL_REF;
+	bli_x86_64_zpackm_2xk_kernel      = BLIS_ZPACKM_2XK_KERNEL_REF;
+
+	bli_x86_64_spackm_4xk_kernel      = BLIS_SPACKM_4XK_KERNEL_REF;
+	bli_x86_64_dpackm_4xk_kernel      = BLIS_DPACKM_4XK_KERNEL_REF;
+	bli_x86_64_cpackm_4xk_kernel      = BLIS_CPACKM_4XK_KERNEL_REF;
+	bli_x86_64_zpackm_4xk_kernel      = BLIS_ZPACKM_4XK_KERNEL_REF;
+
+	bli_x86_64_spackm_6xk_kernel      = BLIS_SPACKM_6XK_KERNEL_REF;
+	bli_x86_64_dpackm_6xk_kernel      = BLIS_DPACKM_6XK_KERNEL_REF;
+	bli_x86_64_cpackm_6xk_kernel      = BLIS_CPACKM_6XK_KERNEL_REF;
+	bli_x86_64_zpackm_6xk_kernel      = BLIS_ZPACKM_6XK_KERNEL_REF;
+
+	bli_x86_64_spackm_8xk_kernel      = BLIS_SPACKM_8XK_KERNEL_REF;
+	bli_x86_64_dpackm_8xk_kernel      = BLIS_DPACKM_8XK_KERNEL_REF;
+	bli_x86_64_cpackm_8xk_kernel      = BLIS_CPACKM_8XK_KERNEL_REF;
+	bli_x86_64_zpackm_8xk_kernel      = BLIS_ZPACKM_8XK_KERNEL_REF;
+
+	bli_x86_64_spackm_12xk_kernel     = BLIS_SPACKM_12XK_KERNEL_REF;
+	bli_x86_64_dpackm_12xk_kernel     = BLIS_DPACKM_12XK_KERNEL_REF;
+	bli_x86_64_cpackm_12xk_kernel     = BLIS_CPACKM_12XK_KERNEL_REF;
+	bli_x86_64_zpackm_12xk_kernel     = BLIS_ZPACKM_12XK_KERNEL_REF;
+
+	bli_x86_64_spackm_16xk_kernel     = BLIS_SPACKM_16XK_KERNEL_REF;
+	bli_x86_64_dpackm_16xk_kernel     = BLIS_DPACKM_16XK_KERNEL_REF;
+	bli_x86_64_cpackm_16xk_kernel     = BLIS_CPACKM_16XK_KERNEL_REF;
+	bli_x86_64_zpackm_16xk_kernel     = BLIS_ZPACKM_16XK_KERNEL_REF;
+
+	bli_x86_64_saxpy2v_kernel         = BLIS_SAXPY2V_KERNEL_REF;
+	bli_x86_64_daxpy2v_kernel         = BLIS_DAXPY2V_KERNEL_REF;
+
+	bli_x86_64_sdotaxpyv_kernel       = BLIS_SDOTAXPYV_KERNEL_REF;
+	bli_x86_64_ddotaxpyv_kernel       = BLIS_DDOTAXPYV_KERNEL_REF;
+
+	bli_x86_64_saxpyf_kernel          = BLIS_SAXPYF_KERNEL_REF;
+	bli_x86_64_daxpyf_kernel          = BLIS_DAXPYF_KERNEL_REF;
+
+	bli_x86_64_sdotxf_kernel          = BLIS_SDOTXF_KERNEL_REF;
+	bli_x86_64_ddotxf_kernel          = BLIS_DDOTXF_KERNEL_REF;
+
+	bli_x86_64_sdotxaxpyf_kernel      = BLIS_SDOTXAXPYF_KERNEL_REF;
+	bli_x86_64_ddotxaxpyf_kernel      = BLIS_DDOTXAXPYF_KERNEL_REF;
+
+	bli_x86_64_saxpyv_kernel          = BLIS_SAXPYV_KERNEL_REF;
+	bli_x86_64_daxpyv_kernel          = BLIS_DAXPYV_KERNEL_REF;
+	bli_x86_64_caxpyv_kernel          = BLIS_CAXPYV_KERNEL_REF;
+	bli_x86_64_zaxpyv_kernel          = BLIS_ZAXPYV_KERNEL_REF;
+
+	bli_x86_64_scopyv_kernel          = BLIS_SCOPYV_KERNEL_REF;
+	bli_x86_64_dcopyv_kernel          = BLIS_DCOPYV_KERNEL_REF;
+	bli_x86_64_ccopyv_kernel          = BLIS_CCOPYV_KERNEL_REF;
+	bli_x86_64_zcopyv_kernel          = BLIS_ZCOPYV_KERNEL_REF;
+
+	bli_x86_64_sdotv_kernel           = BLIS_SDOTV_KERNEL_REF;
+	bli_x86_64_ddotv_kernel           = BLIS_DDOTV_KERNEL_REF;
+	bli_x86_64_cdotv_kernel           = BLIS_CDOTV_KERNEL_REF;
+	bli_x86_64_zdotv_kernel           = BLIS_ZDOTV_KERNEL_REF;
+
+	bli_x86_64_sdotxv_kernel          = BLIS_SDOTXV_KERNEL_REF;
+	bli_x86_64_ddotxv_kernel          = BLIS_DDOTXV_KERNEL_REF;
+	bli_x86_64_cdotxv_kernel          = BLIS_CDOTXV_KERNEL_REF;
+	bli_x86_64_zdotxv_kernel          = BLIS_ZDOTXV_KERNEL_REF;
+
+	bli_x86_64_sscalv_kernel          = BLIS_SSCALV_KERNEL_REF;
+	bli_x86_64_dscalv_kernel          = BLIS_DSCALV_KERNEL_REF;
+	bli_x86_64_cscalv_kernel          = BLIS_CSCALV_KERNEL_REF;
+	bli_x86_64_zscalv_kernel          = BLIS_ZSCALV_KERNEL_REF;
+
+	// The packm, level-1f, and level-1v kernels require AVX and are
+	// shared by the sandybridge and haswell sub-configurations.
+	if ( id >= BLIS_ARCH_SANDYBRIDGE )
+	{
+		bli_x86_64_spackm_2xk_kernel      = bli_spackm_opt_2xk;
+		bli_x86_64_dpackm_2xk_kernel      = bli_dpackm_opt_2xk;
+		bli_x86_64_cpackm_2xk_kernel      = bli_cpackm_opt_2xk;
+		bli_x86_64_zpackm_2xk_kernel      = bli_zpackm_opt_2xk;
+
+		bli_x86_64_spackm_4xk_kernel      = bli_spackm_opt_4xk;
+		bli_x86_64_dpackm_4xk_kernel      = bli_dpackm_opt_4xk;
+		bli_x86_64_cpackm_4xk_kernel      = bli_cpackm_opt_4xk;
+		bli_x86_64_zpackm_4xk_kernel      = bli_zpackm_opt_4xk;
+
+		bli_x86_64_spackm_6xk_kernel      = bli_spackm_opt_6xk;
+		bli_x86_64_dpackm_6xk_kernel      = bli_dpackm_opt_6xk;
+		bli_x86_64_cpackm_6xk_kernel      = bli_cpackm_opt_6xk;
+		bli_x86_64_zpackm_6xk_kernel      = bli_zpackm_opt_6xk;
+
+		bli_x86_64_spackm_8xk_kernel      = bli_spackm_opt_8xk;
+		bli_x86_64_dpackm_8xk_kernel      = bli_dpackm_opt_8xk;
+		bli_x86_64_cpackm_8xk_kernel      = bli_cpackm_opt_8xk;
+		bli_x86_64_zpackm_8xk_kernel      = bli_zpackm_opt_8xk;
+
+		bli_x86_64_spackm_12xk_kernel     = bli_spackm_opt_12xk;
+		bli_x86_64_dpackm_12xk_kernel     = bli_dpackm_opt_12xk;
+		bli_x86_64_cpackm_12xk_kernel     = bli_cpackm_opt_12xk;
+		bli_x86_64_zpackm_12xk_kernel     = bli_zpackm_opt_12xk;
+
+		bli_x86_64_spackm_16xk_kernel     = bli_spackm_opt_16xk;
+		bli_x86_64_dpackm_16xk_kernel     = bli_dpackm_opt_16xk;
+		bli_x86_64_cpackm_16xk_kernel     = bli_cpackm_opt_16xk;
+		bli_x86_64_zpackm_16xk_kernel     = bli_zpackm_opt_16xk;
+
+		bli_x86_64_saxpy2v_kernel         = bli_saxpy2v_opt_avx;
+		bli_x86_64_daxpy2v_kernel         = bli_daxpy2v_opt_avx;
+
+		bli_x86_64_sdotaxpyv_kernel       = bli_sdotaxpyv_opt_avx;
+		bli_x86_64_ddotaxpyv_kernel       = bli_ddotaxpyv_opt_avx;
+
+		bli_x86_64_saxpyf_kernel          = bli_saxpyf_opt_avx;
+		bli_x86_64_daxpyf_kernel          = bli_daxpyf_opt_avx;
+
+		bli_x86_64_sdotxf_kernel          = bli_sdotxf_opt_avx;
+		bli_x86_64_ddotxf_kernel          = bli_ddotxf_opt_avx;
+
+		bli_x86_64_sdotxaxpyf_kernel      = bli_sdotxaxpyf_opt_avx;
+		bli_x86_64_ddotxaxpyf_kernel      = bli_ddotxaxpyf_opt_avx;
+
+		bli_x86_64_saxpyv_kernel          = bli_saxpyv_opt_avx;
+		bli_x86_64_daxpyv_kernel          = bli_daxpyv_opt_avx;
+		bli_x86_64_caxpyv_kernel          = bli_caxpyv_opt_avx;
+		bli_x86_64_zaxpyv_kernel          = bli_zaxpyv_opt_avx;
+
+		bli_x86_64_scopyv_kernel          = bli_scopyv_opt_avx;
+		bli_x86_64_dcopyv_kernel          = bli_dcopyv_opt_avx;
+		bli_x86_64_ccopyv_kernel          = bli_ccopyv_opt_avx;
+		bli_x86_64_zcopyv_kernel          = bli_zcopyv_opt_avx;
+
+		bli_x86_64_sdotv_kernel           = bli_sdotv_opt_avx;
+		bli_x86_64_ddotv_kernel           = bli_ddotv_opt_avx;
+		bli_x86_64_cdotv_kernel           = bli_cdotv_opt_avx;
+		bli_x86_64_zdotv_kernel           = bli_zdotv_opt_avx;
+
+		bli_x86_64_sdotxv_kernel          = bli_sdotxv_opt_avx;
+		bli_x86_64_ddotxv_kernel          = bli_ddotxv_opt_avx;
+		bli_x86_64_cdotxv_kernel          = bli_cdotxv_opt_avx;
+		bli_x86_64_zdotxv_kernel          = bli_zdotxv_opt_avx;
+
+		bli_x86_64_sscalv_kernel          = bli_sscalv_opt_avx;
+		bli_x86_64_dscalv_kernel          = bli_dscalv_opt_avx;
+		bli_x86_64_cscalv_kernel          = bli_cscalv_opt_avx;
+		bli_x86_64_zscalv_kernel          = bli_zscalv_opt_avx;
+	}
+
+	if ( id == BLIS_ARCH_SANDYBRIDGE )
+	{
+		bli_x86_64_sgemm_ukernel          = bli_sgemm_opt_8x8_avx1;
+		bli_x86_64_dgemm_ukernel          = bli_dgemm_opt_8x4_ref_u4_nodupl_avx1;
+		bli_x86_64_cgemm_ukernel          = bli_cgemm_opt_8x2_avx1;
+		bli_x86_64_zgemm_ukernel          = bli_zgemm_opt_4x2_avx1;
+		bli_x86_64_dgemmtrsm_l_ukernel    = bli_dgemmtrsm_l_opt_8x4_avx1;
+		bli_x86_64_dgemmtrsm_u_ukernel    = bli_dgemmtrsm_u_opt_8x4_avx1;
+		bli_x86_64_dtrsm_l_ukernel        = bli_dtrsm_l_opt_8x4_avx1;
+		bli_x86_64_dtrsm_u_ukernel        = bli_dtrsm_u_opt_8x4_avx1;
+	}
+	else if ( id == BLIS_ARCH_HASWELL )
+	{
+		bli_x86_64_sgemm_ukernel          = bli_sgemm_opt_16x6;
+		bli_x86_64_dgemm_ukernel          = bli_dgemm_opt_8x6;
+		bli_x86_64_dtrsm_l_ukernel        = bli_dtrsm_l_opt_8x6;
+		bli_x86_64_dtrsm_u_ukernel        = bli_dtrsm_u_opt_8x6;
+	}
+
+	for ( dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+	{
+		bli_x86_64_mc[ dt ] = bli_x86_64_mc_opt[ id ][ dt ];
+		bli_x86_64_kc[ dt ] = bli_x86_64_kc_opt[ id ][ dt ];
+		bli_x86_64_nc[ dt ] = bli_x86_64_nc_opt[ id ][ dt ];
+		bli_x86_64_mr[ dt ] = bli_x86_64_mr_opt[ id ][ dt ];
+		bli_x86_64_nr[ dt ] = bli_x86_64_nr_opt[ id ][ dt ];
+	}
+}
+
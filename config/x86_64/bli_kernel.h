@@ -0,0 +1,357 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_KERNEL_H
+#define BLIS_KERNEL_H
+
+
+// -- LEVEL-3 MICRO-KERNEL CONSTANTS -------------------------------------------
+
+// NOTE: This configuration chooses among the generic, sandybridge, and
+// haswell sub-configurations when BLIS is initialized (see
+// bli_arch_x86_64.c). The blocksizes below are upper bounds on those of
+// every sub-configuration; they size the memory pools and the stack buffers
+// used at edge cases, and they must satisfy the same constraints as
+// ordinary blocksizes. The blocksizes actually used are given by the
+// runtime blocksize definitions that follow.
+
+// -- Cache blocksizes --
+
+//
+// Constraints:
+//
+// (1) MC must be a multiple of:
+//     (a) MR (for zero-padding purposes)
+//     (b) NR (for zero-padding purposes when MR and NR are "swapped")
+// (2) NC must be a multiple of
+//     (a) NR (for zero-padding purposes)
+//     (b) MR (for zero-padding purposes when MR and NR are "swapped")
+// (3) KC must be a multiple of
+//     (a) MR and
+//     (b) NR (for triangular operations such as trmm and trsm).
+//
+
+#define BLIS_DEFAULT_MC_S              512
+#define BLIS_DEFAULT_KC_S              384
+#define BLIS_DEFAULT_NC_S              4096
+
+#define BLIS_DEFAULT_MC_D              264
+#define BLIS_DEFAULT_KC_D              288
+#define BLIS_DEFAULT_NC_D              4104
+
+#define BLIS_DEFAULT_MC_C              256
+#define BLIS_DEFAULT_KC_C              256
+#define BLIS_DEFAULT_NC_C              4096
+
+#define BLIS_DEFAULT_MC_Z              128
+#define BLIS_DEFAULT_KC_Z              256
+#define BLIS_DEFAULT_NC_Z              4096
+
+// -- Register blocksizes --
+
+#define BLIS_DEFAULT_MR_S              16
+#define BLIS_DEFAULT_NR_S              8
+
+#define BLIS_DEFAULT_MR_D              8
+#define BLIS_DEFAULT_NR_D              6
+
+#define BLIS_DEFAULT_MR_C              8
+#define BLIS_DEFAULT_NR_C              4
+
+#define BLIS_DEFAULT_MR_Z              8
+#define BLIS_DEFAULT_NR_Z              4
+
+// NOTE: If the micro-kernel, which is typically unrolled to a factor
+// of f, handles leftover edge cases (ie: when k % f > 0) then these
+// register blocksizes in the k dimension can be defined to 1.
+
+//#define BLIS_DEFAULT_KR_S              1
+//#define BLIS_DEFAULT_KR_D              1
+//#define BLIS_DEFAULT_KR_C              1
+//#define BLIS_DEFAULT_KR_Z              1
+
+// -- Runtime blocksizes --
+
+extern dim_t bli_x86_64_mc[ BLIS_NUM_FP_TYPES ];
+extern dim_t bli_x86_64_kc[ BLIS_NUM_FP_TYPES ];
+extern dim_t bli_x86_64_nc[ BLIS_NUM_FP_TYPES ];
+extern dim_t bli_x86_64_mr[ BLIS_NUM_FP_TYPES ];
+extern dim_t bli_x86_64_nr[ BLIS_NUM_FP_TYPES ];
+
+#define BLIS_RUNTIME_MC_S              bli_x86_64_mc[ BLIS_FLOAT ]
+#define BLIS_RUNTIME_MC_D              bli_x86_64_mc[ BLIS_DOUBLE ]
+#define BLIS_RUNTIME_MC_C              bli_x86_64_mc[ BLIS_SCOMPLEX ]
+#define BLIS_RUNTIME_MC_Z              bli_x86_64_mc[ BLIS_DCOMPLEX ]
+
+#define BLIS_RUNTIME_KC_S              bli_x86_64_kc[ BLIS_FLOAT ]
+#define BLIS_RUNTIME_KC_D              bli_x86_64_kc[ BLIS_DOUBLE ]
+#define BLIS_RUNTIME_KC_C              bli_x86_64_kc[ BLIS_SCOMPLEX ]
+#define BLIS_RUNTIME_KC_Z              bli_x86_64_kc[ BLIS_DCOMPLEX ]
+
+#define BLIS_RUNTIME_NC_S              bli_x86_64_nc[ BLIS_FLOAT ]
+#define BLIS_RUNTIME_NC_D              bli_x86_64_nc[ BLIS_DOUBLE ]
+#define BLIS_RUNTIME_NC_C              bli_x86_64_nc[ BLIS_SCOMPLEX ]
+#define BLIS_RUNTIME_NC_Z              bli_x86_64_nc[ BLIS_DCOMPLEX ]
+
+#define BLIS_RUNTIME_MR_S              bli_x86_64_mr[ BLIS_FLOAT ]
+#define BLIS_RUNTIME_MR_D              bli_x86_64_mr[ BLIS_DOUBLE ]
+#define BLIS_RUNTIME_MR_C              bli_x86_64_mr[ BLIS_SCOMPLEX ]
+#define BLIS_RUNTIME_MR_Z              bli_x86_64_mr[ BLIS_DCOMPLEX ]
+
+#define BLIS_RUNTIME_NR_S              bli_x86_64_nr[ BLIS_FLOAT ]
+#define BLIS_RUNTIME_NR_D              bli_x86_64_nr[ BLIS_DOUBLE ]
+#define BLIS_RUNTIME_NR_C              bli_x86_64_nr[ BLIS_SCOMPLEX ]
+#define BLIS_RUNTIME_NR_Z              bli_x86_64_nr[ BLIS_DCOMPLEX ]
+
+// -- Cache blocksize extensions (for optimizing edge cases) --
+
+// NOTE: These cache blocksize "extensions" have the same constraints as
+// the corresponding default blocksizes above. When these values are
+// non-zero, blocksizes used at edge cases are extended (enlarged) if
+// such an extension would encompass the remaining portion of the
+// matrix dimension.
+
+//#define BLIS_EXTEND_MC_S               0 //(BLIS_DEFAULT_MC_S/4)
+//#define BLIS_EXTEND_KC_S               0 //(BLIS_DEFAULT_KC_S/4)
+//#define BLIS_EXTEND_NC_S               0 //(BLIS_DEFAULT_NC_S/4)
+
+//#define BLIS_EXTEND_MC_D               0 //(BLIS_DEFAULT_MC_D/4)
+//#define BLIS_EXTEND_KC_D               0 //(BLIS_DEFAULT_KC_D/4)
+//#define BLIS_EXTEND_NC_D               0 //(BLIS_DEFAULT_NC_D/4)
+
+//#define BLIS_EXTEND_MC_C               0 //(BLIS_DEFAULT_MC_C/4)
+//#define BLIS_EXTEND_KC_C               0 //(BLIS_DEFAULT_KC_C/4)
+//#define BLIS_EXTEND_NC_C               0 //(BLIS_DEFAULT_NC_C/4)
+
+//#define BLIS_EXTEND_MC_Z               0 //(BLIS_DEFAULT_MC_Z/4)
+//#define BLIS_EXTEND_KC_Z               0 //(BLIS_DEFAULT_KC_Z/4)
+//#define BLIS_EXTEND_NC_Z               0 //(BLIS_DEFAULT_NC_Z/4)
+
+// -- Register blocksize extensions (for packed micro-panels) --
+
+// NOTE: These register blocksize "extensions" determine whether the
+// leading dimensions used within the packed micro-panels are equal to
+// or greater than their corresponding register blocksizes above.
+
+//#define BLIS_EXTEND_MR_S               0
+//#define BLIS_EXTEND_NR_S               0
+
+//#define BLIS_EXTEND_MR_D               0
+//#define BLIS_EXTEND_NR_D               0
+
+//#define BLIS_EXTEND_MR_C               0
+//#define BLIS_EXTEND_NR_C               0
+
+//#define BLIS_EXTEND_MR_Z               0
+//#define BLIS_EXTEND_NR_Z               0
+
+
+
+
+// -- LEVEL-2 KERNEL CONSTANTS -------------------------------------------------
+
+
+
+
+// -- LEVEL-1F KERNEL CONSTANTS ------------------------------------------------
+
+// NOTE: The reference level-1f kernels handle any fusing factor, so these
+// may be fixed at those of the optimized kernels.
+
+#define BLIS_L1F_FUSE_FAC_S        8
+#define BLIS_L1F_FUSE_FAC_D        8
+
+
+
+
+// -- LEVEL-3 KERNEL DEFINITIONS -----------------------------------------------
+
+// NOTE: Each kernel below is called through a function pointer that is set
+// by bli_arch_select() when BLIS is initialized.
+
+// -- gemm --
+
+#define BLIS_SGEMM_UKERNEL         ( *bli_x86_64_sgemm_ukernel )
+#define BLIS_DGEMM_UKERNEL         ( *bli_x86_64_dgemm_ukernel )
+#define BLIS_CGEMM_UKERNEL         ( *bli_x86_64_cgemm_ukernel )
+#define BLIS_ZGEMM_UKERNEL         ( *bli_x86_64_zgemm_ukernel )
+
+// -- trsm-related --
+
+#define BLIS_SGEMMTRSM_L_UKERNEL   ( *bli_x86_64_sgemmtrsm_l_ukernel )
+#define BLIS_DGEMMTRSM_L_UKERNEL   ( *bli_x86_64_dgemmtrsm_l_ukernel )
+#define BLIS_CGEMMTRSM_L_UKERNEL   ( *bli_x86_64_cgemmtrsm_l_ukernel )
+#define BLIS_ZGEMMTRSM_L_UKERNEL   ( *bli_x86_64_zgemmtrsm_l_ukernel )
+
+#define BLIS_SGEMMTRSM_U_UKERNEL   ( *bli_x86_64_sgemmtrsm_u_ukernel )
+#define BLIS_DGEMMTRSM_U_UKERNEL   ( *bli_x86_64_dgemmtrsm_u_ukernel )
+#define BLIS_CGEMMTRSM_U_UKERNEL   ( *bli_x86_64_cgemmtrsm_u_ukernel )
+#define BLIS_ZGEMMTRSM_U_UKERNEL   ( *bli_x86_64_zgemmtrsm_u_ukernel )
+
+#define BLIS_STRSM_L_UKERNEL       ( *bli_x86_64_strsm_l_ukernel )
+#define BLIS_DTRSM_L_UKERNEL       ( *bli_x86_64_dtrsm_l_ukernel )
+#define BLIS_CTRSM_L_UKERNEL       ( *bli_x86_64_ctrsm_l_ukernel )
+#define BLIS_ZTRSM_L_UKERNEL       ( *bli_x86_64_ztrsm_l_ukernel )
+
+#define BLIS_STRSM_U_UKERNEL       ( *bli_x86_64_strsm_u_ukernel )
+#define BLIS_DTRSM_U_UKERNEL       ( *bli_x86_64_dtrsm_u_ukernel )
+#define BLIS_CTRSM_U_UKERNEL       ( *bli_x86_64_ctrsm_u_ukernel )
+#define BLIS_ZTRSM_U_UKERNEL       ( *bli_x86_64_ztrsm_u_ukernel )
+
+
+
+
+// -- LEVEL-1M KERNEL DEFINITIONS ----------------------------------------------
+
+// -- packm --
+
+#define BLIS_SPACKM_2XK_KERNEL     ( *bli_x86_64_spackm_2xk_kernel )
+#define BLIS_DPACKM_2XK_KERNEL     ( *bli_x86_64_dpackm_2xk_kernel )
+#define BLIS_CPACKM_2XK_KERNEL     ( *bli_x86_64_cpackm_2xk_kernel )
+#define BLIS_ZPACKM_2XK_KERNEL     ( *bli_x86_64_zpackm_2xk_kernel )
+
+#define BLIS_SPACKM_4XK_KERNEL     ( *bli_x86_64_spackm_4xk_kernel )
+#define BLIS_DPACKM_4XK_KERNEL     ( *bli_x86_64_dpackm_4xk_kernel )
+#define BLIS_CPACKM_4XK_KERNEL     ( *bli_x86_64_cpackm_4xk_kernel )
+#define BLIS_ZPACKM_4XK_KERNEL     ( *bli_x86_64_zpackm_4xk_kernel )
+
+#define BLIS_SPACKM_6XK_KERNEL     ( *bli_x86_64_spackm_6xk_kernel )
+#define BLIS_DPACKM_6XK_KERNEL     ( *bli_x86_64_dpackm_6xk_kernel )
+#define BLIS_CPACKM_6XK_KERNEL     ( *bli_x86_64_cpackm_6xk_kernel )
+#define BLIS_ZPACKM_6XK_KERNEL     ( *bli_x86_64_zpackm_6xk_kernel )
+
+#define BLIS_SPACKM_8XK_KERNEL     ( *bli_x86_64_spackm_8xk_kernel )
+#define BLIS_DPACKM_8XK_KERNEL     ( *bli_x86_64_dpackm_8xk_kernel )
+#define BLIS_CPACKM_8XK_KERNEL     ( *bli_x86_64_cpackm_8xk_kernel )
+#define BLIS_ZPACKM_8XK_KERNEL     ( *bli_x86_64_zpackm_8xk_kernel )
+
+#define BLIS_SPACKM_12XK_KERNEL    ( *bli_x86_64_spackm_12xk_kernel )
+#define BLIS_DPACKM_12XK_KERNEL    ( *bli_x86_64_dpackm_12xk_kernel )
+#define BLIS_CPACKM_12XK_KERNEL    ( *bli_x86_64_cpackm_12xk_kernel )
+#define BLIS_ZPACKM_12XK_KERNEL    ( *bli_x86_64_zpackm_12xk_kernel )
+
+#define BLIS_SPACKM_16XK_KERNEL    ( *bli_x86_64_spackm_16xk_kernel )
+#define BLIS_DPACKM_16XK_KERNEL    ( *bli_x86_64_dpackm_16xk_kernel )
+#define BLIS_CPACKM_16XK_KERNEL    ( *bli_x86_64_cpackm_16xk_kernel )
+#define BLIS_ZPACKM_16XK_KERNEL    ( *bli_x86_64_zpackm_16xk_kernel )
+
+// -- unpackm --
+
+
+
+
+// -- LEVEL-1F KERNEL DEFINITIONS ----------------------------------------------
+
+// -- axpy2v --
+
+#define BLIS_SAXPY2V_KERNEL        ( *bli_x86_64_saxpy2v_kernel )
+#define BLIS_DAXPY2V_KERNEL        ( *bli_x86_64_daxpy2v_kernel )
+
+// -- dotaxpyv --
+
+#define BLIS_SDOTAXPYV_KERNEL      ( *bli_x86_64_sdotaxpyv_kernel )
+#define BLIS_DDOTAXPYV_KERNEL      ( *bli_x86_64_ddotaxpyv_kernel )
+
+// -- axpyf --
+
+#define BLIS_SAXPYF_KERNEL         ( *bli_x86_64_saxpyf_kernel )
+#define BLIS_DAXPYF_KERNEL         ( *bli_x86_64_daxpyf_kernel )
+
+// -- dotxf --
+
+#define BLIS_SDOTXF_KERNEL         ( *bli_x86_64_sdotxf_kernel )
+#define BLIS_DDOTXF_KERNEL         ( *bli_x86_64_ddotxf_kernel )
+
+// -- dotxaxpyf --
+
+#define BLIS_SDOTXAXPYF_KERNEL     ( *bli_x86_64_sdotxaxpyf_kernel )
+#define BLIS_DDOTXAXPYF_KERNEL     ( *bli_x86_64_ddotxaxpyf_kernel )
+
+
+
+
+// -- LEVEL-1V KERNEL DEFINITIONS ----------------------------------------------
+
+// -- addv --
+
+// -- axpyv --
+
+#define BLIS_SAXPYV_KERNEL         ( *bli_x86_64_saxpyv_kernel )
+#define BLIS_DAXPYV_KERNEL         ( *bli_x86_64_daxpyv_kernel )
+#define BLIS_CAXPYV_KERNEL         ( *bli_x86_64_caxpyv_kernel )
+#define BLIS_ZAXPYV_KERNEL         ( *bli_x86_64_zaxpyv_kernel )
+
+// -- copyv --
+
+#define BLIS_SCOPYV_KERNEL         ( *bli_x86_64_scopyv_kernel )
+#define BLIS_DCOPYV_KERNEL         ( *bli_x86_64_dcopyv_kernel )
+#define BLIS_CCOPYV_KERNEL         ( *bli_x86_64_ccopyv_kernel )
+#define BLIS_ZCOPYV_KERNEL         ( *bli_x86_64_zcopyv_kernel )
+
+// -- dotv --
+
+#define BLIS_SDOTV_KERNEL          ( *bli_x86_64_sdotv_kernel )
+#define BLIS_DDOTV_KERNEL          ( *bli_x86_64_ddotv_kernel )
+#define BLIS_CDOTV_KERNEL          ( *bli_x86_64_cdotv_kernel )
+#define BLIS_ZDOTV_KERNEL          ( *bli_x86_64_zdotv_kernel )
+
+// -- dotxv --
+
+#define BLIS_SDOTXV_KERNEL         ( *bli_x86_64_sdotxv_kernel )
+#define BLIS_DDOTXV_KERNEL         ( *bli_x86_64_ddotxv_kernel )
+#define BLIS_CDOTXV_KERNEL         ( *bli_x86_64_cdotxv_kernel )
+#define BLIS_ZDOTXV_KERNEL         ( *bli_x86_64_zdotxv_kernel )
+
+// -- invertv --
+
+// -- scal2v --
+
+// -- scalv --
+
+#define BLIS_SSCALV_KERNEL         ( *bli_x86_64_sscalv_kernel )
+#define BLIS_DSCALV_KERNEL         ( *bli_x86_64_dscalv_kernel )
+#define BLIS_CSCALV_KERNEL         ( *bli_x86_64_cscalv_kernel )
+#define BLIS_ZSCALV_KERNEL         ( *bli_x86_64_zscalv_kernel )
+
+// -- setv --
+
+// -- subv --
+
+// -- swapv --
+
+
+
+#endif
+
@@ -56,7 +56,7 @@ void bli_packv_init( obj_t*   a,
 	// is NULL, and if so, simply alias the object to its packed counterpart.
 	if ( cntl_is_noop( cntl ) )
 	{
-		bli_obj_alias_to( *a, *p );
+		bli_obj_alias_for_pack_skip( *a, *p );
 		return;
 	}
 
@@ -70,7 +70,7 @@ void bli_packv_init( obj_t*   a,
 	// of current pack status and desired pack schema are valid.
 	if ( bli_obj_pack_status( *a ) == cntl_pack_schema( cntl ) )
 	{
-		bli_obj_alias_to( *a, *p );
+		bli_obj_alias_for_pack_skip( *a, *p );
 		return;
 	}
 
@@ -131,8 +131,10 @@ void bli_packv_init_pack( pack_t   pack_schema,
 	void*  buf;
 
 
-	// We begin by copying the basic fields of c.
-	bli_obj_alias_to( *c, *p );
+	// We begin by copying the basic fields of c. We do NOT copy the
+	// pack_mem entry from c because the entry in p may be cached from
+	// a previous iteration, and thus we don't want to overwrite it.
+	bli_obj_alias_for_packing( *c, *p );
 
 	// Update the dimensions.
 	bli_obj_set_dims( dim_c, 1, *p );
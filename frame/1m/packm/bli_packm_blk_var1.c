@@ -52,14 +52,16 @@ typedef void (*FUNCPTR_T)(
                            void*   kappa,
                            void*   c, inc_t rs_c, inc_t cs_c,
                            void*   p, inc_t rs_p, inc_t cs_p,
-                                      dim_t pd_p, inc_t ps_p
+                                      dim_t pd_p, inc_t ps_p,
+                           packm_thrinfo_t* thread
                          );
 
 static FUNCPTR_T GENARRAY(ftypes,packm_blk_var1);
 
 
 void bli_packm_blk_var1( obj_t*   c,
-                         obj_t*   p )
+                         obj_t*   p,
+                         packm_thrinfo_t* thread )
 {
 	num_t     dt_cp     = bli_obj_datatype( *c );
 
@@ -117,7 +119,8 @@ void bli_packm_blk_var1( obj_t*   c,
 	   buf_kappa,
 	   buf_c, rs_c, cs_c,
 	   buf_p, rs_p, cs_p,
-	          pd_p, ps_p );
+	          pd_p, ps_p,
+	   thread );
 }
 
 
@@ -140,7 +143,8 @@ void PASTEMAC(ch,varname)( \
                            void*   kappa, \
                            void*   c, inc_t rs_c, inc_t cs_c, \
                            void*   p, inc_t rs_p, inc_t cs_p, \
-                                      dim_t pd_p, inc_t ps_p  \
+                                      dim_t pd_p, inc_t ps_p, \
+                           packm_thrinfo_t* thread \
                          ) \
 { \
 	ctype* restrict kappa_cast = kappa; \
@@ -315,19 +319,22 @@ void PASTEMAC(ch,varname)( \
 			c_use = c_begin + (panel_off_i  )*ldc; \
 			p_use = p_begin; \
 \
-			PASTEMAC(ch,packm_tri_cxk)( strucc, \
-			                            diagoffp_i, \
-			                            diagc, \
-			                            uploc, \
-			                            conjc, \
-			                            invdiag, \
-			                            *m_panel_use, \
-			                            *n_panel_use, \
-			                            *m_panel_max, \
-			                            *n_panel_max, \
-			                            kappa_cast, \
-			                            c_use, rs_c, cs_c, \
-			                            p_use, rs_p, cs_p ); \
+			if ( bli_packm_my_iter( it, thread ) ) \
+			{ \
+				PASTEMAC(ch,packm_tri_cxk)( strucc, \
+				                            diagoffp_i, \
+				                            diagc, \
+				                            uploc, \
+				                            conjc, \
+				                            invdiag, \
+				                            *m_panel_use, \
+				                            *n_panel_use, \
+				                            *m_panel_max, \
+				                            *n_panel_max, \
+				                            kappa_cast, \
+				                            c_use, rs_c, cs_c, \
+				                            p_use, rs_p, cs_p ); \
+			} \
 \
 \
 			p_inc = ldp * panel_len_max_i; \
@@ -341,17 +348,20 @@ void PASTEMAC(ch,varname)( \
 			panel_len_i     = panel_len_full; \
 			panel_len_max_i = panel_len_max; \
 \
-			PASTEMAC(ch,packm_herm_cxk)( strucc, \
-			                             diagoffc_i, \
-			                             uploc, \
-			                             conjc, \
-			                             *m_panel_use, \
-			                             *n_panel_use, \
-			                             *m_panel_max, \
-			                             *n_panel_max, \
-			                             kappa_cast, \
-			                             c_begin, rs_c, cs_c, \
-			                             p_begin, rs_p, cs_p ); \
+			if ( bli_packm_my_iter( it, thread ) ) \
+			{ \
+				PASTEMAC(ch,packm_herm_cxk)( strucc, \
+				                             diagoffc_i, \
+				                             uploc, \
+				                             conjc, \
+				                             *m_panel_use, \
+				                             *n_panel_use, \
+				                             *m_panel_max, \
+				                             *n_panel_max, \
+				                             kappa_cast, \
+				                             c_begin, rs_c, cs_c, \
+				                             p_begin, rs_p, cs_p ); \
+			} \
 \
 			/* NOTE: This value is equivalent to ps_p. */ \
 			p_inc = ldp * panel_len_max_i; \
@@ -365,17 +375,20 @@ void PASTEMAC(ch,varname)( \
 			panel_len_i     = panel_len_full; \
 			panel_len_max_i = panel_len_max; \
 \
-			PASTEMAC(ch,packm_gen_cxk)( BLIS_GENERAL, \
-			                            0, \
-			                            BLIS_DENSE, \
-			                            conjc, \
-			                            *m_panel_use, \
-			                            *n_panel_use, \
-			                            *m_panel_max, \
-			                            *n_panel_max, \
-			                            kappa_cast, \
-			                            c_begin, rs_c, cs_c, \
-			                            p_begin, rs_p, cs_p ); \
+			if ( bli_packm_my_iter( it, thread ) ) \
+			{ \
+				PASTEMAC(ch,packm_gen_cxk)( BLIS_GENERAL, \
+				                            0, \
+				                            BLIS_DENSE, \
+				                            conjc, \
+				                            *m_panel_use, \
+				                            *n_panel_use, \
+				                            *m_panel_max, \
+				                            *n_panel_max, \
+				                            kappa_cast, \
+				                            c_begin, rs_c, cs_c, \
+				                            p_begin, rs_p, cs_p ); \
+			} \
 \
 			/* NOTE: This value is equivalent to ps_p. */ \
 			p_inc = ldp * panel_len_max_i; \
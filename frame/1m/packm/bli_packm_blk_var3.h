@@ -33,7 +33,8 @@
 */
 
 void bli_packm_blk_var3( obj_t*   c,
-                         obj_t*   p );
+                         obj_t*   p,
+                         packm_thrinfo_t* thread );
 
 
 #undef  GENTPROTCO
@@ -55,7 +56,8 @@ void PASTEMAC(ch,varname)( \
                            void*   kappa, \
                            void*   c, inc_t rs_c, inc_t cs_c, \
                            void*   p, inc_t rs_p, inc_t cs_p, \
-                                      dim_t pd_p, inc_t ps_p \
+                                      dim_t pd_p, inc_t ps_p, \
+                           packm_thrinfo_t* thread \
                          );
 
 INSERT_GENTPROTCO_BASIC( packm_blk_var3 )
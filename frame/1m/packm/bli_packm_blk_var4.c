@@ -52,14 +52,16 @@ typedef void (*FUNCPTR_T)(
                            void*   kappa,
                            void*   c, inc_t rs_c, inc_t cs_c,
                            void*   p, inc_t rs_p, inc_t cs_p,
-                                      dim_t pd_p, inc_t ps_p
+                                      dim_t pd_p, inc_t ps_p,
+                           packm_thrinfo_t* thread
                          );
 
 //static FUNCPTR_T GENARRAY(ftypes,packm_blk_var4);
 
 
 void bli_packm_blk_var4( obj_t*   c,
-                         obj_t*   p )
+                         obj_t*   p,
+                         packm_thrinfo_t* thread )
 {
 	num_t     dt_cp     = bli_obj_datatype( *c );
 
@@ -98,7 +100,7 @@ void bli_packm_blk_var4( obj_t*   c,
 	// in the real domain.
 	if ( bli_is_real( dt_cp ) )
 	{
-		bli_packm_blk_var1( c, p );
+		bli_packm_blk_var1( c, p, thread );
 		return;
 	}
 
@@ -114,8 +116,12 @@ void bli_packm_blk_var4( obj_t*   c,
 		// Detach the scalar.
 		bli_obj_scalar_detach( p, &kappa );
 
-		// Reset the attached scalar (to 1.0).
-		bli_obj_scalar_reset( p );
+		// Reset the attached scalar (to 1.0). Since p may be shared by
+		// several threads, wait until all of them have detached the
+		// scalar before one of them resets it.
+		thread_obarrier( thread );
+		if ( thread_am_ochief( thread ) )
+			bli_obj_scalar_reset( p );
 
 		kappa_p = &kappa;
 	}
@@ -154,7 +160,8 @@ void bli_packm_blk_var4( obj_t*   c,
 	   buf_kappa,
 	   buf_c, rs_c, cs_c,
 	   buf_p, rs_p, cs_p,
-	          pd_p, ps_p );
+	          pd_p, ps_p,
+	   thread );
 }
 
 
@@ -177,7 +184,8 @@ void PASTEMAC(ch,varname)( \
                            void*   kappa, \
                            void*   c, inc_t rs_c, inc_t cs_c, \
                            void*   p, inc_t rs_p, inc_t cs_p, \
-                                      dim_t pd_p, inc_t ps_p  \
+                                      dim_t pd_p, inc_t ps_p, \
+                           packm_thrinfo_t* thread \
                          ) \
 { \
 	ctype* restrict kappa_cast = kappa; \
@@ -352,19 +360,22 @@ void PASTEMAC(ch,varname)( \
 			c_use = c_begin + (panel_off_i  )*ldc; \
 			p_use = p_begin; \
 \
-			PASTEMAC(ch,packm_tri_cxk_ri)( strucc, \
-			                               diagoffp_i, \
-			                               diagc, \
-			                               uploc, \
-			                               conjc, \
-			                               invdiag, \
-			                               *m_panel_use, \
-			                               *n_panel_use, \
-			                               *m_panel_max, \
-			                               *n_panel_max, \
-			                               kappa_cast, \
-			                               c_use, rs_c, cs_c, \
-			                               p_use, rs_p, cs_p ); \
+			if ( bli_packm_my_iter( it, thread ) ) \
+			{ \
+				PASTEMAC(ch,packm_tri_cxk_ri)( strucc, \
+				                               diagoffp_i, \
+				                               diagc, \
+				                               uploc, \
+				                               conjc, \
+				                               invdiag, \
+				                               *m_panel_use, \
+				                               *n_panel_use, \
+				                               *m_panel_max, \
+				                               *n_panel_max, \
+				                               kappa_cast, \
+				                               c_use, rs_c, cs_c, \
+				                               p_use, rs_p, cs_p ); \
+			} \
 \
 			p_inc = ldp * panel_len_max_i; \
 \
@@ -395,17 +406,20 @@ void PASTEMAC(ch,varname)( \
 			panel_len_i     = panel_len_full; \
 			panel_len_max_i = panel_len_max; \
 \
-			PASTEMAC(ch,packm_herm_cxk_ri)( strucc, \
-			                                diagoffc_i, \
-			                                uploc, \
-			                                conjc, \
-			                                *m_panel_use, \
-			                                *n_panel_use, \
-			                                *m_panel_max, \
-			                                *n_panel_max, \
-			                                kappa_cast, \
-			                                c_begin, rs_c, cs_c, \
-			                                p_begin, rs_p, cs_p ); \
+			if ( bli_packm_my_iter( it, thread ) ) \
+			{ \
+				PASTEMAC(ch,packm_herm_cxk_ri)( strucc, \
+				                                diagoffc_i, \
+				                                uploc, \
+				                                conjc, \
+				                                *m_panel_use, \
+				                                *n_panel_use, \
+				                                *m_panel_max, \
+				                                *n_panel_max, \
+				                                kappa_cast, \
+				                                c_begin, rs_c, cs_c, \
+				                                p_begin, rs_p, cs_p ); \
+			} \
 \
 			/* NOTE: This value is equivalent to ps_p. */ \
 			p_inc = ldp * panel_len_max_i; \
@@ -419,17 +433,20 @@ void PASTEMAC(ch,varname)( \
 			panel_len_i     = panel_len_full; \
 			panel_len_max_i = panel_len_max; \
 \
-			PASTEMAC(ch,packm_gen_cxk_ri)( BLIS_GENERAL, \
-			                               0, \
-			                               BLIS_DENSE, \
-			                               conjc, \
-			                               *m_panel_use, \
-			                               *n_panel_use, \
-			                               *m_panel_max, \
-			                               *n_panel_max, \
-			                               kappa_cast, \
-			                               c_begin, rs_c, cs_c, \
-			                               p_begin, rs_p, cs_p ); \
+			if ( bli_packm_my_iter( it, thread ) ) \
+			{ \
+				PASTEMAC(ch,packm_gen_cxk_ri)( BLIS_GENERAL, \
+				                               0, \
+				                               BLIS_DENSE, \
+				                               conjc, \
+				                               *m_panel_use, \
+				                               *n_panel_use, \
+				                               *m_panel_max, \
+				                               *n_panel_max, \
+				                               kappa_cast, \
+				                               c_begin, rs_c, cs_c, \
+				                               p_begin, rs_p, cs_p ); \
+			} \
 \
 			/* NOTE: This value is equivalent to ps_p. */ \
 			p_inc = ldp * panel_len_max_i; \
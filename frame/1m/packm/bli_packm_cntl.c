@@ -47,6 +47,9 @@ packm_t* packm_cntl;
 
 void bli_packm_cntl_init()
 {
+	// Fill the table of packm kernels indexed by panel width.
+	bli_packm_cxk_init();
+
 	// Create blocksize objects for m and n register blocking. We will attach
 	// these to the packm control node so they can be used to (a) allocate a
 	// block whose m and n dimension are multiples of mr and nr, and (b) know
@@ -57,17 +60,17 @@ void bli_packm_cntl_init()
 	// dimensions of all pack matrix buffers the same amount.
 	packm_mult_ldim
 	=
-	bli_blksz_obj_create( BLIS_DEFAULT_MR_S, 0,
-	                      BLIS_DEFAULT_MR_D, 0,
-	                      BLIS_DEFAULT_MR_C, 0,
-	                      BLIS_DEFAULT_MR_Z, 0 );
+	bli_blksz_obj_create( BLIS_RUNTIME_MR_S, 0,
+	                      BLIS_RUNTIME_MR_D, 0,
+	                      BLIS_RUNTIME_MR_C, 0,
+	                      BLIS_RUNTIME_MR_Z, 0 );
 
 	packm_mult_nvec
 	=
-	bli_blksz_obj_create( BLIS_DEFAULT_NR_S, 0,
-	                      BLIS_DEFAULT_NR_D, 0,
-	                      BLIS_DEFAULT_NR_C, 0,
-	                      BLIS_DEFAULT_NR_Z, 0 );
+	bli_blksz_obj_create( BLIS_RUNTIME_NR_S, 0,
+	                      BLIS_RUNTIME_NR_D, 0,
+	                      BLIS_RUNTIME_NR_C, 0,
+	                      BLIS_RUNTIME_NR_Z, 0 );
 
 	// Generally speaking, the BLIS_PACKED_ROWS and BLIS_PACKED_COLUMNS
 	// are used by the level-2 operations, and thus densification is not
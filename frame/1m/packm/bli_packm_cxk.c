@@ -47,105 +47,31 @@ typedef void (*FUNCPTR_T)(
 #undef  FUNCPTR_ARRAY_LENGTH
 #define FUNCPTR_ARRAY_LENGTH 18
 
-static FUNCPTR_T ftypes[FUNCPTR_ARRAY_LENGTH][BLIS_NUM_FP_TYPES] =
+// The kernels are looked up by panel width. The table is filled in by
+// bli_packm_cxk_init() rather than statically so that configurations that
+// choose their kernels at runtime (see BLIS_ENABLE_ARCH_DISPATCH) may store
+// the kernels they selected. Panel widths without a kernel remain NULL.
+static FUNCPTR_T ftypes[FUNCPTR_ARRAY_LENGTH][BLIS_NUM_FP_TYPES];
+
+#define bli_packm_cxk_set_ftypes( ch, dt ) \
+{ \
+	ftypes[  2 ][ dt ] = ( FUNCPTR_T ) PASTEMAC(ch,PACKM_2XK_KERNEL); \
+	ftypes[  4 ][ dt ] = ( FUNCPTR_T ) PASTEMAC(ch,PACKM_4XK_KERNEL); \
+	ftypes[  6 ][ dt ] = ( FUNCPTR_T ) PASTEMAC(ch,PACKM_6XK_KERNEL); \
+	ftypes[  8 ][ dt ] = ( FUNCPTR_T ) PASTEMAC(ch,PACKM_8XK_KERNEL); \
+	ftypes[ 10 ][ dt ] = ( FUNCPTR_T ) PASTEMAC(ch,PACKM_10XK_KERNEL); \
+	ftypes[ 12 ][ dt ] = ( FUNCPTR_T ) PASTEMAC(ch,PACKM_12XK_KERNEL); \
+	ftypes[ 14 ][ dt ] = ( FUNCPTR_T ) PASTEMAC(ch,PACKM_14XK_KERNEL); \
+	ftypes[ 16 ][ dt ] = ( FUNCPTR_T ) PASTEMAC(ch,PACKM_16XK_KERNEL); \
+}
+
+void bli_packm_cxk_init( void )
 {
-	/* panel width = 0 */
-	{
-		NULL, NULL, NULL, NULL,
-	},
-	/* panel width = 1 */
-	{
-		NULL, NULL, NULL, NULL,
-	},
-	/* panel width = 2 */
-	{
-		BLIS_SPACKM_2XK_KERNEL,
-		BLIS_CPACKM_2XK_KERNEL,
-		BLIS_DPACKM_2XK_KERNEL,
-		BLIS_ZPACKM_2XK_KERNEL,
-	},
-	/* panel width = 3 */
-	{
-		NULL, NULL, NULL, NULL,
-	},
-	/* panel width = 4 */
-	{
-		BLIS_SPACKM_4XK_KERNEL,
-		BLIS_CPACKM_4XK_KERNEL,
-		BLIS_DPACKM_4XK_KERNEL,
-		BLIS_ZPACKM_4XK_KERNEL,
-	},
-	/* panel width = 5 */
-	{
-		NULL, NULL, NULL, NULL,
-	},
-	/* panel width = 6 */
-	{
-		BLIS_SPACKM_6XK_KERNEL,
-		BLIS_CPACKM_6XK_KERNEL,
-		BLIS_DPACKM_6XK_KERNEL,
-		BLIS_ZPACKM_6XK_KERNEL,
-	},
-	/* panel width = 7 */
-	{
-		NULL, NULL, NULL, NULL,
-	},
-	/* panel width = 8 */
-	{
-		BLIS_SPACKM_8XK_KERNEL,
-		BLIS_CPACKM_8XK_KERNEL,
-		BLIS_DPACKM_8XK_KERNEL,
-		BLIS_ZPACKM_8XK_KERNEL,
-	},
-	/* panel width = 9 */
-	{
-		NULL, NULL, NULL, NULL,
-	},
-	/* panel width = 10 */
-	{
-		BLIS_SPACKM_10XK_KERNEL,
-		BLIS_CPACKM_10XK_KERNEL,
-		BLIS_DPACKM_10XK_KERNEL,
-		BLIS_ZPACKM_10XK_KERNEL,
-	},
-	/* panel width = 11 */
-	{
-		NULL, NULL, NULL, NULL,
-	},
-	/* panel width = 12 */
-	{
-		BLIS_SPACKM_12XK_KERNEL,
-		BLIS_CPACKM_12XK_KERNEL,
-		BLIS_DPACKM_12XK_KERNEL,
-		BLIS_ZPACKM_12XK_KERNEL,
-	},
-	/* panel width = 13 */
-	{
-		NULL, NULL, NULL, NULL,
-	},
-	/* panel width = 14 */
-	{
-		BLIS_SPACKM_14XK_KERNEL,
-		BLIS_CPACKM_14XK_KERNEL,
-		BLIS_DPACKM_14XK_KERNEL,
-		BLIS_ZPACKM_14XK_KERNEL,
-	},
-	/* panel width = 15 */
-	{
-		NULL, NULL, NULL, NULL,
-	},
-	/* panel width = 16 */
-	{
-		BLIS_SPACKM_16XK_KERNEL,
-		BLIS_CPACKM_16XK_KERNEL,
-		BLIS_DPACKM_16XK_KERNEL,
-		BLIS_ZPACKM_16XK_KERNEL,
-	},
-	/* panel width = 17 */
-	{
-		NULL, NULL, NULL, NULL,
-	},
-};
+	bli_packm_cxk_set_ftypes( s, BLIS_FLOAT    );
+	bli_packm_cxk_set_ftypes( c, BLIS_SCOMPLEX );
+	bli_packm_cxk_set_ftypes( d, BLIS_DOUBLE   );
+	bli_packm_cxk_set_ftypes( z, BLIS_DCOMPLEX );
+}
 
 
 
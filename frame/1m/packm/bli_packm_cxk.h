@@ -43,6 +43,8 @@
 #include "bli_packm_ref_16xk.h"
 
 
+void bli_packm_cxk_init( void );
+
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, varname ) \
 \
@@ -62,7 +62,7 @@ void bli_packm_init( obj_t*   a,
 	// is NULL, and if so, simply alias the object to its packed counterpart.
 	if ( cntl_is_noop( cntl ) )
 	{
-		bli_obj_alias_to( *a, *p );
+		bli_obj_alias_for_pack_skip( *a, *p );
 		return;
 	}
 
@@ -77,7 +77,7 @@ void bli_packm_init( obj_t*   a,
 	// operands in the level-2 operations.
 	if ( bli_obj_pack_status( *a ) == BLIS_PACKED_UNSPEC )
 	{
-		bli_obj_alias_to( *a, *p );
+		bli_obj_alias_for_pack_skip( *a, *p );
 		return;
 	}
 
@@ -91,7 +91,7 @@ void bli_packm_init( obj_t*   a,
 	// current pack status and desired pack schema are valid.
 	if ( bli_obj_pack_status( *a ) == cntl_pack_schema( cntl ) )
 	{
-		bli_obj_alias_to( *a, *p );
+		bli_obj_alias_for_pack_skip( *a, *p );
 		return;
 	}
 
@@ -99,7 +99,7 @@ void bli_packm_init( obj_t*   a,
 	// the packm operation entirely and alias.
 	if ( bli_obj_is_zeros( *a ) )
 	{
-		bli_obj_alias_to( *a, *p );
+		bli_obj_alias_for_pack_skip( *a, *p );
 		return;
 	}
 
@@ -37,7 +37,8 @@
 #define FUNCPTR_T packm_fp
 
 typedef void (*FUNCPTR_T)( obj_t*   a,
-                           obj_t*   p );
+                           obj_t*   p,
+                           packm_thrinfo_t* thread );
 
 static FUNCPTR_T vars[6][3] =
 {
@@ -52,7 +53,8 @@ static FUNCPTR_T vars[6][3] =
 
 void bli_packm_int( obj_t*   a,
                     obj_t*   p,
-                    packm_t* cntl )
+                    packm_t* cntl,
+                    packm_thrinfo_t* thread )
 {
 	varnum_t  n;
 	impl_t    i;
@@ -119,6 +121,10 @@ void bli_packm_int( obj_t*   a,
 
 	// Invoke the variant with kappa_use.
 	f( a,
-	   p );
+	   p,
+	   thread );
+
+	// Barrier so that packing is done before computation.
+	thread_obarrier( thread );
 }
 
@@ -53,8 +53,10 @@ void bli_packm_acquire_mpart_t2b( subpart_t requested_part,
 	}
 
 	// Partitioning top-to-bottom through packed column panels (which are
-	// row-stored) is not yet supported.
-	if ( bli_obj_is_row_stored( *obj ) )
+	// row-stored) is only supported for the conventional schema, where it
+	// amounts to partitioning every panel along the k dimension.
+	if ( bli_obj_is_row_stored( *obj ) &&
+	     bli_obj_pack_status( *obj ) != BLIS_PACKED_COL_PANELS )
 	{
 		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
 	}
@@ -96,11 +98,19 @@ void bli_packm_acquire_mpart_t2b( subpart_t requested_part,
 	}
 
 	// Translate the desired offsets to a panel offset and adjust the
-	// buffer pointer of the subpartition object.
+	// buffer pointer of the subpartition object. When partitioning along
+	// the k dimension of a panel-packed object, the subpartition instead
+	// begins i rows into each panel, and so the panel stride is
+	// inherited unchanged.
 	{
 		char* buf_p        = bli_obj_buffer( *sub_obj );
 		siz_t elem_size    = bli_obj_elem_size( *sub_obj );
-		dim_t off_to_panel = bli_packm_offset_to_panel_for( i, sub_obj );
+		dim_t off_to_panel;
+
+		if ( bli_obj_pack_status( *sub_obj ) == BLIS_PACKED_COL_PANELS )
+			off_to_panel = i * bli_obj_row_stride( *sub_obj );
+		else
+			off_to_panel = bli_packm_offset_to_panel_for( i, sub_obj );
 
 		buf_p = buf_p + elem_size * off_to_panel;
 
@@ -129,8 +139,10 @@ void bli_packm_acquire_mpart_l2r( subpart_t requested_part,
 	}
 
 	// Partitioning left-to-right through packed row panels (which are
-	// column-stored) is not yet supported.
-	if ( bli_obj_is_col_stored( *obj ) )
+	// column-stored) is only supported for the conventional schema, where it
+	// amounts to partitioning every panel along the k dimension.
+	if ( bli_obj_is_col_stored( *obj ) &&
+	     bli_obj_pack_status( *obj ) != BLIS_PACKED_ROW_PANELS )
 	{
 		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
 	}
@@ -172,11 +184,19 @@ void bli_packm_acquire_mpart_l2r( subpart_t requested_part,
 	}
 
 	// Translate the desired offsets to a panel offset and adjust the
-	// buffer pointer of the subpartition object.
+	// buffer pointer of the subpartition object. When partitioning along
+	// the k dimension of a panel-packed object, the subpartition instead
+	// begins j columns into each panel, and so the panel stride is
+	// inherited unchanged.
 	{
 		char* buf_p        = bli_obj_buffer( *sub_obj );
 		siz_t elem_size    = bli_obj_elem_size( *sub_obj );
-		dim_t off_to_panel = bli_packm_offset_to_panel_for( j, sub_obj );
+		dim_t off_to_panel;
+
+		if ( bli_obj_pack_status( *sub_obj ) == BLIS_PACKED_ROW_PANELS )
+			off_to_panel = j * bli_obj_col_stride( *sub_obj );
+		else
+			off_to_panel = bli_packm_offset_to_panel_for( j, sub_obj );
 
 		buf_p = buf_p + elem_size * off_to_panel;
 
@@ -0,0 +1,71 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+packm_thrinfo_t BLIS_PACKM_SINGLE_THREADED =
+{
+	&BLIS_SINGLE_COMM, 0,
+	&BLIS_SINGLE_COMM, 0,
+	1, 0
+};
+
+
+packm_thrinfo_t* bli_packm_thrinfo_create( thread_comm_t* comm,
+                                           dim_t          comm_id )
+{
+	packm_thrinfo_t* thread;
+
+	thread = ( packm_thrinfo_t* ) bli_malloc( sizeof(packm_thrinfo_t) );
+
+	// All of the threads in comm pack the object together, each one
+	// packing its own share of the micro-panels.
+	thread->ocomm    = comm;
+	thread->ocomm_id = comm_id;
+	thread->icomm    = &BLIS_SINGLE_COMM;
+	thread->icomm_id = 0;
+	thread->n_way    = comm->n_threads;
+	thread->work_id  = comm_id;
+
+	return thread;
+}
+
+
+void bli_packm_thrinfo_free( packm_thrinfo_t* thread )
+{
+	if ( thread != &BLIS_PACKM_SINGLE_THREADED )
+		bli_free( thread );
+}
+
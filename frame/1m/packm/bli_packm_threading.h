@@ -0,0 +1,56 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+// A packm thread info object describes the threads that cooperate in
+// packing a single object into a shared buffer: n_way is the number of
+// such threads, work_id is the id of this thread among them, and ocomm is
+// the communicator they use to synchronize once the object is packed.
+typedef thrinfo_t packm_thrinfo_t;
+
+// The thread info object used when an object is packed by a single thread.
+extern packm_thrinfo_t BLIS_PACKM_SINGLE_THREADED;
+
+packm_thrinfo_t* bli_packm_thrinfo_create( thread_comm_t* comm,
+                                           dim_t          comm_id );
+void             bli_packm_thrinfo_free( packm_thrinfo_t* thread );
+
+// Determine whether iteration it of a packing loop is assigned to the
+// calling thread. Iterations are assigned round-robin so that the work is
+// balanced even when the panels have different lengths (eg: triangular
+// matrices).
+#define bli_packm_my_iter( it, thread ) \
+\
+	( (it) % thread_n_way( thread ) == thread_work_id( thread ) )
+
@@ -56,7 +56,8 @@ static FUNCPTR_T GENARRAY(ftypes,packm_unb_var1);
 
 
 void bli_packm_unb_var1( obj_t*   c,
-                         obj_t*   p )
+                         obj_t*   p,
+                         packm_thrinfo_t* thread )
 {
 	num_t     dt_cp     = bli_obj_datatype( *c );
 
@@ -94,6 +95,9 @@ void bli_packm_unb_var1( obj_t*   c,
 	// during packing.
 	buf_kappa = bli_obj_buffer_for_const( dt_cp, BLIS_ONE );
 
+	// This variant is not parallelized; only the chief packs.
+	if ( !thread_am_ochief( thread ) ) return;
+
 	// Index into the type combination array to extract the correct
 	// function pointer.
 	f = ftypes[dt_cp];
@@ -33,7 +33,8 @@
 */
 
 void bli_packm_unb_var1( obj_t*   c,
-                         obj_t*   p );
+                         obj_t*   p,
+                         packm_thrinfo_t* thread );
 
 
 #undef  GENTPROT
@@ -62,38 +62,45 @@ void bli_gemm4m_cntl_init()
 	gemm4m_mc
 	=
 	bli_blksz_obj_create( 0, 0,  0, 0,
-	                      BLIS_DEFAULT_4M_MC_C, BLIS_EXTEND_4M_MC_C,
-	                      BLIS_DEFAULT_4M_MC_Z, BLIS_EXTEND_4M_MC_Z );
+	                      BLIS_RUNTIME_4M_MC_C, BLIS_EXTEND_4M_MC_C,
+	                      BLIS_RUNTIME_4M_MC_Z, BLIS_EXTEND_4M_MC_Z );
 
 	gemm4m_nc
 	=
 	bli_blksz_obj_create( 0, 0,  0, 0,
-	                      BLIS_DEFAULT_4M_NC_C, BLIS_EXTEND_4M_NC_C,
-	                      BLIS_DEFAULT_4M_NC_Z, BLIS_EXTEND_4M_NC_Z );
+	                      BLIS_RUNTIME_4M_NC_C, BLIS_EXTEND_4M_NC_C,
+	                      BLIS_RUNTIME_4M_NC_Z, BLIS_EXTEND_4M_NC_Z );
 
 	gemm4m_kc
 	=
 	bli_blksz_obj_create( 0, 0,  0, 0,
-	                      BLIS_DEFAULT_4M_KC_C, BLIS_EXTEND_4M_KC_C,
-	                      BLIS_DEFAULT_4M_KC_Z, BLIS_EXTEND_4M_KC_Z );
+	                      BLIS_RUNTIME_4M_KC_C, BLIS_EXTEND_4M_KC_C,
+	                      BLIS_RUNTIME_4M_KC_Z, BLIS_EXTEND_4M_KC_Z );
 
 	gemm4m_mr
 	=
 	bli_blksz_obj_create( 0, 0,  0, 0,
-	                      BLIS_DEFAULT_4M_MR_C, BLIS_EXTEND_4M_MR_C,
-	                      BLIS_DEFAULT_4M_MR_Z, BLIS_EXTEND_4M_MR_Z );
+	                      BLIS_RUNTIME_4M_MR_C, BLIS_EXTEND_4M_MR_C,
+	                      BLIS_RUNTIME_4M_MR_Z, BLIS_EXTEND_4M_MR_Z );
 
 	gemm4m_nr
 	=
 	bli_blksz_obj_create( 0, 0,  0, 0,
-	                      BLIS_DEFAULT_4M_NR_C, BLIS_EXTEND_4M_NR_C,
-	                      BLIS_DEFAULT_4M_NR_Z, BLIS_EXTEND_4M_NR_Z );
+	                      BLIS_RUNTIME_4M_NR_C, BLIS_EXTEND_4M_NR_C,
+	                      BLIS_RUNTIME_4M_NR_Z, BLIS_EXTEND_4M_NR_Z );
 
 	gemm4m_kr
 	=
 	bli_blksz_obj_create( 0, 0,  0, 0,
-	                      BLIS_DEFAULT_4M_KR_C, BLIS_EXTEND_4M_KR_C,
-	                      BLIS_DEFAULT_4M_KR_Z, BLIS_EXTEND_4M_KR_Z );
+	                      BLIS_RUNTIME_4M_KR_C, BLIS_EXTEND_4M_KR_C,
+	                      BLIS_RUNTIME_4M_KR_Z, BLIS_EXTEND_4M_KR_Z );
+
+	// Attach the register blksz_t objects as blocksize multiples to the
+	// cache blksz_t objects. This allows the blocked variants to partition
+	// their loops among threads in units of whole micro-panels.
+	bli_blksz_obj_attach_mult_to( gemm4m_mr, gemm4m_mc );
+	bli_blksz_obj_attach_mult_to( gemm4m_nr, gemm4m_nc );
+	bli_blksz_obj_attach_mult_to( gemm4m_kr, gemm4m_kc );
 
 
 
@@ -45,14 +45,18 @@ void bli_gemm( obj_t*  alpha,
                obj_t*  beta,
                obj_t*  c )
 {
-	if (
+	// Operands pre-packed by bli_gemm_pack_a() or bli_gemm_pack_b() are
+	// in the format of the conventional control tree, so they are never
+	// passed to the 4m implementation.
+	if ( bli_obj_pack_status( *a ) == BLIS_NOT_PACKED &&
+	     bli_obj_pack_status( *b ) == BLIS_NOT_PACKED && (
 #ifdef BLIS_ENABLE_SCOMPLEX_VIA_4M
 	     bli_obj_is_scomplex( *c ) ||
 #endif
 #ifdef BLIS_ENABLE_DCOMPLEX_VIA_4M
 	     bli_obj_is_dcomplex( *c ) ||
 #endif
-	     FALSE
+	     FALSE )
 	   )
 		return bli_gemm4m( alpha, a, b, beta, c );
 
@@ -33,6 +33,7 @@
 */
 
 #include "bli_gemm_cntl.h"
+#include "bli_gemm_threading.h"
 #include "bli_gemm_check.h"
 #include "bli_gemm_front.h"
 #include "bli_gemm_int.h"
@@ -44,6 +45,10 @@
 
 #include "bli_gemm_ker_var2.h"
 #include "bli_gemm_ker_var5.h"
+#include "bli_gemm_small.h"
+#include "bli_gemm_fast.h"
+#include "bli_gemm_pack.h"
+#include "bli_gemm_pack_file.h"
 
 #include "bli_gemm_ukr_ref.h"
 
@@ -110,6 +110,14 @@ void bli_gemm_check( obj_t*  alpha,
 
 	e_val = bli_check_general_object( b );
 	bli_check_error_code( e_val );
+
+	// Check that pre-packed operands (if any) were packed for their role.
+
+	e_val = bli_check_pack_schema_if_packed( BLIS_PACKED_ROW_PANELS, a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_pack_schema_if_packed( BLIS_PACKED_COL_PANELS, b );
+	bli_check_error_code( e_val );
 }
 
 void bli_gemm_int_check( obj_t*  alpha,
@@ -131,3 +139,22 @@ void bli_gemm_int_check( obj_t*  alpha,
 	bli_check_error_code( e_val );
 }
 
+void bli_gemm_pack_check( obj_t*  a )
+{
+	err_t e_val;
+
+	// Check object datatypes.
+
+	e_val = bli_check_floating_object( a );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_matrix_object( a );
+	bli_check_error_code( e_val );
+
+	// Check matrix structure.
+
+	e_val = bli_check_general_object( a );
+	bli_check_error_code( e_val );
+}
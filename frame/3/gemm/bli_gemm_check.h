@@ -51,3 +51,4 @@ void bli_gemm_int_check( obj_t*  alpha,
                          obj_t*  c,
                          gemm_t* cntl );
 
+void bli_gemm_pack_check( obj_t*  a );
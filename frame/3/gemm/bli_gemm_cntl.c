@@ -44,10 +44,14 @@ blksz_t*          gemm_nr;
 blksz_t*          gemm_kr;
 
 func_t*           gemm_ukrs;
+func_t*           gemm_edge_ukrs;
 
 packm_t*          gemm_packa_cntl;
 packm_t*          gemm_packb_cntl;
 
+packm_t*          gemm_prepacka_cntl;
+packm_t*          gemm_prepackb_cntl;
+
 gemm_t*           gemm_cntl_bp_ke;
 gemm_t*           gemm_cntl_op_bp;
 gemm_t*           gemm_cntl_mm_op;
@@ -59,35 +63,42 @@ gemm_t*           gemm_cntl;
 void bli_gemm_cntl_init()
 {
 	// Create blocksize objects for each dimension.
-	gemm_mc = bli_blksz_obj_create( BLIS_DEFAULT_MC_S, BLIS_EXTEND_MC_S,
-	                                BLIS_DEFAULT_MC_D, BLIS_EXTEND_MC_D,
-	                                BLIS_DEFAULT_MC_C, BLIS_EXTEND_MC_C,
-	                                BLIS_DEFAULT_MC_Z, BLIS_EXTEND_MC_Z );
-
-	gemm_nc = bli_blksz_obj_create( BLIS_DEFAULT_NC_S, BLIS_EXTEND_NC_S,
-	                                BLIS_DEFAULT_NC_D, BLIS_EXTEND_NC_D,
-	                                BLIS_DEFAULT_NC_C, BLIS_EXTEND_NC_C,
-	                                BLIS_DEFAULT_NC_Z, BLIS_EXTEND_NC_Z );
-
-	gemm_kc = bli_blksz_obj_create( BLIS_DEFAULT_KC_S, BLIS_EXTEND_KC_S,
-	                                BLIS_DEFAULT_KC_D, BLIS_EXTEND_KC_D,
-	                                BLIS_DEFAULT_KC_C, BLIS_EXTEND_KC_C,
-	                                BLIS_DEFAULT_KC_Z, BLIS_EXTEND_KC_Z );
-
-	gemm_mr = bli_blksz_obj_create( BLIS_DEFAULT_MR_S, BLIS_EXTEND_MR_S,
-	                                BLIS_DEFAULT_MR_D, BLIS_EXTEND_MR_D,
-	                                BLIS_DEFAULT_MR_C, BLIS_EXTEND_MR_C,
-	                                BLIS_DEFAULT_MR_Z, BLIS_EXTEND_MR_Z );
-
-	gemm_nr = bli_blksz_obj_create( BLIS_DEFAULT_NR_S, BLIS_EXTEND_NR_S,
-	                                BLIS_DEFAULT_NR_D, BLIS_EXTEND_NR_D,
-	                                BLIS_DEFAULT_NR_C, BLIS_EXTEND_NR_C,
-	                                BLIS_DEFAULT_NR_Z, BLIS_EXTEND_NR_Z );
-
-	gemm_kr = bli_blksz_obj_create( BLIS_DEFAULT_KR_S, 0,
-	                                BLIS_DEFAULT_KR_D, 0,
-	                                BLIS_DEFAULT_KR_C, 0,
-	                                BLIS_DEFAULT_KR_Z, 0 );
+	gemm_mc = bli_blksz_obj_create( BLIS_RUNTIME_MC_S, BLIS_EXTEND_MC_S,
+	                                BLIS_RUNTIME_MC_D, BLIS_EXTEND_MC_D,
+	                                BLIS_RUNTIME_MC_C, BLIS_EXTEND_MC_C,
+	                                BLIS_RUNTIME_MC_Z, BLIS_EXTEND_MC_Z );
+
+	gemm_nc = bli_blksz_obj_create( BLIS_RUNTIME_NC_S, BLIS_EXTEND_NC_S,
+	                                BLIS_RUNTIME_NC_D, BLIS_EXTEND_NC_D,
+	                                BLIS_RUNTIME_NC_C, BLIS_EXTEND_NC_C,
+	                                BLIS_RUNTIME_NC_Z, BLIS_EXTEND_NC_Z );
+
+	gemm_kc = bli_blksz_obj_create( BLIS_RUNTIME_KC_S, BLIS_EXTEND_KC_S,
+	                                BLIS_RUNTIME_KC_D, BLIS_EXTEND_KC_D,
+	                                BLIS_RUNTIME_KC_C, BLIS_EXTEND_KC_C,
+	                                BLIS_RUNTIME_KC_Z, BLIS_EXTEND_KC_Z );
+
+	gemm_mr = bli_blksz_obj_create( BLIS_RUNTIME_MR_S, BLIS_EXTEND_MR_S,
+	                                BLIS_RUNTIME_MR_D, BLIS_EXTEND_MR_D,
+	                                BLIS_RUNTIME_MR_C, BLIS_EXTEND_MR_C,
+	                                BLIS_RUNTIME_MR_Z, BLIS_EXTEND_MR_Z );
+
+	gemm_nr = bli_blksz_obj_create( BLIS_RUNTIME_NR_S, BLIS_EXTEND_NR_S,
+	                                BLIS_RUNTIME_NR_D, BLIS_EXTEND_NR_D,
+	                                BLIS_RUNTIME_NR_C, BLIS_EXTEND_NR_C,
+	                                BLIS_RUNTIME_NR_Z, BLIS_EXTEND_NR_Z );
+
+	gemm_kr = bli_blksz_obj_create( BLIS_RUNTIME_KR_S, 0,
+	                                BLIS_RUNTIME_KR_D, 0,
+	                                BLIS_RUNTIME_KR_C, 0,
+	                                BLIS_RUNTIME_KR_Z, 0 );
+
+	// Attach the register blksz_t objects as blocksize multiples to the
+	// cache blksz_t objects. This allows the blocked variants to partition
+	// their loops among threads in units of whole micro-panels.
+	bli_blksz_obj_attach_mult_to( gemm_mr, gemm_mc );
+	bli_blksz_obj_attach_mult_to( gemm_nr, gemm_nc );
+	bli_blksz_obj_attach_mult_to( gemm_kr, gemm_kc );
 
 	// Create function pointer object for each datatype-specific gemm
 	// micro-kernel.
@@ -96,6 +107,13 @@ void bli_gemm_cntl_init()
 	                                 BLIS_CGEMM_UKERNEL,
 	                                 BLIS_ZGEMM_UKERNEL );
 
+	// Create function pointer object for each datatype-specific gemm edge
+	// micro-kernel. Entries for datatypes without one are NULL.
+	gemm_edge_ukrs = bli_func_obj_create( BLIS_SGEMM_EDGE_UKERNEL_PTR,
+	                                      BLIS_DGEMM_EDGE_UKERNEL_PTR,
+	                                      BLIS_CGEMM_EDGE_UKERNEL_PTR,
+	                                      BLIS_ZGEMM_EDGE_UKERNEL_PTR );
+
 
 	// Create control tree objects for packm operations.
 	gemm_packa_cntl
@@ -124,6 +142,37 @@ void bli_gemm_cntl_init()
 	                           BLIS_PACKED_COL_PANELS,
 	                           BLIS_BUFFER_FOR_B_PANEL );
 
+	// Create control tree objects for packing A and B ahead of time (see
+	// bli_gemm_pack_a() and bli_gemm_pack_b()). These produce the same
+	// formats as the packm nodes above, but into general-purpose memory
+	// that outlives the gemm call, since a pre-packed operand is not
+	// bounded by the cache blocksizes that size the contiguous pools.
+	gemm_prepacka_cntl
+	=
+	bli_packm_cntl_obj_create( BLIS_BLOCKED,
+	                           BLIS_VARIANT1,
+	                           gemm_mr,
+	                           gemm_kr,
+	                           TRUE,  // densify
+	                           FALSE, // do NOT invert diagonal
+	                           FALSE, // reverse iteration if upper?
+	                           FALSE, // reverse iteration if lower?
+	                           BLIS_PACKED_ROW_PANELS,
+	                           BLIS_BUFFER_FOR_GEN_USE );
+
+	gemm_prepackb_cntl
+	=
+	bli_packm_cntl_obj_create( BLIS_BLOCKED,
+	                           BLIS_VARIANT1,
+	                           gemm_kr,
+	                           gemm_nr,
+	                           TRUE,  // densify
+	                           FALSE, // do NOT invert diagonal
+	                           FALSE, // reverse iteration if upper?
+	                           FALSE, // reverse iteration if lower?
+	                           BLIS_PACKED_COL_PANELS,
+	                           BLIS_BUFFER_FOR_GEN_USE );
+
 
 	//
 	// Create a control tree for packing A and B, and streaming C.
@@ -187,7 +236,9 @@ void bli_gemm_cntl_init()
 	// Alias the "master" gemm control tree to a shorter name.
 	gemm_cntl = gemm_cntl_vl_mm;
 
-	//bli_gemm_cntl_init_exp();
+	// Create the control tree that packs A but streams B (used by
+	// bli_gemm_front() when B is skinny).
+	bli_gemm_cntl_init_exp();
 }
 
 void bli_gemm_cntl_finalize()
@@ -200,16 +251,20 @@ void bli_gemm_cntl_finalize()
 	bli_blksz_obj_free( gemm_kr );
 
 	bli_func_obj_free( gemm_ukrs );
+	bli_func_obj_free( gemm_edge_ukrs );
 
 	bli_cntl_obj_free( gemm_packa_cntl );
 	bli_cntl_obj_free( gemm_packb_cntl );
 
+	bli_cntl_obj_free( gemm_prepacka_cntl );
+	bli_cntl_obj_free( gemm_prepackb_cntl );
+
 	bli_cntl_obj_free( gemm_cntl_bp_ke );
 	bli_cntl_obj_free( gemm_cntl_op_bp );
 	bli_cntl_obj_free( gemm_cntl_mm_op );
 	bli_cntl_obj_free( gemm_cntl_vl_mm );
 
-	//bli_gemm_cntl_finalize_exp();
+	bli_gemm_cntl_finalize_exp();
 }
 
 gemm_t* bli_gemm_cntl_obj_create( impl_t     impl_type,
@@ -241,3 +296,13 @@ gemm_t* bli_gemm_cntl_obj_create( impl_t     impl_type,
 	return cntl;
 }
 
+void* bli_gemm_edge_ukr_query( num_t dt, func_t* gemm_ukrs_ )
+{
+	// An edge micro-kernel is only valid in place of the micro-kernel it
+	// was paired with in bli_kernel.h, so we return NULL for any other set
+	// of micro-kernels (such as those used to induce complex computation
+	// via 4m or 3m).
+	if ( gemm_ukrs_ != gemm_ukrs ) return NULL;
+
+	return bli_func_obj_query( dt, gemm_edge_ukrs );
+}
@@ -65,3 +65,6 @@ gemm_t* bli_gemm_cntl_obj_create( impl_t       impl_type,
                                   gemm_t*      sub_gemm,
                                   unpackm_t*   sub_unpack_c );
 
+void*   bli_gemm_edge_ukr_query( num_t        dt,
+                                 func_t*      gemm_ukrs );
+
@@ -0,0 +1,287 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+extern func_t*  gemm_ukrs;
+
+#ifdef BLIS_ENABLE_SCOMPLEX_VIA_4M
+  #define GEMM_FAST_SCOMPLEX_VIA_4M TRUE
+#else
+  #define GEMM_FAST_SCOMPLEX_VIA_4M FALSE
+#endif
+
+#ifdef BLIS_ENABLE_DCOMPLEX_VIA_4M
+  #define GEMM_FAST_DCOMPLEX_VIA_4M TRUE
+#else
+  #define GEMM_FAST_DCOMPLEX_VIA_4M FALSE
+#endif
+
+//
+// Define low-overhead BLAS-like interfaces with homogeneous-typed operands.
+//
+// The loop structure, blocksizes, and micro-kernels are those of the
+// default gemm control tree (blk_var2f -> blk_var3f -> blk_var1f ->
+// ker_var2), so the result is the same as that of bli_?gemm(). When
+// multithreading is requested, when complex gemm is configured to be
+// computed via the 4m method, or when B is skinny enough to be streamed
+// rather than packed, we defer to bli_?gemm().
+//
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname)( \
+                          trans_t transa, \
+                          trans_t transb, \
+                          dim_t   m, \
+                          dim_t   n, \
+                          dim_t   k, \
+                          ctype*  alpha, \
+                          ctype*  a, inc_t rs_a, inc_t cs_a, \
+                          ctype*  b, inc_t rs_b, inc_t cs_b, \
+                          ctype*  beta, \
+                          ctype*  c, inc_t rs_c, inc_t cs_c  \
+                        ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	/* Alias some constants to simpler names. */ \
+	const dim_t     MR         = PASTEMAC(ch,mr); \
+	const dim_t     NR         = PASTEMAC(ch,nr); \
+	const dim_t     KR         = PASTEMAC(ch,kr); \
+	const dim_t     PACKMR     = PASTEMAC(ch,packmr); \
+	const dim_t     PACKNR     = PASTEMAC(ch,packnr); \
+	const dim_t     MC         = PASTEMAC(ch,mc); \
+	const dim_t     KC         = PASTEMAC(ch,kc); \
+	const dim_t     NC         = PASTEMAC(ch,nc); \
+	const dim_t     MAXMC      = PASTEMAC(ch,maxmc); \
+	const dim_t     MAXKC      = PASTEMAC(ch,maxkc); \
+	const dim_t     MAXNC      = PASTEMAC(ch,maxnc); \
+\
+	ctype* restrict one        = PASTEMAC(ch,1); \
+	ctype*          beta_use; \
+	ctype* restrict ap; \
+	ctype* restrict bp; \
+	ctype*          p1; \
+\
+	conj_t          conja, conjb; \
+	dim_t           ii, jj, pp, i, j; \
+	dim_t           mc_cur, nc_cur, kc_cur; \
+	dim_t           mc_max, nc_max, kc_max; \
+	dim_t           m_cur, n_cur; \
+	inc_t           ps_a, ps_b; \
+	mem_t           mem_a; \
+	mem_t           mem_b; \
+	void*           gemm_ukr; \
+	void*           gemm_edge_ukr; \
+	bool_t          stream_b; \
+\
+	/* If C has a zero dimension, return early. */ \
+	if ( bli_zero_dim2( m, n ) ) return; \
+\
+	/* Determine whether bli_gemm_front() would compute the operation
+	   with the control tree that streams B (see
+	   bli_gemm_stream_b_applies()). The test is applied after the
+	   operation is transposed for a row-stored C, in which case the
+	   roles of m and A are played by n and B. The small-matrix path
+	   takes precedence, as it does there. */ \
+	if ( bli_is_row_stored( rs_c, cs_c ) ) \
+		stream_b = ( m <= BLIS_GEMM_STREAM_B_N_THRESH && \
+		             ( bli_is_row_stored( rs_a, cs_a ) || \
+		               bli_is_col_stored( rs_a, cs_a ) ) ); \
+	else \
+		stream_b = ( n <= BLIS_GEMM_STREAM_B_N_THRESH && \
+		             ( bli_is_row_stored( rs_b, cs_b ) || \
+		               bli_is_col_stored( rs_b, cs_b ) ) ); \
+\
+	if ( m <= BLIS_GEMM_SMALL_M_THRESH && \
+	     n <= BLIS_GEMM_SMALL_N_THRESH && \
+	     k <= BLIS_GEMM_SMALL_K_THRESH ) stream_b = FALSE; \
+\
+	/* Defer to the object-based implementation for the cases it handles
+	   differently from the single-threaded native algorithm below. */ \
+	if ( bli_thread_get_num_threads() > 1 || \
+	     stream_b || \
+	     ( bli_is_scomplex( dt ) && GEMM_FAST_SCOMPLEX_VIA_4M ) || \
+	     ( bli_is_dcomplex( dt ) && GEMM_FAST_DCOMPLEX_VIA_4M ) ) \
+	{ \
+		PASTEMAC(ch,gemm)( transa, transb, m, n, k, \
+		                   alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+		                   beta, c, rs_c, cs_c ); \
+		return; \
+	} \
+\
+	/* If A or B has a zero dimension, or if alpha is zero, scale C by
+	   beta and return early. */ \
+	if ( k == 0 || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		PASTEMAC(ch,scalm)( BLIS_NO_CONJUGATE, 0, BLIS_DENSE, \
+		                    m, n, beta, c, rs_c, cs_c ); \
+		return; \
+	} \
+\
+	/* Apply any transpositions of A and B by swapping their strides. */ \
+	conja = bli_extract_conj( transa ); \
+	conjb = bli_extract_conj( transb ); \
+	if ( bli_does_trans( transa ) ) bli_swap_incs( rs_a, cs_a ); \
+	if ( bli_does_trans( transb ) ) bli_swap_incs( rs_b, cs_b ); \
+\
+	/* Query the gemm micro-kernel, and its edge micro-kernel if any, for
+	   the current datatype. */ \
+	gemm_ukr      = bli_func_obj_query( dt, gemm_ukrs ); \
+	gemm_edge_ukr = bli_gemm_edge_ukr_query( dt, gemm_ukrs ); \
+\
+	/* Small problems are computed on operands packed to the stack. */ \
+	if ( m <= BLIS_GEMM_SMALL_M_THRESH && \
+	     n <= BLIS_GEMM_SMALL_N_THRESH && \
+	     k <= BLIS_GEMM_SMALL_K_THRESH ) \
+	{ \
+		PASTEMAC(ch,gemm_small)( conja, conjb, m, n, k, \
+		                         alpha, a, rs_a, cs_a, b, rs_b, cs_b, \
+		                         beta, c, rs_c, cs_c, \
+		                         gemm_ukr ); \
+		return; \
+	} \
+\
+	/* If C is row-stored, transpose the entire operation, as is done in
+	   bli_gemm_front(). */ \
+	if ( bli_is_row_stored( rs_c, cs_c ) ) \
+	{ \
+		ctype* t_buf  = a; \
+		conj_t t_conj = conja; \
+\
+		a     = b;     b     = t_buf; \
+		conja = conjb; conjb = t_conj; \
+\
+		bli_swap_incs( rs_a, cs_b ); \
+		bli_swap_incs( cs_a, rs_b ); \
+		bli_swap_incs( rs_c, cs_c ); \
+		bli_swap_dims( m, n ); \
+	} \
+\
+	/* Determine the largest blocks that the loops below will encounter
+	   (see bli_determine_blocksize_f()) and acquire packing buffers for
+	   them from the memory allocator. */ \
+	mc_max = ( m <= MAXMC ? m : MAXMC ); \
+	nc_max = ( n <= MAXNC ? n : MAXNC ); \
+	kc_max = ( k <= MAXKC ? k : MAXKC ); \
+\
+	bli_mem_acquire_m( ( bli_align_dim_to_mult( mc_max, MR ) / MR ) * PACKMR * \
+	                   bli_align_dim_to_mult( kc_max, KR ) * sizeof( ctype ), \
+	                   BLIS_BUFFER_FOR_A_BLOCK, &mem_a ); \
+	bli_mem_acquire_m( ( bli_align_dim_to_mult( nc_max, NR ) / NR ) * PACKNR * \
+	                   bli_align_dim_to_mult( kc_max, KR ) * sizeof( ctype ), \
+	                   BLIS_BUFFER_FOR_B_PANEL, &mem_b ); \
+\
+	ap = bli_mem_buffer( &mem_a ); \
+	bp = bli_mem_buffer( &mem_b ); \
+\
+	/* Partition C and B into column panels (blk_var2f). */ \
+	for ( jj = 0; jj < n; jj += nc_cur ) \
+	{ \
+		nc_cur = ( n - jj <= MAXNC ? n - jj : NC ); \
+\
+		/* Partition the k dimension into rank-kc updates (blk_var3f).
+		   Beta is applied only by the first update. */ \
+		for ( pp = 0; pp < k; pp += kc_cur ) \
+		{ \
+			kc_cur   = ( k - pp <= MAXKC ? k - pp : KC ); \
+			beta_use = ( pp == 0 ? beta : one ); \
+\
+			ps_a = PACKMR * bli_align_dim_to_mult( kc_cur, KR ); \
+			ps_b = PACKNR * bli_align_dim_to_mult( kc_cur, KR ); \
+\
+			/* Pack the current panel of B to column micro-panels. */ \
+			for ( j = 0; j * NR < nc_cur; ++j ) \
+			{ \
+				n_cur = bli_min( NR, nc_cur - j * NR ); \
+				p1    = bp + j * ps_b; \
+\
+				PASTEMAC(ch,packm_cxk)( conjb, \
+				                        n_cur, \
+				                        kc_cur, \
+				                        one, \
+				                        b + pp * rs_b + ( jj + j * NR ) * cs_b, cs_b, rs_b, \
+				                        p1,                                     PACKNR ); \
+\
+				if ( n_cur < PACKNR ) \
+					PASTEMAC(ch,set0s_mxn)( PACKNR - n_cur, kc_cur, \
+					                        p1 + n_cur, 1, PACKNR ); \
+			} \
+\
+			/* Partition A and C into row blocks (blk_var1f). */ \
+			for ( ii = 0; ii < m; ii += mc_cur ) \
+			{ \
+				mc_cur = ( m - ii <= MAXMC ? m - ii : MC ); \
+\
+				/* Pack the current block of A to row micro-panels. */ \
+				for ( i = 0; i * MR < mc_cur; ++i ) \
+				{ \
+					m_cur = bli_min( MR, mc_cur - i * MR ); \
+					p1    = ap + i * ps_a; \
+\
+					PASTEMAC(ch,packm_cxk)( conja, \
+					                        m_cur, \
+					                        kc_cur, \
+					                        one, \
+					                        a + ( ii + i * MR ) * rs_a + pp * cs_a, rs_a, cs_a, \
+					                        p1,                                     PACKMR ); \
+\
+					if ( m_cur < PACKMR ) \
+						PASTEMAC(ch,set0s_mxn)( PACKMR - m_cur, kc_cur, \
+						                        p1 + m_cur, 1, PACKMR ); \
+				} \
+\
+				/* Invoke the macro-kernel. */ \
+				PASTEMAC(ch,gemm_ker_var2)( mc_cur, \
+				                            nc_cur, \
+				                            kc_cur, \
+				                            alpha, \
+				                            ap, PACKMR, MR, ps_a, \
+				                            bp, PACKNR, NR, ps_b, \
+				                            beta_use, \
+				                            c + ii * rs_c + jj * cs_c, rs_c, cs_c, \
+				                            gemm_ukr, \
+				                            gemm_edge_ukr, \
+				                            &BLIS_GEMM_SINGLE_THREADED ); \
+			} \
+		} \
+	} \
+\
+	bli_mem_release( &mem_b ); \
+	bli_mem_release( &mem_a ); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_fast )
+
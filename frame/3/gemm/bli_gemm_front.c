@@ -34,6 +34,9 @@
 
 #include "blis.h"
 
+extern gemm_t*  gemm_cntl;
+extern gemm_t*  gemm_cntl5;
+
 void bli_gemm_front( obj_t*  alpha,
                      obj_t*  a,
                      obj_t*  b,
@@ -45,6 +48,9 @@ void bli_gemm_front( obj_t*  alpha,
 	obj_t   b_local;
 	obj_t   c_local;
 
+	gemm_thrinfo_t** infos;
+	dim_t            n_threads;
+
 	// Check parameters.
 	if ( bli_error_checking_is_enabled() )
 		bli_gemm_check( alpha, a, b, beta, c );
@@ -56,6 +62,17 @@ void bli_gemm_front( obj_t*  alpha,
 		return;
 	}
 
+	// If the problem is small, the cost of walking the control tree and
+	// packing to blocks acquired from the memory allocator would dominate
+	// the arithmetic. Instead, compute it directly with the micro-kernel
+	// on operands packed to the stack. (This path uses the conventional
+	// micro-kernels, and so it only applies to the default control tree.)
+	if ( cntl == gemm_cntl && bli_gemm_small_applies( a, b, c ) )
+	{
+		bli_gemm_small( alpha, a, b, beta, c );
+		return;
+	}
+
 	// Alias A, B, and C in case we need to apply transformations.
 	bli_obj_alias_to( *a, a_local );
 	bli_obj_alias_to( *b, b_local );
@@ -65,7 +82,11 @@ void bli_gemm_front( obj_t*  alpha,
 	// so as to allow the macro-kernel more favorable access patterns
 	// through C. (The effect of the transposition of A and B is negligible
 	// because those operands are always packed to contiguous memory.)
-	if ( bli_obj_is_row_stored( *c ) )
+	// This is skipped when A or B was pre-packed, since a packed operand
+	// is laid out for its own side of the operation.
+	if ( bli_obj_is_row_stored( *c ) &&
+	     !bli_obj_is_panel_packed( *a ) &&
+	     !bli_obj_is_panel_packed( *b ) )
 	{
 		bli_obj_swap( a_local, b_local );
 
@@ -74,12 +95,49 @@ void bli_gemm_front( obj_t*  alpha,
 		bli_obj_induce_trans( c_local );
 	}
 
-	// Invoke the internal back-end.
-	bli_gemm_int( alpha,
-	              &a_local,
-	              &b_local,
-	              beta,
-	              &c_local,
-	              cntl );
+	// If B is skinny, use the control tree that streams B rather than
+	// packing it. (As with the small-matrix path, this only applies to
+	// the default control tree.)
+	if ( cntl == gemm_cntl &&
+	     bli_gemm_stream_b_applies( &a_local, &b_local, &c_local ) )
+		cntl = gemm_cntl5;
+
+	// Create one path of thread info objects per thread, one node per
+	// level of the gemm control tree.
+	if ( cntl == gemm_cntl5 ) infos = bli_gemm_thrinfo_create_paths_var5();
+	else                      infos = bli_gemm_thrinfo_create_paths();
+	n_threads = thread_num_threads( infos[0] );
+
+	// Invoke the internal back-end via the thread decorator.
+	bli_level3_thread_decorator( n_threads,
+	                             ( level3_int_t ) bli_gemm_int,
+	                             alpha,
+	                             &a_local,
+	                             &b_local,
+	                             beta,
+	                             &c_local,
+	                             ( void* ) cntl,
+	                             ( void** ) infos );
+
+	// Free the thread info objects.
+	bli_gemm_thrinfo_free_paths( infos, n_threads );
 }
 
+bool_t bli_gemm_stream_b_applies( obj_t*  a,
+                                  obj_t*  b,
+                                  obj_t*  c )
+{
+	dim_t n = bli_obj_width( *c );
+
+	// B must be unpacked, and stored with unit stride in one dimension
+	// so that its micro-panels can be packed efficiently as they are
+	// needed.
+	if ( bli_obj_pack_status( *b ) != BLIS_NOT_PACKED ) return FALSE;
+
+	if ( !bli_obj_is_row_stored( *b ) &&
+	     !bli_obj_is_col_stored( *b ) ) return FALSE;
+
+	if ( n < 1 || n > BLIS_GEMM_STREAM_B_N_THRESH ) return FALSE;
+
+	return TRUE;
+}
@@ -32,6 +32,17 @@
 
 */
 
+// Problems whose n dimension does not exceed this threshold (after any
+// transposition of the operation to favor the storage of C) are computed
+// by the control tree that packs A and streams micro-panels of B directly
+// from their original storage (see bli_gemm_ker_var5()), since packing B
+// to a shared contiguous panel does not pay for itself when B is skinny.
+// A threshold of zero disables this path.
+
+#ifndef BLIS_GEMM_STREAM_B_N_THRESH
+#define BLIS_GEMM_STREAM_B_N_THRESH  4
+#endif
+
 void bli_gemm_front( obj_t*  alpha,
                      obj_t*  a,
                      obj_t*  b,
@@ -39,3 +50,6 @@ void bli_gemm_front( obj_t*  alpha,
                      obj_t*  c,
                      gemm_t* cntl );
 
+bool_t bli_gemm_stream_b_applies( obj_t*  a,
+                                  obj_t*  b,
+                                  obj_t*  c );
@@ -36,10 +36,11 @@
 
 #define FUNCPTR_T gemm_fp
 
-typedef void (*FUNCPTR_T)( obj_t*  a,
-                           obj_t*  b,
-                           obj_t*  c,
-                           gemm_t* cntl );
+typedef void (*FUNCPTR_T)( obj_t*          a,
+                           obj_t*          b,
+                           obj_t*          c,
+                           gemm_t*         cntl,
+                           gemm_thrinfo_t* thread );
 
 static FUNCPTR_T vars[6][3] =
 {
@@ -52,12 +53,13 @@ static FUNCPTR_T vars[6][3] =
     { NULL,               NULL,                 NULL               }
 };
 
-void bli_gemm_int( obj_t*  alpha,
-                   obj_t*  a,
-                   obj_t*  b,
-                   obj_t*  beta,
-                   obj_t*  c,
-                   gemm_t* cntl )
+void bli_gemm_int( obj_t*          alpha,
+                   obj_t*          a,
+                   obj_t*          b,
+                   obj_t*          beta,
+                   obj_t*          c,
+                   gemm_t*         cntl,
+                   gemm_thrinfo_t* thread )
 {
 	obj_t     a_local;
 	obj_t     b_local;
@@ -74,10 +76,13 @@ void bli_gemm_int( obj_t*  alpha,
 	if ( bli_obj_has_zero_dim( *c ) ) return;
 
 	// If A or B has a zero dimension, scale C by beta and return early.
+	// Only one of the threads that share C may scale it.
 	if ( bli_obj_has_zero_dim( *a ) ||
 	     bli_obj_has_zero_dim( *b ) )
 	{
-		bli_scalm( beta, c );
+		if ( thread_am_ochief( thread ) )
+			bli_scalm( beta, c );
+		thread_obarrier( thread );
 		return;
 	}
 
@@ -86,7 +91,9 @@ void bli_gemm_int( obj_t*  alpha,
 	if ( bli_obj_is_zeros( *a ) ||
 	     bli_obj_is_zeros( *b ) )
 	{
-		bli_scalm( beta, c );
+		if ( thread_am_ochief( thread ) )
+			bli_scalm( beta, c );
+		thread_obarrier( thread );
 		return;
 	}
 
@@ -133,6 +140,7 @@ void bli_gemm_int( obj_t*  alpha,
 	f( &a_local,
 	   &b_local,
 	   &c_local,
-	   cntl );
+	   cntl,
+	   thread );
 }
 
@@ -32,10 +32,11 @@
 
 */
 
-void bli_gemm_int( obj_t*  alpha,
-                   obj_t*  a,
-                   obj_t*  b,
-                   obj_t*  beta,
-                   obj_t*  c,
-                   gemm_t* cntl );
+void bli_gemm_int( obj_t*          alpha,
+                   obj_t*          a,
+                   obj_t*          b,
+                   obj_t*          beta,
+                   obj_t*          c,
+                   gemm_t*         cntl,
+                   gemm_thrinfo_t* thread );
 
@@ -32,32 +32,39 @@
 
 */
 
+
 #include "blis.h"
 
 #define FUNCPTR_T gemm_fp
 
 typedef void (*FUNCPTR_T)(
+                           conj_t  conjb,
                            dim_t   m,
                            dim_t   n,
                            dim_t   k,
                            void*   alpha,
                            void*   a, inc_t cs_a, inc_t pd_a, inc_t ps_a,
-                           void*   b, inc_t rs_b, inc_t pd_b, inc_t ps_b,
+                           void*   b, inc_t rs_b, inc_t cs_b,
                            void*   beta,
                            void*   c, inc_t rs_c, inc_t cs_c,
-                           void*   gemm_ukr
+                           void*   gemm_ukr,
+                           void*   gemm_edge_ukr,
+                           gemm_thrinfo_t* thread
                          );
 
 static FUNCPTR_T GENARRAY(ftypes,gemm_ker_var5);
 
 
-void bli_gemm_ker_var5( obj_t*  a,
-                        obj_t*  b,
-                        obj_t*  c,
-                        gemm_t* cntl )
+void bli_gemm_ker_var5( obj_t*          a,
+                        obj_t*          b,
+                        obj_t*          c,
+                        gemm_t*         cntl,
+                        gemm_thrinfo_t* thread )
 {
 	num_t     dt_exec   = bli_obj_execution_datatype( *c );
 
+	conj_t    conjb     = bli_obj_conj_status( *b );
+
 	dim_t     m         = bli_obj_length( *c );
 	dim_t     n         = bli_obj_width( *c );
 	dim_t     k         = bli_obj_width( *a );
@@ -69,8 +76,7 @@ void bli_gemm_ker_var5( obj_t*  a,
 
 	void*     buf_b     = bli_obj_buffer_at_off( *b );
 	inc_t     rs_b      = bli_obj_row_stride( *b );
-	inc_t     pd_b      = bli_obj_panel_dim( *b );
-	inc_t     ps_b      = bli_obj_panel_stride( *b );
+	inc_t     cs_b      = bli_obj_col_stride( *b );
 
 	void*     buf_c     = bli_obj_buffer_at_off( *c );
 	inc_t     rs_c      = bli_obj_row_stride( *c );
@@ -86,7 +92,13 @@ void bli_gemm_ker_var5( obj_t*  a,
 
 	func_t*   gemm_ukrs;
 	void*     gemm_ukr;
+	void*     gemm_edge_ukr;
+
 
+	// B is not packed by the time it reaches this variant, so apply any
+	// transposition by swapping its strides. (Any conjugation is applied
+	// when its micro-panels are packed below.)
+	if ( bli_obj_has_trans( *b ) ) bli_swap_incs( rs_b, cs_b );
 
 	// Detach and multiply the scalars attached to A and B.
 	bli_obj_scalar_detach( a, &scalar_a );
@@ -108,16 +120,23 @@ void bli_gemm_ker_var5( obj_t*  a,
 	gemm_ukrs = cntl_gemm_ukrs( cntl );
 	gemm_ukr  = bli_func_obj_query( dt_exec, gemm_ukrs );
 
+	// Query the edge micro-kernel, if any, that accompanies the gemm
+	// micro-kernel.
+	gemm_edge_ukr = bli_gemm_edge_ukr_query( dt_exec, gemm_ukrs );
+
 	// Invoke the function.
-	f( m,
+	f( conjb,
+	   m,
 	   n,
 	   k,
 	   buf_alpha,
 	   buf_a, cs_a, pd_a, ps_a,
-	   buf_b, rs_b, pd_b, ps_b,
+	   buf_b, rs_b, cs_b,
 	   buf_beta,
 	   buf_c, rs_c, cs_c,
-	   gemm_ukr );
+	   gemm_ukr,
+	   gemm_edge_ukr,
+	   thread );
 }
 
 
@@ -125,26 +144,28 @@ void bli_gemm_ker_var5( obj_t*  a,
 #define GENTFUNC( ctype, ch, varname, ukrtype ) \
 \
 void PASTEMAC(ch,varname)( \
+                           conj_t  conjb, \
                            dim_t   m, \
                            dim_t   n, \
                            dim_t   k, \
                            void*   alpha, \
                            void*   a, inc_t cs_a, inc_t pd_a, inc_t ps_a, \
-                           void*   b, inc_t rs_b, inc_t pd_b, inc_t ps_b, \
+                           void*   b, inc_t rs_b, inc_t cs_b, \
                            void*   beta, \
                            void*   c, inc_t rs_c, inc_t cs_c, \
-                           void*   gemm_ukr  \
+                           void*   gemm_ukr, \
+                           void*   gemm_edge_ukr, \
+                           gemm_thrinfo_t* thread  \
                          ) \
 { \
 	/* Cast the micro-kernel address to its function pointer type. */ \
 	PASTECH(ch,ukrtype) gemm_ukr_cast = gemm_ukr; \
+	PASTECH(ch,gemm_edge_ukr_t) gemm_edge_ukr_cast = gemm_edge_ukr; \
 \
-	/* Temporary buffer for incremental packing of B. */ \
+	/* Temporary buffer for incremental packing of B. (No configuration
+	   extends NR, so the maximum NR also bounds PACKNR.) */ \
 	ctype           bp[ PASTEMAC(ch,maxkc) * \
-	/* !!!! NOTE: This packnr actually needs to be something like maxpacknr
-	   if it is to be guaranteed to work in all situations !!!! The right
-	   place to define maxpackmr/nr would be in bli_kernel_post_macro_defs.h */ \
-	                    PASTEMAC(ch,packnr) ] \
+	                    PASTEMAC(ch,maxnr) ] \
 	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
 \
 	/* Temporary C buffer for edge cases. */ \
@@ -156,8 +177,8 @@ void PASTEMAC(ch,varname)( \
 \
 	/* Alias some constants to simpler names. */ \
 	const dim_t     MR         = pd_a; \
-	const dim_t     NR         = pd_b; \
-	const dim_t     PACKNR     = rs_b; \
+	const dim_t     NR         = PASTEMAC(ch,nr); \
+	const dim_t     PACKNR     = PASTEMAC(ch,packnr); \
 \
 	ctype* restrict one        = PASTEMAC(ch,1); \
 	ctype* restrict zero       = PASTEMAC(ch,0); \
@@ -168,11 +189,12 @@ void PASTEMAC(ch,varname)( \
 	ctype* restrict beta_cast  = beta; \
 	ctype* restrict b1; \
 	ctype* restrict c1; \
-	ctype* restrict b2; \
 \
 	dim_t           m_iter, m_left; \
 	dim_t           n_iter, n_left; \
 	dim_t           i, j; \
+	dim_t           jr_num_threads, jr_thread_id; \
+	dim_t           ir_num_threads, ir_thread_id; \
 	dim_t           m_cur; \
 	dim_t           n_cur; \
 	inc_t           rstep_a; \
@@ -186,10 +208,8 @@ void PASTEMAC(ch,varname)( \
 	     cs_a == PACKMR
 	     pd_a == MR
 	     ps_a == stride to next micro-panel of A
-	     rs_b == PACKNR
-	     cs_b == 1
-	     pd_b == NR
-	     ps_b == stride to next micro-panel of B
+	     rs_b == (no assumptions)
+	     cs_b == (no assumptions)
 	     rs_c == (no assumptions)
 	     cs_c == (no assumptions)
 	*/ \
@@ -215,56 +235,68 @@ void PASTEMAC(ch,varname)( \
 	/* Determine some increments used to step through A, B, and C. */ \
 	rstep_a = ps_a; \
 \
-	cstep_b = ps_b; \
+	cstep_b = cs_b * NR; \
 \
 	rstep_c = rs_c * MR; \
 	cstep_c = cs_c * NR; \
 \
-	/* Save the panel strides of A and B to the auxinfo_t object. */ \
+	/* Save the panel strides of A and of the micro-panel of B (which is
+	   packed to bp) to the auxinfo_t object. */ \
 	bli_auxinfo_set_ps_a( ps_a, aux ); \
-	bli_auxinfo_set_ps_b( ps_b, aux ); \
+	bli_auxinfo_set_ps_b( k * PACKNR, aux ); \
 \
-	b1 = b_cast; \
-	c1 = c_cast; \
+	/* Query the number of threads and thread ids for the jr and ir
+	   loops. Each thread packs the micro-panels of B that it needs into
+	   its own buffer, so the iterations of both loops are independent. */ \
+	jr_num_threads = thread_n_way( thread ); \
+	jr_thread_id   = thread_work_id( thread ); \
+	ir_num_threads = thread_n_way( gemm_thread_sub_gemm( thread ) ); \
+	ir_thread_id   = thread_work_id( gemm_thread_sub_gemm( thread ) ); \
 \
-	/* Since we pack micro-panels of B incrementaly, one at a time, the
+	/* Since we pack micro-panels of B incrementally, one at a time, the
 	   address of the next micro-panel of B remains constant. */ \
-	b2 = bp; \
-\
-	/* Save address of next panel of B to the auxinfo_t object. */ \
-	bli_auxinfo_set_next_b( b2, aux ); \
+	bli_auxinfo_set_next_b( bp, aux ); \
 \
 	/* Loop over the n dimension (NR columns at a time). */ \
-	for ( j = 0; j < n_iter; ++j ) \
+	for ( j = jr_thread_id; j < n_iter; j += jr_num_threads ) \
 	{ \
 		ctype* restrict a1; \
 		ctype* restrict c11; \
 \
-		a1  = a_cast; \
-		c11 = c1; \
+		b1 = b_cast + j * cstep_b; \
+		c1 = c_cast + j * cstep_c; \
 \
 		n_cur = ( bli_is_not_edge_f( j, n_iter, n_left ) ? NR : n_left ); \
 \
-		/* Incrementally pack a single micro-panel of B. */ \
-		PASTEMAC(ch,packm_cxk)( BLIS_NO_CONJUGATE, \
+		/* Incrementally pack a single micro-panel of B. At the edge, zero
+		   the rows of the micro-panel beyond n_cur so that the micro-kernel
+		   only ever computes with finite values. */ \
+		PASTEMAC(ch,packm_cxk)( conjb, \
 		                        n_cur, \
 		                        k, \
 		                        one, \
-		                        b1, 1, rs_b, \
-		                        bp,    PACKNR ); \
+		                        b1, cs_b, rs_b, \
+		                        bp,       PACKNR ); \
+\
+		if ( n_cur < NR ) \
+			PASTEMAC(ch,set0s_mxn)( NR - n_cur, k, \
+			                        bp + n_cur, 1, PACKNR ); \
+\
+		a1  = a_cast + ir_thread_id * rstep_a; \
+		c11 = c1     + ir_thread_id * rstep_c; \
 \
 		/* Loop over the m dimension (MR rows at a time). */ \
-		for ( i = 0; i < m_iter; ++i ) \
+		for ( i = ir_thread_id; i < m_iter; i += ir_num_threads ) \
 		{ \
 			ctype* restrict a2; \
 \
 			m_cur = ( bli_is_not_edge_f( i, m_iter, m_left ) ? MR : m_left ); \
 \
-			/* Compute the addresses of the next panels of A and B. */ \
-			a2 = a1 + rstep_a; \
-			if ( bli_is_last_iter( i, m_iter ) ) \
+			/* Compute the address of the next panel of A. */ \
+			a2 = a1 + ir_num_threads * rstep_a; \
+			if ( bli_is_last_iter_rr( i, m_iter, ir_thread_id, ir_num_threads ) ) \
 			{ \
-				a2 = a_cast; \
+				a2 = a_cast + ir_thread_id * rstep_a; \
 			} \
 \
 			/* Save address of next panel of A to the auxinfo_t object. */ \
@@ -282,6 +314,20 @@ void PASTEMAC(ch,varname)( \
 				               c11, rs_c, cs_c, \
 				               &aux ); \
 			} \
+			else if ( gemm_edge_ukr_cast != NULL ) \
+			{ \
+				/* Invoke the edge micro-kernel, which updates only the
+				   m_cur x n_cur part of c11. */ \
+				gemm_edge_ukr_cast( m_cur, \
+				                    n_cur, \
+				                    k, \
+				                    alpha_cast, \
+				                    a1, \
+				                    bp, \
+				                    beta_cast, \
+				                    c11, rs_c, cs_c, \
+				                    &aux ); \
+			} \
 			else \
 			{ \
 				/* Invoke the gemm micro-kernel. */ \
@@ -300,16 +346,10 @@ void PASTEMAC(ch,varname)( \
 				                        c11, rs_c,  cs_c ); \
 			} \
 \
-			a1  += rstep_a; \
-			c11 += rstep_c; \
+			a1  += ir_num_threads * rstep_a; \
+			c11 += ir_num_threads * rstep_c; \
 		} \
-\
-		b1 += cstep_b; \
-		c1 += cstep_c; \
 	} \
-\
-/*PASTEMAC(ch,fprintm)( stdout, "gemm_ker_var5: b1", k, NR, b1, NR, 1, "%4.1f", "" ); \
-PASTEMAC(ch,fprintm)( stdout, "gemm_ker_var5: a1", MR, k, a1, 1, MR, "%4.1f", "" );*/ \
 }
 
 INSERT_GENTFUNC_BASIC( gemm_ker_var5, gemm_ukr_t )
@@ -36,10 +36,11 @@
 //
 // Prototype object-based interface.
 //
-void bli_gemm_ker_var5( obj_t*  a,
-                        obj_t*  b,
-                        obj_t*  c,
-                        gemm_t* cntl );
+void bli_gemm_ker_var5( obj_t*          a,
+                        obj_t*          b,
+                        obj_t*          c,
+                        gemm_t*         cntl,
+                        gemm_thrinfo_t* thread );
 
 
 //
@@ -49,15 +50,18 @@ void bli_gemm_ker_var5( obj_t*  a,
 #define GENTPROT( ctype, ch, varname ) \
 \
 void PASTEMAC(ch,varname)( \
+                           conj_t  conjb, \
                            dim_t   m, \
                            dim_t   n, \
                            dim_t   k, \
                            void*   alpha, \
                            void*   a, inc_t cs_a, inc_t pd_a, inc_t ps_a, \
-                           void*   b, inc_t rs_b, inc_t pd_b, inc_t ps_b, \
+                           void*   b, inc_t rs_b, inc_t cs_b, \
                            void*   beta, \
                            void*   c, inc_t rs_c, inc_t cs_c, \
-                           void*   gemm_ukr  \
+                           void*   gemm_ukr, \
+                           void*   gemm_edge_ukr, \
+                           gemm_thrinfo_t* thread  \
                          );
 
 INSERT_GENTPROT_BASIC( gemm_ker_var5 )
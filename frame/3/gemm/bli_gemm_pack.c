@@ -0,0 +1,92 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+extern packm_t* gemm_prepacka_cntl;
+extern packm_t* gemm_prepackb_cntl;
+
+//
+// Define object-based interfaces.
+//
+void bli_gemm_pack_a( obj_t*  a,
+                      obj_t*  ap )
+{
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_gemm_pack_check( a );
+
+	// Initialize ap so that packm_init() acquires a new buffer for it
+	// rather than reusing one.
+	bli_obj_init_pack( ap );
+
+	// Pack A to row panels, exactly as gemm would pack it to the A block,
+	// except that all of A is packed and the buffer persists.
+	bli_packm_init( a, ap,
+	                gemm_prepacka_cntl );
+
+	bli_packm_int( a, ap,
+	               gemm_prepacka_cntl,
+	               &BLIS_PACKM_SINGLE_THREADED );
+}
+
+void bli_gemm_pack_b( obj_t*  b,
+                      obj_t*  bp )
+{
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_gemm_pack_check( b );
+
+	// Initialize bp so that packm_init() acquires a new buffer for it
+	// rather than reusing one.
+	bli_obj_init_pack( bp );
+
+	// Pack B to column panels, exactly as gemm would pack it to the B
+	// panel, except that all of B is packed and the buffer persists.
+	bli_packm_init( b, bp,
+	                gemm_prepackb_cntl );
+
+	bli_packm_int( b, bp,
+	               gemm_prepackb_cntl,
+	               &BLIS_PACKM_SINGLE_THREADED );
+}
+
+void bli_gemm_pack_free( obj_t*  p )
+{
+	// Release the buffer acquired by bli_gemm_pack_a() or
+	// bli_gemm_pack_b().
+	bli_obj_release_pack( p );
+}
+
@@ -0,0 +1,390 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#ifndef BLIS_ENABLE_WINDOWS_BUILD
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+  #define BLIS_PACK_FILE_HAVE_MMAP
+#endif
+
+#include <stddef.h>
+
+extern blksz_t* gemm_kc;
+extern blksz_t* gemm_mr;
+extern blksz_t* gemm_nr;
+
+
+uint64_t bli_gemm_pack_checksum( void*  buf,
+                                 siz_t  size )
+{
+	// 64-bit FNV-1a, applied a word (rather than a byte) at a time so
+	// that checksumming a large file is limited by memory bandwidth.
+	const uint64_t prime = 1099511628211ULL;
+	uint64_t       hash  = 14695981039346656037ULL;
+	char*          p     = buf;
+	uint64_t       word;
+	siz_t          i;
+
+	for ( i = 0; i + sizeof( word ) <= size; i += sizeof( word ) )
+	{
+		memcpy( &word, p + i, sizeof( word ) );
+		hash = ( hash ^ word ) * prime;
+	}
+
+	for ( ; i < size; ++i )
+		hash = ( hash ^ ( unsigned char )p[i] ) * prime;
+
+	return hash;
+}
+
+err_t bli_gemm_pack_header_check( packfile_t*  h,
+                                  siz_t        file_size )
+{
+	num_t    dt;
+	dim_t    mr, mr_pack;
+	dim_t    nr, nr_pack;
+	uint64_t n_panels;
+	uint64_t k_padded;
+	uint64_t dim_pack;
+
+	// Check that the file is a packed matrix file in this version of the
+	// format and byte order, and that the header is intact.
+	if ( memcmp( h->magic, BLIS_PACK_FILE_MAGIC, sizeof( h->magic ) ) != 0 ||
+	     h->version    != BLIS_PACK_FILE_VERSION ||
+	     h->byte_order != BLIS_PACK_FILE_BYTE_ORDER )
+		return BLIS_INVALID_PACK_FILE;
+
+	if ( h->header_checksum !=
+	     bli_gemm_pack_checksum( h, offsetof( packfile_t, header_checksum ) ) )
+		return BLIS_INVALID_PACK_FILE;
+
+	// Check that the file holds all of the data it claims to hold, along
+	// with the padding that micro-kernels may preload from. The header
+	// checksum is easily recomputed, so none of the remaining fields can
+	// be trusted not to have been crafted to wrap an unsigned sum or
+	// product; they are bounded by the file size (through data_size)
+	// before they are added or multiplied.
+	if ( h->file_size   != file_size ||
+	     h->data_offset != BLIS_PACK_FILE_HEADER_SIZE ||
+	     file_size < h->data_offset + BLIS_MAX_PRELOAD_BYTE_OFFSET ||
+	     h->data_size > file_size - h->data_offset - BLIS_MAX_PRELOAD_BYTE_OFFSET )
+		return BLIS_INVALID_PACK_FILE;
+
+	dt = ( num_t )h->datatype;
+
+	if ( bli_check_valid_datatype( dt ) != BLIS_SUCCESS ||
+	     bli_check_floating_datatype( dt ) != BLIS_SUCCESS ||
+	     h->elem_size != bli_datatype_size( dt ) )
+		return BLIS_INVALID_PACK_FILE;
+
+	// Check that the panels were packed in the format that this library's
+	// micro-kernel expects.
+	mr      = bli_blksz_for_type( dt, gemm_mr );
+	mr_pack = mr + bli_blksz_ext_for_type( dt, gemm_mr );
+	nr      = bli_blksz_for_type( dt, gemm_nr );
+	nr_pack = nr + bli_blksz_ext_for_type( dt, gemm_nr );
+
+	if ( h->pack_schema == BLIS_PACKED_ROW_PANELS )
+	{
+		if ( h->pd != mr || h->rs != 1 || h->cs != mr_pack ||
+		     h->m_padded % mr != 0 )
+			return BLIS_INVALID_PACK_FILE;
+
+		n_panels = h->m_padded / mr;
+		k_padded = h->n_padded;
+		dim_pack = mr_pack;
+	}
+	else if ( h->pack_schema == BLIS_PACKED_COL_PANELS )
+	{
+		if ( h->pd != nr || h->cs != 1 || h->rs != nr_pack ||
+		     h->n_padded % nr != 0 )
+			return BLIS_INVALID_PACK_FILE;
+
+		n_panels = h->n_padded / nr;
+		k_padded = h->m_padded;
+		dim_pack = nr_pack;
+	}
+	else
+	{
+		return BLIS_INVALID_PACK_FILE;
+	}
+
+	// Check that the panels fit in the data, and that each panel is large
+	// enough to hold the padded k dimension.
+	if ( n_panels > h->data_size / h->elem_size )
+		return BLIS_INVALID_PACK_FILE;
+
+	if ( n_panels > 0 &&
+	     h->ps > h->data_size / ( n_panels * h->elem_size ) )
+		return BLIS_INVALID_PACK_FILE;
+
+	if ( h->data_size != h->ps * n_panels * h->elem_size ||
+	     k_padded > h->ps / dim_pack ||
+	     h->m > h->m_padded || h->n > h->n_padded )
+		return BLIS_INVALID_PACK_FILE;
+
+	return BLIS_SUCCESS;
+}
+
+
+void bli_gemm_pack_write( obj_t*  p,
+                          char*   filename )
+{
+	num_t      dt = bli_obj_datatype( *p );
+	packfile_t header;
+	char       page[ BLIS_PACK_FILE_HEADER_SIZE ];
+	char*      data;
+	dim_t      n_panels;
+	siz_t      n_written;
+	siz_t      n_pad;
+	FILE*      file;
+
+	// Only operands packed by bli_gemm_pack_a() or bli_gemm_pack_b() (or
+	// mapped from a file) may be written.
+	if ( !bli_obj_is_panel_packed( *p ) || bli_obj_has_trans( *p ) )
+		bli_check_error_code( BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_OPERAND );
+
+	if ( bli_obj_pack_status( *p ) == BLIS_PACKED_ROW_PANELS )
+		n_panels = bli_obj_padded_length( *p ) / bli_obj_panel_dim( *p );
+	else
+		n_panels = bli_obj_padded_width( *p ) / bli_obj_panel_dim( *p );
+
+	data = bli_obj_buffer( *p );
+
+	// Fill in the header. We clear it first so that the checksum does not
+	// depend on uninitialized bytes.
+	memset( &header, 0, sizeof( header ) );
+
+	memcpy( header.magic, BLIS_PACK_FILE_MAGIC, sizeof( header.magic ) );
+	header.version     = BLIS_PACK_FILE_VERSION;
+	header.byte_order  = BLIS_PACK_FILE_BYTE_ORDER;
+
+	header.data_offset = BLIS_PACK_FILE_HEADER_SIZE;
+	header.data_size   = bli_obj_panel_stride( *p ) * n_panels *
+	                     bli_obj_elem_size( *p );
+
+	// Pad the file with at least as many bytes as a micro-kernel may
+	// preload beyond the end of the packed data, and round it up to a
+	// whole number of pages.
+	header.file_size   = header.data_offset + header.data_size +
+	                     BLIS_MAX_PRELOAD_BYTE_OFFSET;
+	header.file_size   = bli_align_dim_to_mult( header.file_size,
+	                                            BLIS_PACK_FILE_HEADER_SIZE );
+
+	header.datatype    = dt;
+	header.pack_schema = bli_obj_pack_status( *p );
+	header.elem_size   = bli_obj_elem_size( *p );
+	header.m           = bli_obj_length( *p );
+	header.n           = bli_obj_width( *p );
+	header.m_padded    = bli_obj_padded_length( *p );
+	header.n_padded    = bli_obj_padded_width( *p );
+	header.rs          = bli_obj_row_stride( *p );
+	header.cs          = bli_obj_col_stride( *p );
+	header.pd          = bli_obj_panel_dim( *p );
+	header.ps          = bli_obj_panel_stride( *p );
+
+	header.mr          = bli_blksz_for_type( dt, gemm_mr );
+	header.nr          = bli_blksz_for_type( dt, gemm_nr );
+	header.kc          = bli_blksz_for_type( dt, gemm_kc );
+
+	header.scalar      = *bli_obj_internal_scalar_buffer( *p );
+
+	header.data_checksum   = bli_gemm_pack_checksum( data, header.data_size );
+	header.header_checksum = bli_gemm_pack_checksum( &header,
+	                             offsetof( packfile_t, header_checksum ) );
+
+	memset( page, 0, sizeof( page ) );
+	memcpy( page, &header, sizeof( header ) );
+
+	// Write the header page, the packed data, and the padding.
+	file = fopen( filename, "wb" );
+
+	if ( file == NULL )
+		bli_check_error_code( BLIS_PACK_FILE_IO_FAILURE );
+
+	n_written = fwrite( page, 1, sizeof( page ), file );
+	n_written += fwrite( data, 1, header.data_size, file );
+
+	memset( page, 0, sizeof( page ) );
+
+	for ( n_pad = header.file_size - n_written; n_pad > 0; )
+	{
+		siz_t n_cur = bli_min( n_pad, sizeof( page ) );
+		siz_t n_put = fwrite( page, 1, n_cur, file );
+
+		n_written += n_put;
+		if ( n_put != n_cur ) break;
+		n_pad -= n_cur;
+	}
+
+	if ( fclose( file ) != 0 || n_written != header.file_size )
+		bli_check_error_code( BLIS_PACK_FILE_IO_FAILURE );
+}
+
+
+void bli_gemm_pack_map( char*   filename,
+                        obj_t*  p )
+{
+	packfile_t* header;
+	char*       base;
+	siz_t       file_size;
+	err_t       e_val;
+
+#ifdef BLIS_PACK_FILE_HAVE_MMAP
+	struct stat st;
+	int         fd;
+
+	// Map the whole file read-only and shared, so that every process that
+	// maps it uses the same physical pages.
+	fd = open( filename, O_RDONLY );
+
+	if ( fd < 0 )
+		bli_check_error_code( BLIS_PACK_FILE_IO_FAILURE );
+
+	if ( fstat( fd, &st ) != 0 )
+	{
+		close( fd );
+		bli_check_error_code( BLIS_PACK_FILE_IO_FAILURE );
+	}
+
+	file_size = st.st_size;
+
+	if ( file_size < BLIS_PACK_FILE_HEADER_SIZE )
+	{
+		close( fd );
+		bli_check_error_code( BLIS_INVALID_PACK_FILE );
+	}
+
+	base = mmap( NULL, file_size, PROT_READ, MAP_SHARED, fd, 0 );
+
+	close( fd );
+
+	if ( base == MAP_FAILED )
+		bli_check_error_code( BLIS_PACK_FILE_IO_FAILURE );
+#else
+	FILE*       file;
+
+	// Without mmap(), read the whole file into memory instead.
+	file = fopen( filename, "rb" );
+
+	if ( file == NULL )
+		bli_check_error_code( BLIS_PACK_FILE_IO_FAILURE );
+
+	fseek( file, 0, SEEK_END );
+	file_size = ftell( file );
+	fseek( file, 0, SEEK_SET );
+
+	if ( file_size < BLIS_PACK_FILE_HEADER_SIZE )
+	{
+		fclose( file );
+		bli_check_error_code( BLIS_INVALID_PACK_FILE );
+	}
+
+	base = bli_malloc( file_size );
+
+	if ( fread( base, 1, file_size, file ) != file_size )
+	{
+		fclose( file );
+		bli_free( base );
+		bli_check_error_code( BLIS_PACK_FILE_IO_FAILURE );
+	}
+
+	fclose( file );
+#endif
+
+	header = ( packfile_t* )base;
+
+	// Check the header before trusting any of it.
+	e_val = bli_gemm_pack_header_check( header, file_size );
+
+	if ( e_val != BLIS_SUCCESS )
+	{
+#ifdef BLIS_PACK_FILE_HAVE_MMAP
+		munmap( base, file_size );
+#else
+		bli_free( base );
+#endif
+		bli_check_error_code( e_val );
+	}
+
+	// Initialize p as a packed object whose buffer is the packed data in
+	// the file, exactly as bli_gemm_pack_a() or bli_gemm_pack_b() would
+	// have left it. Its pack mem_t entry is left unallocated since the
+	// buffer belongs to the mapping.
+	bli_obj_create_without_buffer( ( num_t )header->datatype,
+	                               header->m,
+	                               header->n,
+	                               p );
+
+	bli_obj_set_buffer( base + header->data_offset, *p );
+	bli_obj_set_incs( header->rs, header->cs, *p );
+	bli_obj_set_pack_schema( ( pack_t )header->pack_schema, *p );
+	bli_obj_set_padded_dims( header->m_padded, header->n_padded, *p );
+	bli_obj_set_panel_dim( header->pd, *p );
+	bli_obj_set_panel_stride( header->ps, *p );
+	bli_obj_set_internal_scalar( header->scalar, *p );
+}
+
+
+void bli_gemm_pack_unmap( obj_t*  p )
+{
+	char*       base   = ( char* )bli_obj_buffer( *p ) -
+	                     BLIS_PACK_FILE_HEADER_SIZE;
+	packfile_t* header = ( packfile_t* )base;
+
+#ifdef BLIS_PACK_FILE_HAVE_MMAP
+	munmap( base, header->file_size );
+#else
+	bli_free( base );
+#endif
+}
+
+
+bool_t bli_gemm_pack_verify( obj_t*  p )
+{
+	char*       data   = bli_obj_buffer( *p );
+	packfile_t* header = ( packfile_t* )( data - BLIS_PACK_FILE_HEADER_SIZE );
+
+	// Check the packed data of a mapped object against the checksum that
+	// was recorded when it was written. This touches every page of the
+	// data, so it is not done by bli_gemm_pack_map().
+	return bli_gemm_pack_checksum( data, header->data_size ) ==
+	       header->data_checksum;
+}
+
@@ -0,0 +1,121 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Packed matrix files.
+//
+// An operand packed by bli_gemm_pack_a() or bli_gemm_pack_b() may be
+// saved to a file with bli_gemm_pack_write(). The file consists of a
+// BLIS_PACK_FILE_HEADER_SIZE-byte header (describing the datatype, pack
+// schema, dimensions, strides, and blocksizes, with checksums) followed
+// by the packed micro-panels, byte for byte as the macro-kernel reads
+// them. bli_gemm_pack_map() maps such a file read-only into memory and
+// initializes an object that may be passed directly to bli_gemm(), so
+// processes that map the same file share one copy of it in the page
+// cache. The mapping is released with bli_gemm_pack_unmap().
+//
+// A file may only be mapped by a library whose register blocksizes (and
+// register blocksize extensions) match those of the library that wrote
+// it, since the micro-kernel depends on the panel format. The cache
+// blocksizes are recorded but need not match, since each panel holds the
+// entire k dimension.
+//
+
+#define BLIS_PACK_FILE_VERSION      1
+#define BLIS_PACK_FILE_HEADER_SIZE  4096
+#define BLIS_PACK_FILE_MAGIC        "BLISPACK"
+#define BLIS_PACK_FILE_BYTE_ORDER   0x01020304
+
+// The header of a packed matrix file. Every field has a fixed width, so
+// the layout does not depend on the configuration. The header occupies
+// the first BLIS_PACK_FILE_HEADER_SIZE bytes of the file (the rest of
+// that region is zero) so that the packed data begins on a page boundary
+// once the file is mapped.
+struct packfile_s
+{
+	char     magic[8];
+	uint32_t version;
+	uint32_t byte_order;
+
+	uint64_t file_size;
+	uint64_t data_offset;
+	uint64_t data_size;
+
+	uint64_t datatype;
+	uint64_t pack_schema;
+	uint64_t elem_size;
+	uint64_t m;
+	uint64_t n;
+	uint64_t m_padded;
+	uint64_t n_padded;
+	int64_t  rs;
+	int64_t  cs;
+	uint64_t pd;
+	uint64_t ps;
+
+	uint64_t mr;
+	uint64_t nr;
+	uint64_t kc;
+
+	atom_t   scalar;
+
+	uint64_t data_checksum;
+	uint64_t header_checksum;
+};
+typedef struct packfile_s packfile_t;
+
+
+void   bli_gemm_pack_write( obj_t*  p,
+                            char*   filename );
+
+void   bli_gemm_pack_map( char*   filename,
+                          obj_t*  p );
+
+void   bli_gemm_pack_unmap( obj_t*  p );
+
+bool_t bli_gemm_pack_verify( obj_t*  p );
+
+
+// bli_gemm_pack_header_check() validates a file header against the size
+// of the file and the register blocksizes of this library, as
+// bli_gemm_pack_map() does before trusting it. Unlike the latter, it
+// returns an error code rather than aborting. bli_gemm_pack_checksum()
+// computes the checksums that are recorded in the header.
+uint64_t bli_gemm_pack_checksum( void*  buf,
+                                 siz_t  size );
+
+err_t    bli_gemm_pack_header_check( packfile_t*  h,
+                                     siz_t        file_size );
+
@@ -0,0 +1,344 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#define FUNCPTR_T gemm_small_fp
+
+typedef void (*FUNCPTR_T)(
+                           conj_t  conja,
+                           conj_t  conjb,
+                           dim_t   m,
+                           dim_t   n,
+                           dim_t   k,
+                           void*   alpha,
+                           void*   a, inc_t rs_a, inc_t cs_a,
+                           void*   b, inc_t rs_b, inc_t cs_b,
+                           void*   beta,
+                           void*   c, inc_t rs_c, inc_t cs_c,
+                           void*   gemm_ukr
+                         );
+
+static FUNCPTR_T GENARRAY(ftypes,gemm_small);
+
+extern func_t*   gemm_ukrs;
+
+
+bool_t bli_gemm_small_applies( obj_t*  a,
+                               obj_t*  b,
+                               obj_t*  c )
+{
+	num_t dt = bli_obj_datatype( *c );
+	dim_t m  = bli_obj_length( *c );
+	dim_t n  = bli_obj_width( *c );
+	dim_t k  = bli_obj_width_after_trans( *a );
+
+	// The small-matrix path only handles the common case: general,
+	// dense, unpacked operands that all share the same floating-point
+	// datatype and whose dimensions are non-zero and within the thresholds.
+	if ( bli_obj_is_int( *c ) || bli_obj_is_const( *c ) ) return FALSE;
+
+	if ( bli_obj_pack_status( *a ) != BLIS_NOT_PACKED ||
+	     bli_obj_pack_status( *b ) != BLIS_NOT_PACKED ) return FALSE;
+
+	if ( bli_obj_datatype( *a ) != dt ||
+	     bli_obj_datatype( *b ) != dt ||
+	     bli_obj_execution_datatype( *c ) != dt ) return FALSE;
+
+	if ( !bli_obj_is_general( *a ) || !bli_obj_is_dense( *a ) ||
+	     !bli_obj_is_general( *b ) || !bli_obj_is_dense( *b ) ||
+	     !bli_obj_is_general( *c ) || !bli_obj_is_dense( *c ) ) return FALSE;
+
+	if ( m < 1 || m > BLIS_GEMM_SMALL_M_THRESH ||
+	     n < 1 || n > BLIS_GEMM_SMALL_N_THRESH ||
+	     k < 1 || k > BLIS_GEMM_SMALL_K_THRESH ) return FALSE;
+
+	return TRUE;
+}
+
+
+void bli_gemm_small( obj_t*  alpha,
+                     obj_t*  a,
+                     obj_t*  b,
+                     obj_t*  beta,
+                     obj_t*  c )
+{
+	num_t     dt        = bli_obj_datatype( *c );
+
+	dim_t     m         = bli_obj_length( *c );
+	dim_t     n         = bli_obj_width( *c );
+	dim_t     k         = bli_obj_width_after_trans( *a );
+
+	conj_t    conja     = bli_obj_conj_status( *a );
+	conj_t    conjb     = bli_obj_conj_status( *b );
+
+	void*     buf_a     = bli_obj_buffer_at_off( *a );
+	inc_t     rs_a      = bli_obj_row_stride( *a );
+	inc_t     cs_a      = bli_obj_col_stride( *a );
+
+	void*     buf_b     = bli_obj_buffer_at_off( *b );
+	inc_t     rs_b      = bli_obj_row_stride( *b );
+	inc_t     cs_b      = bli_obj_col_stride( *b );
+
+	void*     buf_c     = bli_obj_buffer_at_off( *c );
+	inc_t     rs_c      = bli_obj_row_stride( *c );
+	inc_t     cs_c      = bli_obj_col_stride( *c );
+
+	obj_t     alpha_local;
+	obj_t     beta_local;
+	obj_t     scalar_a;
+	obj_t     scalar_b;
+
+	void*     buf_alpha;
+	void*     buf_beta;
+
+	FUNCPTR_T f;
+
+	void*     gemm_ukr;
+
+
+	// Apply any transpositions of A and B by swapping their strides. The
+	// operands are always packed, so this costs nothing.
+	if ( bli_obj_has_trans( *a ) ) bli_swap_incs( rs_a, cs_a );
+	if ( bli_obj_has_trans( *b ) ) bli_swap_incs( rs_b, cs_b );
+
+	// Create local copies of the scalars, typecast to the datatype of C,
+	// and fold in any scalars attached to A and B.
+	bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE,
+	                                      alpha, &alpha_local );
+	bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE,
+	                                      beta, &beta_local );
+
+	bli_obj_scalar_detach( a, &scalar_a );
+	bli_obj_scalar_detach( b, &scalar_b );
+	bli_mulsc( &scalar_a, &alpha_local );
+	bli_mulsc( &scalar_b, &alpha_local );
+
+	buf_alpha = bli_obj_buffer_for_1x1( dt, alpha_local );
+	buf_beta  = bli_obj_buffer_for_1x1( dt, beta_local );
+
+	// Index into the type combination array to extract the correct
+	// function pointer.
+	f = ftypes[dt];
+
+	// Query the gemm micro-kernel address corresponding to the current
+	// datatype.
+	gemm_ukr = bli_func_obj_query( dt, gemm_ukrs );
+
+	// Invoke the function.
+	f( conja,
+	   conjb,
+	   m,
+	   n,
+	   k,
+	   buf_alpha,
+	   buf_a, rs_a, cs_a,
+	   buf_b, rs_b, cs_b,
+	   buf_beta,
+	   buf_c, rs_c, cs_c,
+	   gemm_ukr );
+}
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname, ukrtype ) \
+\
+void PASTEMAC(ch,varname)( \
+                           conj_t  conja, \
+                           conj_t  conjb, \
+                           dim_t   m, \
+                           dim_t   n, \
+                           dim_t   k, \
+                           void*   alpha, \
+                           void*   a, inc_t rs_a, inc_t cs_a, \
+                           void*   b, inc_t rs_b, inc_t cs_b, \
+                           void*   beta, \
+                           void*   c, inc_t rs_c, inc_t cs_c, \
+                           void*   gemm_ukr  \
+                         ) \
+{ \
+	/* Cast the micro-kernel address to its function pointer type. */ \
+	PASTECH(ch,ukrtype) gemm_ukr_cast = gemm_ukr; \
+\
+	/* Alias some constants to simpler names. */ \
+	const dim_t     MR         = PASTEMAC(ch,mr); \
+	const dim_t     NR         = PASTEMAC(ch,nr); \
+	const dim_t     PACKMR     = PASTEMAC(ch,packmr); \
+	const dim_t     PACKNR     = PASTEMAC(ch,packnr); \
+\
+	/* Stack buffers for one micro-panel of A, all micro-panels of B,
+	   and the temporary C used for edge cases. */ \
+	ctype           ap[ PASTEMAC(ch,packmr) * \
+	                    BLIS_GEMM_SMALL_K_THRESH ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	ctype           bp[ ( ( BLIS_GEMM_SMALL_N_THRESH + PASTEMAC(ch,nr) - 1 ) / \
+	                      PASTEMAC(ch,nr) ) * \
+	                    PASTEMAC(ch,packnr) * \
+	                    BLIS_GEMM_SMALL_K_THRESH ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	ctype           ct[ PASTEMAC(ch,maxmr) * \
+	                    PASTEMAC(ch,maxnr) ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const inc_t     rs_ct      = 1; \
+	const inc_t     cs_ct      = PASTEMAC(ch,maxmr); \
+\
+	ctype* restrict zero       = PASTEMAC(ch,0); \
+	ctype* restrict one        = PASTEMAC(ch,1); \
+	ctype* restrict a_cast     = a; \
+	ctype* restrict b_cast     = b; \
+	ctype* restrict c_cast     = c; \
+	ctype* restrict alpha_cast = alpha; \
+	ctype* restrict beta_cast  = beta; \
+	ctype* restrict b1; \
+	ctype* restrict c11; \
+\
+	dim_t           m_iter, m_left; \
+	dim_t           n_iter, n_left; \
+	dim_t           i, j; \
+	dim_t           m_cur; \
+	dim_t           n_cur; \
+	inc_t           ps_a, ps_b; \
+	auxinfo_t       aux; \
+\
+	/*
+	   Assumptions/assertions:
+	     0 < m <= BLIS_GEMM_SMALL_M_THRESH
+	     0 < n <= BLIS_GEMM_SMALL_N_THRESH
+	     0 < k <= BLIS_GEMM_SMALL_K_THRESH
+	     rs_a, cs_a, rs_b, cs_b, rs_c, cs_c == (no assumptions)
+	*/ \
+\
+	/* Compute number of primary and leftover components of the m and n
+	   dimensions. */ \
+	n_iter = n / NR; \
+	n_left = n % NR; \
+\
+	m_iter = m / MR; \
+	m_left = m % MR; \
+\
+	if ( n_left ) ++n_iter; \
+	if ( m_left ) ++m_iter; \
+\
+	/* The micro-panels are packed contiguously, as they would be by
+	   packm, so that the micro-kernel sees its usual operand format. */ \
+	ps_a = PACKMR * k; \
+	ps_b = PACKNR * k; \
+\
+	bli_auxinfo_set_ps_a( ps_a, aux ); \
+	bli_auxinfo_set_ps_b( ps_b, aux ); \
+\
+	/* Pack all of B, one micro-panel at a time, zero-padding the last
+	   micro-panel if it is short. */ \
+	for ( j = 0; j < n_iter; ++j ) \
+	{ \
+		n_cur = ( bli_is_not_edge_f( j, n_iter, n_left ) ? NR : n_left ); \
+		b1    = bp + j * ps_b; \
+\
+		PASTEMAC(ch,packm_cxk)( conjb, \
+		                        n_cur, \
+		                        k, \
+		                        one, \
+		                        b_cast + j * NR * cs_b, cs_b, rs_b, \
+		                        b1,                            PACKNR ); \
+\
+		if ( n_cur < PACKNR ) \
+			PASTEMAC(ch,set0s_mxn)( PACKNR - n_cur, k, \
+			                        b1 + n_cur, 1, PACKNR ); \
+	} \
+\
+	/* Loop over the m dimension (MR rows at a time). Each micro-panel
+	   of A is packed once and then multiplied by every micro-panel of B
+	   while it remains in the L1 cache. */ \
+	for ( i = 0; i < m_iter; ++i ) \
+	{ \
+		m_cur = ( bli_is_not_edge_f( i, m_iter, m_left ) ? MR : m_left ); \
+\
+		PASTEMAC(ch,packm_cxk)( conja, \
+		                        m_cur, \
+		                        k, \
+		                        one, \
+		                        a_cast + i * MR * rs_a, rs_a, cs_a, \
+		                        ap,                         PACKMR ); \
+\
+		if ( m_cur < PACKMR ) \
+			PASTEMAC(ch,set0s_mxn)( PACKMR - m_cur, k, \
+			                        ap + m_cur, 1, PACKMR ); \
+\
+		bli_auxinfo_set_next_a( ap, aux ); \
+\
+		/* Loop over the n dimension (NR columns at a time). */ \
+		for ( j = 0; j < n_iter; ++j ) \
+		{ \
+			b1  = bp     + j * ps_b; \
+			c11 = c_cast + i * MR * rs_c + j * NR * cs_c; \
+\
+			n_cur = ( bli_is_not_edge_f( j, n_iter, n_left ) ? NR : n_left ); \
+\
+			bli_auxinfo_set_next_b( ( j < n_iter - 1 ? b1 + ps_b : bp ), aux ); \
+\
+			/* Handle interior and edge cases separately. */ \
+			if ( m_cur == MR && n_cur == NR ) \
+			{ \
+				/* Invoke the gemm micro-kernel. */ \
+				gemm_ukr_cast( k, \
+				               alpha_cast, \
+				               ap, \
+				               b1, \
+				               beta_cast, \
+				               c11, rs_c, cs_c, \
+				               &aux ); \
+			} \
+			else \
+			{ \
+				/* Invoke the gemm micro-kernel. */ \
+				gemm_ukr_cast( k, \
+				               alpha_cast, \
+				               ap, \
+				               b1, \
+				               zero, \
+				               ct, rs_ct, cs_ct, \
+				               &aux ); \
+\
+				/* Scale the edge of C and add the result from above. */ \
+				PASTEMAC(ch,xpbys_mxn)( m_cur, n_cur, \
+				                        ct,  rs_ct, cs_ct, \
+				                        beta_cast, \
+				                        c11, rs_c,  cs_c ); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( gemm_small, gemm_ukr_t )
+
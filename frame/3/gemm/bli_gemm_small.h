@@ -0,0 +1,88 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// Problems whose m, n, and k dimensions do not exceed these thresholds
+// may be computed by bli_gemm_small(), which bypasses the control tree
+// and packs its operands to buffers on the stack. A threshold of zero
+// disables the small-matrix path.
+
+#ifndef BLIS_GEMM_SMALL_M_THRESH
+#define BLIS_GEMM_SMALL_M_THRESH  64
+#endif
+
+#ifndef BLIS_GEMM_SMALL_N_THRESH
+#define BLIS_GEMM_SMALL_N_THRESH  64
+#endif
+
+#ifndef BLIS_GEMM_SMALL_K_THRESH
+#define BLIS_GEMM_SMALL_K_THRESH  64
+#endif
+
+
+//
+// Prototype object-based interface.
+//
+bool_t bli_gemm_small_applies( obj_t*  a,
+                               obj_t*  b,
+                               obj_t*  c );
+
+void   bli_gemm_small( obj_t*  alpha,
+                       obj_t*  a,
+                       obj_t*  b,
+                       obj_t*  beta,
+                       obj_t*  c );
+
+
+//
+// Prototype BLAS-like interfaces.
+//
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname)( \
+                           conj_t  conja, \
+                           conj_t  conjb, \
+                           dim_t   m, \
+                           dim_t   n, \
+                           dim_t   k, \
+                           void*   alpha, \
+                           void*   a, inc_t rs_a, inc_t cs_a, \
+                           void*   b, inc_t rs_b, inc_t cs_b, \
+                           void*   beta, \
+                           void*   c, inc_t rs_c, inc_t cs_c, \
+                           void*   gemm_ukr  \
+                         );
+
+INSERT_GENTPROT_BASIC( gemm_small )
+
@@ -0,0 +1,235 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+gemm_thrinfo_t BLIS_GEMM_SINGLE_THREADED =
+{
+	&BLIS_SINGLE_COMM, 0,
+	&BLIS_SINGLE_COMM, 0,
+	1, 0,
+	&BLIS_PACKM_SINGLE_THREADED,
+	&BLIS_PACKM_SINGLE_THREADED,
+	&BLIS_GEMM_SINGLE_THREADED
+};
+
+static gemm_thrinfo_t* gemm_single_threaded_paths[1] =
+{
+	&BLIS_GEMM_SINGLE_THREADED
+};
+
+
+gemm_thrinfo_t* bli_gemm_thrinfo_create( thread_comm_t*  ocomm,
+                                         dim_t           ocomm_id,
+                                         thread_comm_t*  icomm,
+                                         dim_t           icomm_id,
+                                         dim_t           n_way,
+                                         dim_t           work_id,
+                                         gemm_thrinfo_t* sub_gemm )
+{
+	gemm_thrinfo_t* thread;
+
+	thread = ( gemm_thrinfo_t* ) bli_malloc( sizeof(gemm_thrinfo_t) );
+
+	thread->ocomm    = ocomm;
+	thread->ocomm_id = ocomm_id;
+	thread->icomm    = icomm;
+	thread->icomm_id = icomm_id;
+	thread->n_way    = n_way;
+	thread->work_id  = work_id;
+	thread->opackm   = bli_packm_thrinfo_create( ocomm, ocomm_id );
+	thread->ipackm   = bli_packm_thrinfo_create( icomm, icomm_id );
+	thread->sub_gemm = sub_gemm;
+
+	return thread;
+}
+
+
+gemm_thrinfo_t** bli_gemm_thrinfo_create_paths( void )
+{
+	return bli_gemm_thrinfo_create_paths_ways( bli_thread_get_jc_nt(),
+	                                           1,
+	                                           bli_thread_get_ic_nt(),
+	                                           bli_thread_get_jr_nt(),
+	                                           bli_thread_get_ir_nt() );
+}
+
+
+gemm_thrinfo_t** bli_gemm_thrinfo_create_paths_var5( void )
+{
+	// The control tree that streams B (see bli_gemm_cntl_init_exp()) nests
+	// its blocked variants as jc (blk_var2f) -> ic (blk_var1f) -> kc
+	// (blk_var3f) -> jr (ker_var5) -> ir (ker_var5). Since each path holds
+	// one thread info object per node, in order, we create the same paths
+	// with the ic and kc levels exchanged.
+	return bli_gemm_thrinfo_create_paths_ways( bli_thread_get_jc_nt(),
+	                                           bli_thread_get_ic_nt(),
+	                                           1,
+	                                           bli_thread_get_jr_nt(),
+	                                           bli_thread_get_ir_nt() );
+}
+
+
+gemm_thrinfo_t** bli_gemm_thrinfo_create_paths_ways( dim_t jc_way,
+                                                     dim_t kc_way,
+                                                     dim_t ic_way,
+                                                     dim_t jr_way,
+                                                     dim_t ir_way )
+{
+	dim_t global_num_threads = jc_way * kc_way * ic_way * jr_way * ir_way;
+	dim_t jc_nt              = kc_way * ic_way * jr_way * ir_way;
+	dim_t kc_nt              = ic_way * jr_way * ir_way;
+	dim_t ic_nt              = jr_way * ir_way;
+	dim_t jr_nt              = ir_way;
+
+	gemm_thrinfo_t** paths;
+	thread_comm_t*   global_comm;
+	thread_comm_t*   jc_comm = NULL;
+	thread_comm_t*   kc_comm = NULL;
+	thread_comm_t*   ic_comm = NULL;
+	thread_comm_t*   jr_comm = NULL;
+	dim_t            a, b, c, d, e;
+
+	// In the common single-threaded case, avoid allocating anything.
+	if ( global_num_threads == 1 ) return gemm_single_threaded_paths;
+
+	paths       = ( gemm_thrinfo_t** ) bli_malloc( global_num_threads * sizeof(gemm_thrinfo_t*) );
+	global_comm = bli_thread_comm_create( global_num_threads );
+
+	// Each thread's path through the gemm control tree is a chain of thread
+	// info objects, one per node: jc (blk_var2f) -> kc (blk_var3f) ->
+	// ic (blk_var1f) -> jr (ker_var2) -> ir (ker_var2). Threads that share
+	// the same group at a given level share the same communicator. The
+	// thread with the lowest global id in each group creates the group's
+	// communicator, which the remaining threads of the group then reuse.
+	for ( a = 0; a < jc_way; ++a )
+	{
+		for ( b = 0; b < kc_way; ++b )
+		{
+			for ( c = 0; c < ic_way; ++c )
+			{
+				for ( d = 0; d < jr_way; ++d )
+				{
+					for ( e = 0; e < ir_way; ++e )
+					{
+						dim_t global_comm_id = a*jc_nt + b*kc_nt + c*ic_nt + d*jr_nt + e;
+						dim_t jc_comm_id     =           b*kc_nt + c*ic_nt + d*jr_nt + e;
+						dim_t kc_comm_id     =                     c*ic_nt + d*jr_nt + e;
+						dim_t ic_comm_id     =                               d*jr_nt + e;
+						dim_t jr_comm_id     =                                         e;
+
+						gemm_thrinfo_t* ir_info;
+						gemm_thrinfo_t* jr_info;
+						gemm_thrinfo_t* ic_info;
+						gemm_thrinfo_t* kc_info;
+						gemm_thrinfo_t* jc_info;
+
+						if ( jc_comm_id == 0 ) jc_comm = bli_thread_comm_create( jc_nt );
+						if ( kc_comm_id == 0 ) kc_comm = bli_thread_comm_create( kc_nt );
+						if ( ic_comm_id == 0 ) ic_comm = bli_thread_comm_create( ic_nt );
+						if ( jr_comm_id == 0 ) jr_comm = bli_thread_comm_create( jr_nt );
+
+						ir_info = bli_gemm_thrinfo_create( jr_comm, jr_comm_id,
+						                                   &BLIS_SINGLE_COMM, 0,
+						                                   ir_way, e,
+						                                   NULL );
+
+						jr_info = bli_gemm_thrinfo_create( ic_comm, ic_comm_id,
+						                                   jr_comm, jr_comm_id,
+						                                   jr_way, d,
+						                                   ir_info );
+
+						ic_info = bli_gemm_thrinfo_create( kc_comm, kc_comm_id,
+						                                   ic_comm, ic_comm_id,
+						                                   ic_way, c,
+						                                   jr_info );
+
+						kc_info = bli_gemm_thrinfo_create( jc_comm, jc_comm_id,
+						                                   kc_comm, kc_comm_id,
+						                                   kc_way, b,
+						                                   ic_info );
+
+						jc_info = bli_gemm_thrinfo_create( global_comm, global_comm_id,
+						                                   jc_comm, jc_comm_id,
+						                                   jc_way, a,
+						                                   kc_info );
+
+						paths[global_comm_id] = jc_info;
+					}
+				}
+			}
+		}
+	}
+
+	return paths;
+}
+
+
+void bli_gemm_thrinfo_free_paths( gemm_thrinfo_t** threads,
+                                  dim_t            n_threads )
+{
+	dim_t i;
+
+	// Nothing was allocated for the single-threaded case.
+	if ( threads == gemm_single_threaded_paths ) return;
+
+	for ( i = 0; i < n_threads; ++i )
+	{
+		gemm_thrinfo_t* thread = threads[i];
+		gemm_thrinfo_t* sub;
+
+		// The outermost communicator is shared by all threads; free it once.
+		if ( thread_am_ochief( thread ) )
+			bli_thread_comm_free( thread->ocomm );
+
+		// Every other communicator is the inner communicator of exactly one
+		// node, and is freed by the chief of the group that shares it.
+		while ( thread != NULL )
+		{
+			sub = gemm_thread_sub_gemm( thread );
+
+			if ( thread_am_ichief( thread ) )
+				bli_thread_comm_free( thread->icomm );
+
+			bli_packm_thrinfo_free( gemm_thread_opackm( thread ) );
+			bli_packm_thrinfo_free( gemm_thread_ipackm( thread ) );
+			bli_free( thread );
+
+			thread = sub;
+		}
+	}
+
+	bli_free( threads );
+}
+
@@ -0,0 +1,83 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+struct gemm_thrinfo_s
+{
+	// The fields below must appear first and in this order so that the
+	// thread_*() macros defined in bli_threading.h apply to this type.
+	thread_comm_t*         ocomm;
+	dim_t                  ocomm_id;
+	thread_comm_t*         icomm;
+	dim_t                  icomm_id;
+	dim_t                  n_way;
+	dim_t                  work_id;
+
+	// The thread info objects used to pack the objects shared by all of
+	// the threads of ocomm (opackm) and by the threads of this thread's
+	// sub-group (ipackm).
+	packm_thrinfo_t*       opackm;
+	packm_thrinfo_t*       ipackm;
+
+	// The thread info object for the node below the current node in the
+	// gemm control tree.
+	struct gemm_thrinfo_s* sub_gemm;
+};
+typedef struct gemm_thrinfo_s gemm_thrinfo_t;
+
+#define gemm_thread_sub_gemm( thread )  thread->sub_gemm
+#define gemm_thread_opackm( thread )    thread->opackm
+#define gemm_thread_ipackm( thread )    thread->ipackm
+
+// The thread info object used by all nodes when gemm is executed by a
+// single thread.
+extern gemm_thrinfo_t BLIS_GEMM_SINGLE_THREADED;
+
+gemm_thrinfo_t*  bli_gemm_thrinfo_create( thread_comm_t*  ocomm,
+                                          dim_t           ocomm_id,
+                                          thread_comm_t*  icomm,
+                                          dim_t           icomm_id,
+                                          dim_t           n_way,
+                                          dim_t           work_id,
+                                          gemm_thrinfo_t* sub_gemm );
+
+gemm_thrinfo_t** bli_gemm_thrinfo_create_paths( void );
+gemm_thrinfo_t** bli_gemm_thrinfo_create_paths_var5( void );
+gemm_thrinfo_t** bli_gemm_thrinfo_create_paths_ways( dim_t jc_way,
+                                                     dim_t kc_way,
+                                                     dim_t ic_way,
+                                                     dim_t jr_way,
+                                                     dim_t ir_way );
+void             bli_gemm_thrinfo_free_paths( gemm_thrinfo_t** threads,
+                                              dim_t            n_threads );
+
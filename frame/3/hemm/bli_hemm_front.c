@@ -46,6 +46,9 @@ void bli_hemm_front( side_t  side,
 	obj_t   b_local;
 	obj_t   c_local;
 
+	gemm_thrinfo_t** infos;
+	dim_t            n_threads;
+
 	// Check parameters.
 	if ( bli_error_checking_is_enabled() )
 		bli_hemm_check( side, alpha, a, b, beta, c );
@@ -80,12 +83,23 @@ void bli_hemm_front( side_t  side,
 		bli_obj_swap( a_local, b_local );
 	}
 
-	// Invoke the internal back-end.
-	bli_gemm_int( alpha,
-	              &a_local,
-	              &b_local,
-	              beta,
-	              &c_local,
-	              cntl );
+	// Create one path of thread info objects per thread, one node per
+	// level of the gemm control tree.
+	infos     = bli_gemm_thrinfo_create_paths();
+	n_threads = thread_num_threads( infos[0] );
+
+	// Invoke the internal back-end via the thread decorator.
+	bli_level3_thread_decorator( n_threads,
+	                             ( level3_int_t ) bli_gemm_int,
+	                             alpha,
+	                             &a_local,
+	                             &b_local,
+	                             beta,
+	                             &c_local,
+	                             ( void* ) cntl,
+	                             ( void** ) infos );
+
+	// Free the thread info objects.
+	bli_gemm_thrinfo_free_paths( infos, n_threads );
 }
 
@@ -48,6 +48,9 @@ void bli_her2k_front( obj_t*  alpha,
 	obj_t    b_local;
 	obj_t    ah_local;
 
+	herk_thrinfo_t** infos;
+	dim_t            n_threads;
+
 	// Check parameters.
 	if ( bli_error_checking_is_enabled() )
 		bli_her2k_check( alpha, a, b, beta, c );
@@ -97,6 +100,11 @@ void bli_her2k_front( obj_t*  alpha,
 		bli_obj_induce_trans( c_local );
 	}
 
+	// Create one path of thread info objects per thread, one node per
+	// level of the herk control tree.
+	infos     = bli_herk_thrinfo_create_paths();
+	n_threads = thread_num_threads( infos[0] );
+
 #if 0
 	// Invoke the internal back-end.
 	bli_her2k_int( alpha,
@@ -109,20 +117,30 @@ void bli_her2k_front( obj_t*  alpha,
 	               &c_local,
 	               cntl );
 #else
-	// Invoke herk twice, using beta only the first time.
-	bli_herk_int( alpha,
-	              &a_local,
-	              &bh_local,
-	              beta,
-	              &c_local,
-	              cntl );
-
-	bli_herk_int( &alpha_conj,
-	              &b_local,
-	              &ah_local,
-	              &BLIS_ONE,
-	              &c_local,
-	              cntl );
+	// Invoke herk twice (each via the thread decorator), using beta only
+	// the first time.
+	bli_level3_thread_decorator( n_threads,
+	                             ( level3_int_t ) bli_herk_int,
+	                             alpha,
+	                             &a_local,
+	                             &bh_local,
+	                             beta,
+	                             &c_local,
+	                             ( void* ) cntl,
+	                             ( void** ) infos );
+
+	bli_level3_thread_decorator( n_threads,
+	                             ( level3_int_t ) bli_herk_int,
+	                             &alpha_conj,
+	                             &b_local,
+	                             &ah_local,
+	                             &BLIS_ONE,
+	                             &c_local,
+	                             ( void* ) cntl,
+	                             ( void** ) infos );
 #endif
+
+	// Free the thread info objects.
+	bli_herk_thrinfo_free_paths( infos, n_threads );
 }
 
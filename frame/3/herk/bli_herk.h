@@ -33,6 +33,7 @@
 */
 
 #include "bli_herk_cntl.h"
+#include "bli_herk_threading.h"
 #include "bli_herk_check.h"
 #include "bli_herk_front.h"
 #include "bli_herk_int.h"
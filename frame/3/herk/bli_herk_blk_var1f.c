@@ -34,45 +34,83 @@
 
 #include "blis.h"
 
-void bli_herk_blk_var1f( obj_t*  a,
-                         obj_t*  ah,
-                         obj_t*  c,
-                         herk_t* cntl )
+void bli_herk_blk_var1f( obj_t*          a,
+                         obj_t*          ah,
+                         obj_t*          c,
+                         herk_t*         cntl,
+                         herk_thrinfo_t* thread )
 {
-	obj_t a1, a1_pack;
-	obj_t ah_pack;
-	obj_t c1, c1_pack;
+	obj_t  ah_pack_s;
+	obj_t  a1_pack_s, c1_pack_s;
+
+	obj_t  a1, c1;
+	obj_t* a1_pack;
+	obj_t* ah_pack;
+	obj_t* c1_pack;
+
+	dim_t  i;
+	dim_t  b_alg;
+	dim_t  m_trans;
+	dim_t  my_start, my_end;
+	uplo_t uplo;
+
+	// The chief of the threads sharing this node initializes the pack
+	// object for A' (which all of the threads share) and scales C.
+	if ( thread_am_ochief( thread ) )
+	{
+		// Initialize the pack object for A' that is passed into packm_init().
+		bli_obj_init_pack( &ah_pack_s );
 
-	dim_t i;
-	dim_t b_alg;
-	dim_t m_trans;
+		// Scale C by beta (if instructed).
+		bli_scalm_int( &BLIS_ONE,
+		               c,
+		               cntl_sub_scalm( cntl ) );
 
-	// Initialize all pack objects that are passed into packm_init().
-	bli_obj_init_pack( &a1_pack );
-	bli_obj_init_pack( &ah_pack );
-	bli_obj_init_pack( &c1_pack );
+		// Initialize object for packing A'.
+		bli_packm_init( ah, &ah_pack_s,
+		                cntl_sub_packm_b( cntl ) );
+	}
+	ah_pack = thread_obroadcast( thread, &ah_pack_s );
 
-	// Query dimension in partitioning direction.
-	m_trans = bli_obj_length_after_trans( *c );
+	// Pack A' (if instructed). All of the threads sharing this node
+	// cooperate in packing it.
+	bli_packm_int( ah, ah_pack,
+	               cntl_sub_packm_b( cntl ),
+	               herk_thread_opackm( thread ) );
 
-	// Scale C by beta (if instructed).
-	bli_scalm_int( &BLIS_ONE,
-	               c,
-	               cntl_sub_scalm( cntl ) );
+	// The chief of each sub-group initializes the pack objects for A1 and
+	// C1, which are shared by the threads of that sub-group.
+	if ( thread_am_ichief( thread ) )
+	{
+		bli_obj_init_pack( &a1_pack_s );
+		bli_obj_init_pack( &c1_pack_s );
+	}
+	a1_pack = thread_ibroadcast( thread, &a1_pack_s );
+	c1_pack = thread_ibroadcast( thread, &c1_pack_s );
 
-	// Initialize object for packing A'.
-	bli_packm_init( ah, &ah_pack,
-	                cntl_sub_packm_b( cntl ) );
+	// Query dimension in partitioning direction.
+	m_trans = bli_obj_length_after_trans( *c );
 
-	// Pack A' (if instructed).
-	bli_packm_int( ah, &ah_pack,
-	               cntl_sub_packm_b( cntl ) );
+	if ( bli_obj_is_lower( *c ) ) uplo = BLIS_LOWER;
+	else                          uplo = BLIS_UPPER;
+
+	// Determine the portion of the m dimension assigned to this thread's
+	// sub-group. Since only the stored triangle of C is updated, the
+	// sub-ranges are chosen to contain equal areas of that triangle.
+	bli_thread_get_range_weighted_t2b( thread_n_way( thread ),
+	                                   thread_work_id( thread ),
+	                                   bli_obj_diag_offset_after_trans( *c ),
+	                                   uplo,
+	                                   m_trans,
+	                                   bli_obj_width_after_trans( *c ),
+	                                   bli_blksz_mult_for_obj( a, cntl_blocksize( cntl ) ),
+	                                   &my_start, &my_end );
 
 	// Partition along the m dimension.
-	for ( i = 0; i < m_trans; i += b_alg )
+	for ( i = my_start; i < my_end; i += b_alg )
 	{
 		// Determine the current algorithmic blocksize.
-		b_alg = bli_determine_blocksize_f( i, m_trans, a,
+		b_alg = bli_determine_blocksize_f( i, my_end, a,
 		                                   cntl_blocksize( cntl ) );
 
 		// Acquire partitions for A1 and C1.
@@ -81,37 +119,55 @@ void bli_herk_blk_var1f( obj_t*  a,
 		bli_acquire_mpart_t2b( BLIS_SUBPART1,
 		                       i, b_alg, c, &c1 );
 
-		// Initialize objects for packing A1 and C1.
-		bli_packm_init( &a1, &a1_pack,
-		                cntl_sub_packm_a( cntl ) );
-		bli_packm_init( &c1, &c1_pack,
-		                cntl_sub_packm_c( cntl ) );
-
-		// Pack A1 (if instructed).
-		bli_packm_int( &a1, &a1_pack,
-		               cntl_sub_packm_a( cntl ) );
-
-		// Pack C1 (if instructed).
-		bli_packm_int( &c1, &c1_pack,
-		               cntl_sub_packm_c( cntl ) );
+		if ( thread_am_ichief( thread ) )
+		{
+			// Initialize objects for packing A1 and C1.
+			bli_packm_init( &a1, a1_pack,
+			                cntl_sub_packm_a( cntl ) );
+			bli_packm_init( &c1, c1_pack,
+			                cntl_sub_packm_c( cntl ) );
+		}
+		thread_ibarrier( thread );
+
+		// Pack A1 and C1 (if instructed). The threads of the sub-group
+		// cooperate in packing them.
+		bli_packm_int( &a1, a1_pack,
+		               cntl_sub_packm_a( cntl ),
+		               herk_thread_ipackm( thread ) );
+		bli_packm_int( &c1, c1_pack,
+		               cntl_sub_packm_c( cntl ),
+		               herk_thread_ipackm( thread ) );
 
 		// Perform herk subproblem.
 		bli_herk_int( &BLIS_ONE,
-		              &a1_pack,
-		              &ah_pack,
+		              a1_pack,
+		              ah_pack,
 		              &BLIS_ONE,
-		              &c1_pack,
-		              cntl_sub_herk( cntl ) );
+		              c1_pack,
+		              cntl_sub_herk( cntl ),
+		              herk_thread_sub_herk( thread ) );
+
+		// Wait for the sub-group to finish with A1 before its chief
+		// overwrites it in the next iteration.
+		thread_ibarrier( thread );
 
 		// Unpack C1 (if C1 was packed).
-		bli_unpackm_int( &c1_pack, &c1,
-		                 cntl_sub_unpackm_c( cntl ) );
+		if ( thread_am_ichief( thread ) )
+			bli_unpackm_int( c1_pack, &c1,
+			                 cntl_sub_unpackm_c( cntl ) );
 	}
 
+	// Wait for all of the threads to finish with A' before releasing it.
+	thread_obarrier( thread );
+
 	// If any packing buffers were acquired within packm, release them back
 	// to the memory manager.
-	bli_obj_release_pack( &a1_pack );
-	bli_obj_release_pack( &ah_pack );
-	bli_obj_release_pack( &c1_pack );
+	if ( thread_am_ochief( thread ) )
+		bli_obj_release_pack( ah_pack );
+	if ( thread_am_ichief( thread ) )
+	{
+		bli_obj_release_pack( a1_pack );
+		bli_obj_release_pack( c1_pack );
+	}
 }
 
@@ -32,8 +32,9 @@
 
 */
 
-void bli_herk_blk_var1f( obj_t*  a,
-                         obj_t*  ah,
-                         obj_t*  c,
-                         herk_t* cntl );
+void bli_herk_blk_var1f( obj_t*          a,
+                         obj_t*          ah,
+                         obj_t*          c,
+                         herk_t*         cntl,
+                         herk_thrinfo_t* thread );
 
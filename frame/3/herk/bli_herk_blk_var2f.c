@@ -34,52 +34,87 @@
 
 #include "blis.h"
 
-void bli_herk_blk_var2f( obj_t*  a,
-                         obj_t*  ah,
-                         obj_t*  c,
-                         herk_t* cntl )
+void bli_herk_blk_var2f( obj_t*          a,
+                         obj_t*          ah,
+                         obj_t*          c,
+                         herk_t*         cntl,
+                         herk_thrinfo_t* thread )
 {
-	obj_t a_pack, aS_pack;
-	obj_t ah1, ah1_pack;
-	obj_t c1;
-	obj_t c1S, c1S_pack;
-
-	dim_t i;
-	dim_t b_alg;
-	dim_t n_trans;
+	obj_t     a_pack_s;
+	obj_t     ah1_pack_s, c1S_pack_s;
+
+	obj_t     aS_pack;
+	obj_t     ah1, c1, c1S;
+	obj_t*    a_pack;
+	obj_t*    ah1_pack;
+	obj_t*    c1S_pack;
+
+	dim_t     i;
+	dim_t     b_alg;
+	dim_t     n_trans;
+	dim_t     my_start, my_end;
 	subpart_t stored_part;
+	uplo_t    uplo;
 
-	// Initialize all pack objects that are passed into packm_init().
-	bli_obj_init_pack( &a_pack );
-	bli_obj_init_pack( &ah1_pack );
-	bli_obj_init_pack( &c1S_pack );
+	// The chief of the threads sharing this node initializes the pack
+	// object for A (which all of the threads share) and scales C.
+	if ( thread_am_ochief( thread ) )
+	{
+		// Initialize the pack object for A that is passed into packm_init().
+		bli_obj_init_pack( &a_pack_s );
+
+		// Scale C by beta (if instructed).
+		bli_scalm_int( &BLIS_ONE,
+		               c,
+		               cntl_sub_scalm( cntl ) );
+
+		// Initialize object for packing A.
+		bli_packm_init( a, &a_pack_s,
+		                cntl_sub_packm_a( cntl ) );
+	}
+	a_pack = thread_obroadcast( thread, &a_pack_s );
+
+	// Pack A (if instructed). All of the threads sharing this node
+	// cooperate in packing it.
+	bli_packm_int( a, a_pack,
+	               cntl_sub_packm_a( cntl ),
+	               herk_thread_opackm( thread ) );
+
+	// The chief of each sub-group initializes the pack objects for A1'
+	// and C1, which are shared by the threads of that sub-group.
+	if ( thread_am_ichief( thread ) )
+	{
+		bli_obj_init_pack( &ah1_pack_s );
+		bli_obj_init_pack( &c1S_pack_s );
+	}
+	ah1_pack = thread_ibroadcast( thread, &ah1_pack_s );
+	c1S_pack = thread_ibroadcast( thread, &c1S_pack_s );
 
 	// The upper and lower variants are identical, except for which
 	// merged subpartition is acquired in the loop body.
-	if ( bli_obj_is_lower( *c ) ) stored_part = BLIS_SUBPART1B;
-	else                          stored_part = BLIS_SUBPART1T;
+	if ( bli_obj_is_lower( *c ) ) { stored_part = BLIS_SUBPART1B; uplo = BLIS_LOWER; }
+	else                          { stored_part = BLIS_SUBPART1T; uplo = BLIS_UPPER; }
 
 	// Query dimension in partitioning direction.
 	n_trans = bli_obj_width_after_trans( *c );
 
-	// Scale C by beta (if instructed).
-	bli_scalm_int( &BLIS_ONE,
-	               c,
-	               cntl_sub_scalm( cntl ) );
-
-	// Initialize object for packing A.
-	bli_packm_init( a, &a_pack,
-	                cntl_sub_packm_a( cntl ) );
-
-	// Pack A (if instructed).
-	bli_packm_int( a, &a_pack,
-	               cntl_sub_packm_a( cntl ) );
+	// Determine the portion of the n dimension assigned to this thread's
+	// sub-group. Since only the stored triangle of C is updated, the
+	// sub-ranges are chosen to contain equal areas of that triangle.
+	bli_thread_get_range_weighted_l2r( thread_n_way( thread ),
+	                                   thread_work_id( thread ),
+	                                   bli_obj_diag_offset_after_trans( *c ),
+	                                   uplo,
+	                                   bli_obj_length_after_trans( *c ),
+	                                   n_trans,
+	                                   bli_blksz_mult_for_obj( a, cntl_blocksize( cntl ) ),
+	                                   &my_start, &my_end );
 
 	// Partition along the n dimension.
-	for ( i = 0; i < n_trans; i += b_alg )
+	for ( i = my_start; i < my_end; i += b_alg )
 	{
 		// Determine the current algorithmic blocksize.
-		b_alg = bli_determine_blocksize_f( i, n_trans, a,
+		b_alg = bli_determine_blocksize_f( i, my_end, a,
 		                                   cntl_blocksize( cntl ) );
 
 		// Acquire partitions for A1' and C1.
@@ -93,39 +128,57 @@ void bli_herk_blk_var2f( obj_t*  a,
 		bli_acquire_mpart_t2b( stored_part,
 		                       i, b_alg, &c1, &c1S );
 		bli_acquire_mpart_t2b( stored_part,
-		                       i, b_alg, &a_pack, &aS_pack );
-
-		// Initialize objects for packing A1' and C1.
-		bli_packm_init( &ah1, &ah1_pack,
-		                cntl_sub_packm_b( cntl ) );
-		bli_packm_init( &c1S, &c1S_pack,
-		                cntl_sub_packm_c( cntl ) );
-
-		// Pack A1' (if instructed).
-		bli_packm_int( &ah1, &ah1_pack,
-		               cntl_sub_packm_b( cntl ) );
-
-		// Pack C1 (if instructed).
-		bli_packm_int( &c1S, &c1S_pack,
-		               cntl_sub_packm_c( cntl ) );
+		                       i, b_alg, a_pack, &aS_pack );
+
+		if ( thread_am_ichief( thread ) )
+		{
+			// Initialize objects for packing A1' and C1.
+			bli_packm_init( &ah1, ah1_pack,
+			                cntl_sub_packm_b( cntl ) );
+			bli_packm_init( &c1S, c1S_pack,
+			                cntl_sub_packm_c( cntl ) );
+		}
+		thread_ibarrier( thread );
+
+		// Pack A1' and C1 (if instructed). The threads of the sub-group
+		// cooperate in packing them.
+		bli_packm_int( &ah1, ah1_pack,
+		               cntl_sub_packm_b( cntl ),
+		               herk_thread_ipackm( thread ) );
+		bli_packm_int( &c1S, c1S_pack,
+		               cntl_sub_packm_c( cntl ),
+		               herk_thread_ipackm( thread ) );
 
 		// Perform herk subproblem.
 		bli_herk_int( &BLIS_ONE,
 		              &aS_pack,
-		              &ah1_pack,
+		              ah1_pack,
 		              &BLIS_ONE,
-		              &c1S_pack,
-		              cntl_sub_herk( cntl ) );
+		              c1S_pack,
+		              cntl_sub_herk( cntl ),
+		              herk_thread_sub_herk( thread ) );
+
+		// Wait for the sub-group to finish with A1' before its chief
+		// overwrites it in the next iteration.
+		thread_ibarrier( thread );
 
 		// Unpack C1 (if C1 was packed).
-		bli_unpackm_int( &c1S_pack, &c1S,
-		                 cntl_sub_unpackm_c( cntl ) );
+		if ( thread_am_ichief( thread ) )
+			bli_unpackm_int( c1S_pack, &c1S,
+			                 cntl_sub_unpackm_c( cntl ) );
 	}
 
+	// Wait for all of the threads to finish with A before releasing it.
+	thread_obarrier( thread );
+
 	// If any packing buffers were acquired within packm, release them back
 	// to the memory manager.
-	bli_obj_release_pack( &a_pack );
-	bli_obj_release_pack( &ah1_pack );
-	bli_obj_release_pack( &c1S_pack );
+	if ( thread_am_ochief( thread ) )
+		bli_obj_release_pack( a_pack );
+	if ( thread_am_ichief( thread ) )
+	{
+		bli_obj_release_pack( ah1_pack );
+		bli_obj_release_pack( c1S_pack );
+	}
 }
 
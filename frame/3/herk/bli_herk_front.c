@@ -44,6 +44,9 @@ void bli_herk_front( obj_t*  alpha,
 	obj_t   ah_local;
 	obj_t   c_local;
 
+	herk_thrinfo_t** infos;
+	dim_t            n_threads;
+
 	// Check parameters.
 	if ( bli_error_checking_is_enabled() )
 		bli_herk_check( alpha, a, beta, c );
@@ -77,12 +80,23 @@ void bli_herk_front( obj_t*  alpha,
 		bli_obj_induce_trans( c_local );
 	}
 
-	// Invoke the internal back-end.
-	bli_herk_int( alpha,
-	              &a_local,
-	              &ah_local,
-	              beta,
-	              &c_local,
-	              cntl );
+	// Create one path of thread info objects per thread, one node per
+	// level of the herk control tree.
+	infos     = bli_herk_thrinfo_create_paths();
+	n_threads = thread_num_threads( infos[0] );
+
+	// Invoke the internal back-end via the thread decorator.
+	bli_level3_thread_decorator( n_threads,
+	                             ( level3_int_t ) bli_herk_int,
+	                             alpha,
+	                             &a_local,
+	                             &ah_local,
+	                             beta,
+	                             &c_local,
+	                             ( void* ) cntl,
+	                             ( void** ) infos );
+
+	// Free the thread info objects.
+	bli_herk_thrinfo_free_paths( infos, n_threads );
 }
 
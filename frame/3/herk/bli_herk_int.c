@@ -36,10 +36,11 @@
 
 #define FUNCPTR_T herk_fp
 
-typedef void (*FUNCPTR_T)( obj_t*  a,
-                           obj_t*  ah,
-                           obj_t*  c,
-                           herk_t* cntl );
+typedef void (*FUNCPTR_T)( obj_t*          a,
+                           obj_t*          ah,
+                           obj_t*          c,
+                           herk_t*         cntl,
+                           herk_thrinfo_t* thread );
 
 static FUNCPTR_T vars[2][4][3] =
 {
@@ -61,12 +62,13 @@ static FUNCPTR_T vars[2][4][3] =
 	}
 };
 
-void bli_herk_int( obj_t*  alpha,
-                   obj_t*  a,
-                   obj_t*  ah,
-                   obj_t*  beta,
-                   obj_t*  c,
-                   herk_t* cntl )
+void bli_herk_int( obj_t*          alpha,
+                   obj_t*          a,
+                   obj_t*          ah,
+                   obj_t*          beta,
+                   obj_t*          c,
+                   herk_t*         cntl,
+                   herk_thrinfo_t* thread )
 {
 	obj_t     a_local;
 	obj_t     ah_local;
@@ -84,10 +86,13 @@ void bli_herk_int( obj_t*  alpha,
 	if ( bli_obj_has_zero_dim( *c ) ) return;
 
 	// If A or A' has a zero dimension, scale C by beta and return early.
+	// Only one of the threads that share C may scale it.
 	if ( bli_obj_has_zero_dim( *a ) ||
 	     bli_obj_has_zero_dim( *ah ) )
 	{
-		bli_scalm( beta, c );
+		if ( thread_am_ochief( thread ) )
+			bli_scalm( beta, c );
+		thread_obarrier( thread );
 		return;
 	}
 
@@ -138,6 +143,7 @@ void bli_herk_int( obj_t*  alpha,
 	f( &a_local,
 	   &ah_local,
 	   &c_local,
-	   cntl );
+	   cntl,
+	   thread );
 }
 
@@ -32,10 +32,11 @@
 
 */
 
-void bli_herk_int( obj_t*  alpha,
-                   obj_t*  a,
-                   obj_t*  ah,
-                   obj_t*  beta,
-                   obj_t*  c,
-                   herk_t* cntl );
+void bli_herk_int( obj_t*          alpha,
+                   obj_t*          a,
+                   obj_t*          ah,
+                   obj_t*          beta,
+                   obj_t*          c,
+                   herk_t*         cntl,
+                   herk_thrinfo_t* thread );
 
@@ -46,16 +46,19 @@ typedef void (*FUNCPTR_T)(
                            void*   b, inc_t rs_b, inc_t pd_b, inc_t ps_b,
                            void*   beta,
                            void*   c, inc_t rs_c, inc_t cs_c,
-                           void*   gemm_ukr
+                           void*   gemm_ukr,
+                           void*   gemm_edge_ukr,
+                           herk_thrinfo_t* thread
                          );
 
 static FUNCPTR_T GENARRAY(ftypes,herk_u_ker_var2);
 
 
-void bli_herk_u_ker_var2( obj_t*  a,
-                          obj_t*  b,
-                          obj_t*  c,
-                          herk_t* cntl )
+void bli_herk_u_ker_var2( obj_t*          a,
+                          obj_t*          b,
+                          obj_t*          c,
+                          herk_t*         cntl,
+                          herk_thrinfo_t* thread )
 {
 	num_t     dt_exec   = bli_obj_execution_datatype( *c );
 
@@ -89,6 +92,7 @@ void bli_herk_u_ker_var2( obj_t*  a,
 
 	func_t*   gemm_ukrs;
 	void*     gemm_ukr;
+	void*     gemm_edge_ukr;
 
 
 	// Detach and multiply the scalars attached to A and B.
@@ -111,6 +115,10 @@ void bli_herk_u_ker_var2( obj_t*  a,
 	gemm_ukrs = cntl_gemm_ukrs( cntl );
 	gemm_ukr  = bli_func_obj_query( dt_exec, gemm_ukrs );
 
+	// Query the edge micro-kernel, if any, that accompanies the gemm
+	// micro-kernel.
+	gemm_edge_ukr = bli_gemm_edge_ukr_query( dt_exec, gemm_ukrs );
+
 	// Invoke the function.
 	f( diagoffc,
 	   m,
@@ -121,7 +129,9 @@ void bli_herk_u_ker_var2( obj_t*  a,
 	   buf_b, rs_b, pd_b, ps_b,
 	   buf_beta,
 	   buf_c, rs_c, cs_c,
-	   gemm_ukr );
+	   gemm_ukr,
+	   gemm_edge_ukr,
+	   thread );
 }
 
 
@@ -138,11 +148,14 @@ void PASTEMAC(ch,varname)( \
                            void*   b, inc_t rs_b, inc_t pd_b, inc_t ps_b, \
                            void*   beta, \
                            void*   c, inc_t rs_c, inc_t cs_c, \
-                           void*   gemm_ukr  \
+                           void*   gemm_ukr, \
+                           void*   gemm_edge_ukr, \
+                           herk_thrinfo_t* thread  \
                          ) \
 { \
 	/* Cast the micro-kernel address to its function pointer type. */ \
 	PASTECH(ch,ukrtype) gemm_ukr_cast = gemm_ukr; \
+	PASTECH(ch,gemm_edge_ukr_t) gemm_edge_ukr_cast = gemm_edge_ukr; \
 \
 	/* Temporary C buffer for edge cases. */ \
 	ctype           ct[ PASTEMAC(ch,maxmr) * \
@@ -167,6 +180,9 @@ void PASTEMAC(ch,varname)( \
 	doff_t          diagoffc_ij; \
 	dim_t           m_iter, m_left; \
 	dim_t           n_iter, n_left; \
+	dim_t           jr_start, jr_end; \
+	dim_t           jr_num_threads, jr_thread_id; \
+	dim_t           ir_num_threads, ir_thread_id; \
 	dim_t           m_cur; \
 	dim_t           n_cur; \
 	dim_t           i, j, jp; \
@@ -244,18 +260,36 @@ void PASTEMAC(ch,varname)( \
 	bli_auxinfo_set_ps_a( ps_a, aux ); \
 	bli_auxinfo_set_ps_b( ps_b, aux ); \
 \
-	b1 = b_cast; \
-	c1 = c_cast; \
+	/* Query the number of threads and thread ids for the jr and ir
+	   loops. Since micro-tiles on the unstored side of the diagonal are
+	   skipped, the column panels of C do not all cost the same. Thus,
+	   the jr loop is partitioned into contiguous ranges of micro-panels
+	   that each span (roughly) the same area of the stored triangle,
+	   rather than the same number of columns. The ir loop is partitioned
+	   round-robin, as in gemm. */ \
+	jr_num_threads = thread_n_way( thread ); \
+	jr_thread_id   = thread_work_id( thread ); \
+	ir_num_threads = thread_n_way( herk_thread_sub_herk( thread ) ); \
+	ir_thread_id   = thread_work_id( herk_thread_sub_herk( thread ) ); \
+\
+	bli_thread_get_range_weighted_l2r( jr_num_threads, jr_thread_id, \
+	                                   diagoffc, BLIS_UPPER, m, n, NR, \
+	                                   &jr_start, &jr_end ); \
+\
+	/* Convert the column range into a range of micro-panels. (A range
+	   boundary is either a multiple of NR or equal to n.) */ \
+	jr_start = ( jr_start + NR - 1 ) / NR; \
+	jr_end   = ( jr_end + NR - 1 ) / NR; \
 \
 	/* Loop over the n dimension (NR columns at a time). */ \
-	for ( j = 0; j < n_iter; ++j ) \
+	for ( j = jr_start; j < jr_end; ++j ) \
 	{ \
 		ctype* restrict a1; \
 		ctype* restrict c11; \
 		ctype* restrict b2; \
 \
-		a1  = a_cast; \
-		c11 = c1; \
+		b1 = b_cast + j * cstep_b; \
+		c1 = c_cast + j * cstep_c; \
 \
 		n_cur = ( bli_is_not_edge_f( j, n_iter, n_left ) ? NR : n_left ); \
 \
@@ -263,9 +297,12 @@ void PASTEMAC(ch,varname)( \
 		b2 = b1; \
 \
 		/* Interior loop over the m dimension (MR rows at a time). */ \
-		for ( i = 0; i < m_iter; ++i ) \
+		for ( i = ir_thread_id; i < m_iter; i += ir_num_threads ) \
 		{ \
 			ctype* restrict a2; \
+\
+			a1  = a_cast + i * rstep_a; \
+			c11 = c1     + i * rstep_c; \
 \
 			/* Compute the diagonal offset for the submatrix at (i,j). */ \
 			diagoffc_ij = diagoffc - (doff_t)j*NR + (doff_t)i*MR; \
@@ -273,13 +310,13 @@ void PASTEMAC(ch,varname)( \
 			m_cur = ( bli_is_not_edge_f( i, m_iter, m_left ) ? MR : m_left ); \
 \
 			/* Compute the addresses of the next panels of A and B. */ \
-			a2 = a1 + rstep_a; \
-			if ( bli_is_last_iter( i, m_iter ) ) \
+			a2 = a1 + ir_num_threads * rstep_a; \
+			if ( bli_is_last_iter_rr( i, m_iter, ir_thread_id, ir_num_threads ) ) \
 			{ \
-				a2 = a_cast; \
+				a2 = a_cast + ir_thread_id * rstep_a; \
 				b2 = b1 + cstep_b; \
-				if ( bli_is_last_iter( j, n_iter ) ) \
-					b2 = b_cast; \
+				if ( bli_is_last_iter( j, jr_end ) ) \
+					b2 = b_cast + jr_start * cstep_b; \
 			} \
 \
 			/* Save addresses of next panels of A and B to the auxinfo_t
@@ -326,6 +363,20 @@ void PASTEMAC(ch,varname)( \
 					               c11, rs_c, cs_c, \
 					               &aux ); \
 				} \
+				else if ( gemm_edge_ukr_cast != NULL ) \
+				{ \
+					/* Invoke the edge micro-kernel, which updates only the
+					   m_cur x n_cur part of c11. */ \
+					gemm_edge_ukr_cast( m_cur, \
+					                    n_cur, \
+					                    k, \
+					                    alpha_cast, \
+					                    a1, \
+					                    b1, \
+					                    beta_cast, \
+					                    c11, rs_c, cs_c, \
+					                    &aux ); \
+				} \
 				else \
 				{ \
 					/* Invoke the gemm micro-kernel. */ \
@@ -344,13 +395,7 @@ void PASTEMAC(ch,varname)( \
 					                        c11, rs_c,  cs_c ); \
 				} \
 			} \
-\
-			a1  += rstep_a; \
-			c11 += rstep_c; \
 		} \
-\
-		b1 += cstep_b; \
-		c1 += cstep_c; \
 	} \
 }
 
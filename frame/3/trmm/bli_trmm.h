@@ -33,6 +33,7 @@
 */
 
 #include "bli_trmm_cntl.h"
+#include "bli_trmm_threading.h"
 #include "bli_trmm_check.h"
 #include "bli_trmm_front.h"
 #include "bli_trmm_int.h"
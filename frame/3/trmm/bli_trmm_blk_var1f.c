@@ -34,56 +34,105 @@
 
 #include "blis.h"
 
-void bli_trmm_blk_var1f( obj_t*  a,
-                         obj_t*  b,
-                         obj_t*  c,
-                         trmm_t* cntl )
+void bli_trmm_blk_var1f( obj_t*          a,
+                         obj_t*          b,
+                         obj_t*          c,
+                         trmm_t*         cntl,
+                         trmm_thrinfo_t* thread )
 {
-	obj_t a1, a1_pack;
-	obj_t b_pack;
-	obj_t c1, c1_pack;
+	obj_t  b_pack_s;
+	obj_t  a1_pack_s, c1_pack_s;
+
+	obj_t  a1, c1;
+	obj_t* a1_pack;
+	obj_t* b_pack;
+	obj_t* c1_pack;
+
+	dim_t  i;
+	dim_t  b_alg;
+	dim_t  m_trans;
+	dim_t  offA;
+	uplo_t uplo;
+	dim_t  my_start, my_end;
+
+	// The chief of the threads sharing this node initializes the pack
+	// object for B (which all of the threads share) and scales C.
+	if ( thread_am_ochief( thread ) )
+	{
+		// Initialize the pack object for B that is passed into packm_init().
+		bli_obj_init_pack( &b_pack_s );
+
+		// Scale C by beta (if instructed).
+		bli_scalm_int( &BLIS_ONE,
+		               c,
+		               cntl_sub_scalm( cntl ) );
 
-	dim_t i;
-	dim_t b_alg;
-	dim_t m_trans;
-	dim_t offA;
+		// Initialize object for packing B.
+		bli_packm_init( b, &b_pack_s,
+		                cntl_sub_packm_b( cntl ) );
+	}
+	b_pack = thread_obroadcast( thread, &b_pack_s );
 
-	// Initialize all pack objects that are passed into packm_init().
-	bli_obj_init_pack( &a1_pack );
-	bli_obj_init_pack( &b_pack );
-	bli_obj_init_pack( &c1_pack );
+	// Pack B (if instructed). All of the threads sharing this node
+	// cooperate in packing it.
+	bli_packm_int( b, b_pack,
+	               cntl_sub_packm_b( cntl ),
+	               trmm_thread_opackm( thread ) );
+
+	// The chief of each sub-group initializes the pack objects for A1 and
+	// C1, which are shared by the threads of that sub-group.
+	if ( thread_am_ichief( thread ) )
+	{
+		bli_obj_init_pack( &a1_pack_s );
+		bli_obj_init_pack( &c1_pack_s );
+	}
+	a1_pack = thread_ibroadcast( thread, &a1_pack_s );
+	c1_pack = thread_ibroadcast( thread, &c1_pack_s );
 
 	// Set the default length of and offset to the non-zero part of A.
 	m_trans = bli_obj_length_after_trans( *a );
 	offA    = 0;
+	uplo    = BLIS_DENSE;
 
 	// If A is lower triangular, we have to adjust where the non-zero part of
 	// A begins. If A is upper triangular, we have to adjust the length of
 	// the non-zero part. If A is general/dense, then we keep the defaults.
 	if      ( bli_obj_is_lower( *a ) )
+	{
 		offA    = bli_abs( bli_obj_diag_offset_after_trans( *a ) );
+		uplo    = BLIS_LOWER;
+	}
 	else if ( bli_obj_is_upper( *a ) )
+	{
 		m_trans = bli_abs( bli_obj_diag_offset_after_trans( *a ) ) +
 		          bli_obj_width_after_trans( *a );
+		uplo    = BLIS_UPPER;
+	}
 
-	// Scale C by beta (if instructed).
-	bli_scalm_int( &BLIS_ONE,
-	               c,
-	               cntl_sub_scalm( cntl ) );
-
-	// Initialize object for packing B.
-	bli_packm_init( b, &b_pack,
-	                cntl_sub_packm_b( cntl ) );
-
-	// Pack B (if instructed).
-	bli_packm_int( b, &b_pack,
-	               cntl_sub_packm_b( cntl ) );
+	// Determine the portion of the m dimension assigned to this thread's
+	// sub-group. Since the micro-kernels skip the zero region of A, the
+	// cost of a block of rows is proportional to the area of A that it
+	// spans, and so the sub-ranges are chosen to contain equal areas of
+	// A rather than equal numbers of rows. (If A is dense, as it is when
+	// the triangular matrix is on the right, the rows are split evenly.)
+	bli_thread_get_range_weighted_t2b( thread_n_way( thread ),
+	                                   thread_work_id( thread ),
+	                                   bli_obj_diag_offset_after_trans( *a ),
+	                                   uplo,
+	                                   bli_obj_length_after_trans( *a ),
+	                                   bli_obj_width_after_trans( *a ),
+	                                   bli_blksz_mult_for_obj( a, cntl_blocksize( cntl ) ),
+	                                   &my_start, &my_end );
+
+	// Skip the rows above or below the non-zero part of A.
+	my_start = bli_max( my_start, offA );
+	my_end   = bli_min( my_end, m_trans );
 
 	// Partition along the m dimension.
-	for ( i = offA; i < m_trans; i += b_alg )
+	for ( i = my_start; i < my_end; i += b_alg )
 	{
 		// Determine the current algorithmic blocksize.
-		b_alg = bli_determine_blocksize_f( i, m_trans, a,
+		b_alg = bli_determine_blocksize_f( i, my_end, a,
 		                                   cntl_blocksize( cntl ) );
 
 		// Acquire partitions for A1 and C1.
@@ -92,37 +141,55 @@ void bli_trmm_blk_var1f( obj_t*  a,
 		bli_acquire_mpart_t2b( BLIS_SUBPART1,
 		                       i, b_alg, c, &c1 );
 
-		// Initialize objects for packing A1 and C1.
-		bli_packm_init( &a1, &a1_pack,
-		                cntl_sub_packm_a( cntl ) );
-		bli_packm_init( &c1, &c1_pack,
-		                cntl_sub_packm_c( cntl ) );
-
-		// Pack A1 (if instructed).
-		bli_packm_int( &a1, &a1_pack,
-		               cntl_sub_packm_a( cntl ) );
-
-		// Pack C1 (if instructed).
-		bli_packm_int( &c1, &c1_pack,
-		               cntl_sub_packm_c( cntl ) );
+		if ( thread_am_ichief( thread ) )
+		{
+			// Initialize objects for packing A1 and C1.
+			bli_packm_init( &a1, a1_pack,
+			                cntl_sub_packm_a( cntl ) );
+			bli_packm_init( &c1, c1_pack,
+			                cntl_sub_packm_c( cntl ) );
+		}
+		thread_ibarrier( thread );
+
+		// Pack A1 and C1 (if instructed). The threads of the sub-group
+		// cooperate in packing them.
+		bli_packm_int( &a1, a1_pack,
+		               cntl_sub_packm_a( cntl ),
+		               trmm_thread_ipackm( thread ) );
+		bli_packm_int( &c1, c1_pack,
+		               cntl_sub_packm_c( cntl ),
+		               trmm_thread_ipackm( thread ) );
 
 		// Perform trmm subproblem.
 		bli_trmm_int( &BLIS_ONE,
-		              &a1_pack,
-		              &b_pack,
+		              a1_pack,
+		              b_pack,
 		              &BLIS_ONE,
-		              &c1_pack,
-		              cntl_sub_trmm( cntl ) );
+		              c1_pack,
+		              cntl_sub_trmm( cntl ),
+		              trmm_thread_sub_trmm( thread ) );
+
+		// Wait for the sub-group to finish with A1 before its chief
+		// overwrites it in the next iteration.
+		thread_ibarrier( thread );
 
 		// Unpack C1 (if C1 was packed).
-		bli_unpackm_int( &c1_pack, &c1,
-		                 cntl_sub_unpackm_c( cntl ) );
+		if ( thread_am_ichief( thread ) )
+			bli_unpackm_int( c1_pack, &c1,
+			                 cntl_sub_unpackm_c( cntl ) );
 	}
 
+	// Wait for all of the threads to finish with B before releasing it.
+	thread_obarrier( thread );
+
 	// If any packing buffers were acquired within packm, release them back
 	// to the memory manager.
-	bli_obj_release_pack( &a1_pack );
-	bli_obj_release_pack( &b_pack );
-	bli_obj_release_pack( &c1_pack );
+	if ( thread_am_ochief( thread ) )
+		bli_obj_release_pack( b_pack );
+	if ( thread_am_ichief( thread ) )
+	{
+		bli_obj_release_pack( a1_pack );
+		bli_obj_release_pack( c1_pack );
+	}
 }
 
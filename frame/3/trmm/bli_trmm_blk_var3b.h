@@ -32,8 +32,9 @@
 
 */
 
-void bli_trmm_blk_var3b( obj_t*  a,
-                         obj_t*  b,
-                         obj_t*  c,
-                         trmm_t* cntl );
+void bli_trmm_blk_var3b( obj_t*          a,
+                         obj_t*          b,
+                         obj_t*          c,
+                         trmm_t*         cntl,
+                         trmm_thrinfo_t* thread );
 
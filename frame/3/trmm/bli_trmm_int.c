@@ -36,10 +36,11 @@
 
 #define FUNCPTR_T trmm_fp
 
-typedef void (*FUNCPTR_T)( obj_t*  a,
-                           obj_t*  b,
-                           obj_t*  c,
-                           trmm_t* cntl );
+typedef void (*FUNCPTR_T)( obj_t*          a,
+                           obj_t*          b,
+                           obj_t*          c,
+                           trmm_t*         cntl,
+                           trmm_thrinfo_t* thread );
 
 static FUNCPTR_T vars[2][2][4][3] =
 {
@@ -83,12 +84,13 @@ static FUNCPTR_T vars[2][2][4][3] =
 	}
 };
 
-void bli_trmm_int( obj_t*  alpha,
-                   obj_t*  a,
-                   obj_t*  b,
-                   obj_t*  beta,
-                   obj_t*  c,
-                   trmm_t* cntl )
+void bli_trmm_int( obj_t*          alpha,
+                   obj_t*          a,
+                   obj_t*          b,
+                   obj_t*          beta,
+                   obj_t*          c,
+                   trmm_t*         cntl,
+                   trmm_thrinfo_t* thread )
 {
 	obj_t     a_local;
 	obj_t     b_local;
@@ -106,10 +108,13 @@ void bli_trmm_int( obj_t*  alpha,
 	if ( bli_obj_has_zero_dim( *c ) ) return;
 
 	// If A or B has a zero dimension, scale C by beta and return early.
+	// Only one of the threads that share C may scale it.
 	if ( bli_obj_has_zero_dim( *a ) ||
 	     bli_obj_has_zero_dim( *b ) )
 	{
-		bli_scalm( beta, c );
+		if ( thread_am_ochief( thread ) )
+			bli_scalm( beta, c );
+		thread_obarrier( thread );
 		return;
 	}
 
@@ -173,6 +178,7 @@ void bli_trmm_int( obj_t*  alpha,
 	f( &a_local,
 	   &b_local,
 	   &c_local,
-	   cntl );
+	   cntl,
+	   thread );
 }
 
@@ -32,9 +32,10 @@
 
 */
 
-void bli_trmm_int( obj_t*  alpha,
-                   obj_t*  a,
-                   obj_t*  b,
-                   obj_t*  beta,
-                   obj_t*  c,
-                   trmm_t* cntl );
+void bli_trmm_int( obj_t*          alpha,
+                   obj_t*          a,
+                   obj_t*          b,
+                   obj_t*          beta,
+                   obj_t*          c,
+                   trmm_t*         cntl,
+                   trmm_thrinfo_t* thread );
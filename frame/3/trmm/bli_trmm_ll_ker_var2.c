@@ -46,16 +46,19 @@ typedef void (*FUNCPTR_T)(
                            void*   b, inc_t rs_b, inc_t pd_b, inc_t ps_b,
                            void*   beta,
                            void*   c, inc_t rs_c, inc_t cs_c,
-                           void*   gemm_ukr
+                           void*   gemm_ukr,
+                           void*   gemm_edge_ukr,
+                           trmm_thrinfo_t* thread
                          );
 
 static FUNCPTR_T GENARRAY(ftypes,trmm_ll_ker_var2);
 
 
-void bli_trmm_ll_ker_var2( obj_t*  a,
-                           obj_t*  b,
-                           obj_t*  c,
-                           trmm_t* cntl )
+void bli_trmm_ll_ker_var2( obj_t*          a,
+                           obj_t*          b,
+                           obj_t*          c,
+                           trmm_t*         cntl,
+                           trmm_thrinfo_t* thread )
 {
 	num_t     dt_exec   = bli_obj_execution_datatype( *c );
 
@@ -89,6 +92,7 @@ void bli_trmm_ll_ker_var2( obj_t*  a,
 
 	func_t*   gemm_ukrs;
 	void*     gemm_ukr;
+	void*     gemm_edge_ukr;
 
 
 	// Detach and multiply the scalars attached to A and B.
@@ -121,6 +125,10 @@ void bli_trmm_ll_ker_var2( obj_t*  a,
 	gemm_ukrs = cntl_gemm_ukrs( cntl );
 	gemm_ukr  = bli_func_obj_query( dt_exec, gemm_ukrs );
 
+	// Query the edge micro-kernel, if any, that accompanies the gemm
+	// micro-kernel.
+	gemm_edge_ukr = bli_gemm_edge_ukr_query( dt_exec, gemm_ukrs );
+
 	// Invoke the function.
 	f( diagoffa,
 	   m,
@@ -131,7 +139,9 @@ void bli_trmm_ll_ker_var2( obj_t*  a,
 	   buf_b, rs_b, pd_b, ps_b,
 	   buf_beta,
 	   buf_c, rs_c, cs_c,
-	   gemm_ukr );
+	   gemm_ukr,
+	   gemm_edge_ukr,
+	   thread );
 }
 
 
@@ -148,11 +158,14 @@ void PASTEMAC(ch,varname)( \
                            void*   b, inc_t rs_b, inc_t pd_b, inc_t ps_b, \
                            void*   beta, \
                            void*   c, inc_t rs_c, inc_t cs_c, \
-                           void*   gemm_ukr  \
+                           void*   gemm_ukr, \
+                           void*   gemm_edge_ukr, \
+                           trmm_thrinfo_t* thread  \
                          ) \
 { \
 	/* Cast the micro-kernel address to its function pointer type. */ \
 	PASTECH(ch,ukrtype) gemm_ukr_cast = gemm_ukr; \
+	PASTECH(ch,gemm_edge_ukr_t) gemm_edge_ukr_cast = gemm_edge_ukr; \
 \
 	/* Temporary C buffer for edge cases. */ \
 	ctype           ct[ PASTEMAC(ch,maxmr) * \
@@ -185,6 +198,8 @@ void PASTEMAC(ch,varname)( \
 	dim_t           k_a1011; \
 	dim_t           off_a1011; \
 	dim_t           i, j; \
+	dim_t           jr_num_threads, jr_thread_id; \
+	dim_t           ir_num_threads, ir_thread_id; \
 	inc_t           rstep_a; \
 	inc_t           cstep_b; \
 	inc_t           rstep_c, cstep_c; \
@@ -268,15 +283,27 @@ void PASTEMAC(ch,varname)( \
 	/* Save the panel stride of B to the auxinfo_t object. */ \
 	bli_auxinfo_set_ps_b( ps_b, aux ); \
 \
-	b1 = b_cast; \
-	c1 = c_cast; \
+	/* Query the number of threads and thread ids for the jr and ir
+	   loops. The column panels of B are assigned to the jr threads in a
+	   round-robin fashion, as in gemm. Since the micro-panels of A along
+	   the diagonal are packed with varying lengths, the ir loop must step
+	   through every row panel of A to find the address of the next one;
+	   each ir thread only computes those iterations assigned to it in a
+	   round-robin fashion. */ \
+	jr_num_threads = thread_n_way( thread ); \
+	jr_thread_id   = thread_work_id( thread ); \
+	ir_num_threads = thread_n_way( trmm_thread_sub_trmm( thread ) ); \
+	ir_thread_id   = thread_work_id( trmm_thread_sub_trmm( thread ) ); \
 \
 	/* Loop over the n dimension (NR columns at a time). */ \
-	for ( j = 0; j < n_iter; ++j ) \
+	for ( j = jr_thread_id; j < n_iter; j += jr_num_threads ) \
 	{ \
 		ctype* restrict a1; \
 		ctype* restrict c11; \
 		ctype* restrict b2; \
+\
+		b1 = b_cast + j * cstep_b; \
+		c1 = c_cast + j * cstep_c; \
 \
 		a1  = a_cast; \
 		c11 = c1; \
@@ -310,57 +337,74 @@ void PASTEMAC(ch,varname)( \
 \
 				b1_i = b1 + off_a1011 * PACKNR; \
 \
-				/* Compute the addresses of the next panels of A and B. */ \
-				a2 = a1 + k_a1011 * ss_a; \
-				if ( bli_is_last_iter( i, m_iter ) ) \
-				{ \
-					a2 = a_cast; \
-					b2 = b1 + cstep_b; \
-					if ( bli_is_last_iter( j, n_iter ) ) \
-						b2 = b_cast; \
-				} \
-\
-				/* Save addresses of next panels of A and B to the auxinfo_t
-				   object. */ \
-				bli_auxinfo_set_next_a( a2, aux ); \
-				bli_auxinfo_set_next_b( b2, aux ); \
-\
-				/* Save the panel stride of the current panel of A to the
-				   auxinfo_t object. */ \
-				bli_auxinfo_set_ps_a( k_a1011 * ss_a, aux ); \
-\
-				/* Handle interior and edge cases separately. */ \
-				if ( m_cur == MR && n_cur == NR ) \
-				{ \
-					/* Invoke the gemm micro-kernel. */ \
-					gemm_ukr_cast( k_a1011, \
-					               alpha_cast, \
-					               a1, \
-					               b1_i, \
-					               beta_cast, \
-					               c11, rs_c, cs_c, \
-					               &aux ); \
-				} \
-				else \
+				if ( i % ir_num_threads == ir_thread_id ) \
 				{ \
-					/* Copy edge elements of C to the temporary buffer. */ \
-					PASTEMAC(ch,copys_mxn)( m_cur, n_cur, \
-					                        c11, rs_c,  cs_c, \
-					                        ct,  rs_ct, cs_ct ); \
-\
-					/* Invoke the gemm micro-kernel. */ \
-					gemm_ukr_cast( k_a1011, \
-					               alpha_cast, \
-					               a1, \
-					               b1_i, \
-					               beta_cast, \
-					               ct, rs_ct, cs_ct, \
-					               &aux ); \
-\
-					/* Copy the result to the edge of C. */ \
-					PASTEMAC(ch,copys_mxn)( m_cur, n_cur, \
-					                        ct,  rs_ct, cs_ct, \
-					                        c11, rs_c,  cs_c ); \
+					/* Compute the addresses of the next panels of A and B. */ \
+					a2 = a1 + k_a1011 * ss_a; \
+					if ( bli_is_last_iter_rr( i, m_iter, ir_thread_id, ir_num_threads ) ) \
+					{ \
+						a2 = a_cast; \
+						b2 = b1 + jr_num_threads * cstep_b; \
+						if ( bli_is_last_iter_rr( j, n_iter, jr_thread_id, jr_num_threads ) ) \
+							b2 = b_cast + jr_thread_id * cstep_b; \
+					} \
+\
+					/* Save addresses of next panels of A and B to the auxinfo_t
+					   object. */ \
+					bli_auxinfo_set_next_a( a2, aux ); \
+					bli_auxinfo_set_next_b( b2, aux ); \
+\
+					/* Save the panel stride of the current panel of A to the
+					   auxinfo_t object. */ \
+					bli_auxinfo_set_ps_a( k_a1011 * ss_a, aux ); \
+\
+					/* Handle interior and edge cases separately. */ \
+					if ( m_cur == MR && n_cur == NR ) \
+					{ \
+						/* Invoke the gemm micro-kernel. */ \
+						gemm_ukr_cast( k_a1011, \
+						               alpha_cast, \
+						               a1, \
+						               b1_i, \
+						               beta_cast, \
+						               c11, rs_c, cs_c, \
+						               &aux ); \
+					} \
+					else if ( gemm_edge_ukr_cast != NULL ) \
+					{ \
+						/* Invoke the edge micro-kernel, which updates only the
+						   m_cur x n_cur part of c11. */ \
+						gemm_edge_ukr_cast( m_cur, \
+						                    n_cur, \
+						                    k_a1011, \
+						                    alpha_cast, \
+						                    a1, \
+						                    b1_i, \
+						                    beta_cast, \
+						                    c11, rs_c, cs_c, \
+						                    &aux ); \
+					} \
+					else \
+					{ \
+						/* Copy edge elements of C to the temporary buffer. */ \
+						PASTEMAC(ch,copys_mxn)( m_cur, n_cur, \
+						                        c11, rs_c,  cs_c, \
+						                        ct,  rs_ct, cs_ct ); \
+\
+						/* Invoke the gemm micro-kernel. */ \
+						gemm_ukr_cast( k_a1011, \
+						               alpha_cast, \
+						               a1, \
+						               b1_i, \
+						               beta_cast, \
+						               ct, rs_ct, cs_ct, \
+						               &aux ); \
+\
+						/* Copy the result to the edge of C. */ \
+						PASTEMAC(ch,copys_mxn)( m_cur, n_cur, \
+						                        ct,  rs_ct, cs_ct, \
+						                        c11, rs_c,  cs_c ); \
+					} \
 				} \
 \
 				a1 += k_a1011 * ss_a; \
@@ -369,52 +413,69 @@ void PASTEMAC(ch,varname)( \
 			{ \
 				ctype* restrict a2; \
 \
-				/* Compute the addresses of the next panels of A and B. */ \
-				a2 = a1 + rstep_a; \
-				if ( bli_is_last_iter( i, m_iter ) ) \
+				if ( i % ir_num_threads == ir_thread_id ) \
 				{ \
-					a2 = a_cast; \
-					b2 = b1 + cstep_b; \
-					if ( bli_is_last_iter( j, n_iter ) ) \
-						b2 = b_cast; \
-				} \
-\
-				/* Save addresses of next panels of A and B to the auxinfo_t
-				   object. */ \
-				bli_auxinfo_set_next_a( a2, aux ); \
-				bli_auxinfo_set_next_b( b2, aux ); \
-\
-				/* Save the panel stride of the current panel of A to the
-				   auxinfo_t object. */ \
-				bli_auxinfo_set_ps_a( rstep_a, aux ); \
-\
-				/* Handle interior and edge cases separately. */ \
-				if ( m_cur == MR && n_cur == NR ) \
-				{ \
-					/* Invoke the gemm micro-kernel. */ \
-					gemm_ukr_cast( k, \
-					               alpha_cast, \
-					               a1, \
-					               b1, \
-					               one, \
-					               c11, rs_c, cs_c, \
-					               &aux ); \
-				} \
-				else \
-				{ \
-					/* Invoke the gemm micro-kernel. */ \
-					gemm_ukr_cast( k, \
-					               alpha_cast, \
-					               a1, \
-					               b1, \
-					               zero, \
-					               ct, rs_ct, cs_ct, \
-					               &aux ); \
-\
-					/* Add the result to the edge of C. */ \
-					PASTEMAC(ch,adds_mxn)( m_cur, n_cur, \
-					                       ct,  rs_ct, cs_ct, \
-					                       c11, rs_c,  cs_c ); \
+					/* Compute the addresses of the next panels of A and B. */ \
+					a2 = a1 + rstep_a; \
+					if ( bli_is_last_iter_rr( i, m_iter, ir_thread_id, ir_num_threads ) ) \
+					{ \
+						a2 = a_cast; \
+						b2 = b1 + jr_num_threads * cstep_b; \
+						if ( bli_is_last_iter_rr( j, n_iter, jr_thread_id, jr_num_threads ) ) \
+							b2 = b_cast + jr_thread_id * cstep_b; \
+					} \
+\
+					/* Save addresses of next panels of A and B to the auxinfo_t
+					   object. */ \
+					bli_auxinfo_set_next_a( a2, aux ); \
+					bli_auxinfo_set_next_b( b2, aux ); \
+\
+					/* Save the panel stride of the current panel of A to the
+					   auxinfo_t object. */ \
+					bli_auxinfo_set_ps_a( rstep_a, aux ); \
+\
+					/* Handle interior and edge cases separately. */ \
+					if ( m_cur == MR && n_cur == NR ) \
+					{ \
+						/* Invoke the gemm micro-kernel. */ \
+						gemm_ukr_cast( k, \
+						               alpha_cast, \
+						               a1, \
+						               b1, \
+						               one, \
+						               c11, rs_c, cs_c, \
+						               &aux ); \
+					} \
+					else if ( gemm_edge_ukr_cast != NULL ) \
+					{ \
+						/* Invoke the edge micro-kernel, which updates only the
+						   m_cur x n_cur part of c11. */ \
+						gemm_edge_ukr_cast( m_cur, \
+						                    n_cur, \
+						                    k, \
+						                    alpha_cast, \
+						                    a1, \
+						                    b1, \
+						                    one, \
+						                    c11, rs_c, cs_c, \
+						                    &aux ); \
+					} \
+					else \
+					{ \
+						/* Invoke the gemm micro-kernel. */ \
+						gemm_ukr_cast( k, \
+						               alpha_cast, \
+						               a1, \
+						               b1, \
+						               zero, \
+						               ct, rs_ct, cs_ct, \
+						               &aux ); \
+\
+						/* Add the result to the edge of C. */ \
+						PASTEMAC(ch,adds_mxn)( m_cur, n_cur, \
+						                       ct,  rs_ct, cs_ct, \
+						                       c11, rs_c,  cs_c ); \
+					} \
 				} \
 \
 				a1 += rstep_a; \
@@ -422,9 +483,6 @@ void PASTEMAC(ch,varname)( \
 \
 			c11 += rstep_c; \
 		} \
-\
-		b1 += cstep_b; \
-		c1 += cstep_c; \
 	} \
 }
 
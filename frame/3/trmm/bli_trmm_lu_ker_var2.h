@@ -36,10 +36,11 @@
 //
 // Prototype object-based interface.
 //
-void bli_trmm_lu_ker_var2( obj_t*  a,
-                           obj_t*  b,
-                           obj_t*  c,
-                           trmm_t* cntl );
+void bli_trmm_lu_ker_var2( obj_t*          a,
+                           obj_t*          b,
+                           obj_t*          c,
+                           trmm_t*         cntl,
+                           trmm_thrinfo_t* thread );
 
 
 //
@@ -58,7 +59,9 @@ void PASTEMAC(ch,varname)( \
                            void*   b, inc_t rs_b, inc_t pd_b, inc_t ps_b, \
                            void*   beta, \
                            void*   c, inc_t rs_c, inc_t cs_c, \
-                           void*   gemm_ukr  \
+                           void*   gemm_ukr, \
+                           void*   gemm_edge_ukr, \
+                           trmm_thrinfo_t* thread  \
                          );
 
 INSERT_GENTPROT_BASIC( trmm_lu_ker_var2 )
@@ -46,16 +46,19 @@ typedef void (*FUNCPTR_T)(
                            void*   b, inc_t rs_b, inc_t pd_b, inc_t ps_b,
                            void*   beta,
                            void*   c, inc_t rs_c, inc_t cs_c,
-                           void*   gemm_ukr
+                           void*   gemm_ukr,
+                           void*   gemm_edge_ukr,
+                           trmm_thrinfo_t* thread
                          );
 
 static FUNCPTR_T GENARRAY(ftypes,trmm_ru_ker_var2);
 
 
-void bli_trmm_ru_ker_var2( obj_t*  a,
-                           obj_t*  b,
-                           obj_t*  c,
-                           trmm_t* cntl )
+void bli_trmm_ru_ker_var2( obj_t*          a,
+                           obj_t*          b,
+                           obj_t*          c,
+                           trmm_t*         cntl,
+                           trmm_thrinfo_t* thread )
 {
 	num_t     dt_exec   = bli_obj_execution_datatype( *c );
 
@@ -89,6 +92,7 @@ void bli_trmm_ru_ker_var2( obj_t*  a,
 
 	func_t*   gemm_ukrs;
 	void*     gemm_ukr;
+	void*     gemm_edge_ukr;
 
 
 	// Detach and multiply the scalars attached to A and B.
@@ -121,6 +125,10 @@ void bli_trmm_ru_ker_var2( obj_t*  a,
 	gemm_ukrs = cntl_gemm_ukrs( cntl );
 	gemm_ukr  = bli_func_obj_query( dt_exec, gemm_ukrs );
 
+	// Query the edge micro-kernel, if any, that accompanies the gemm
+	// micro-kernel.
+	gemm_edge_ukr = bli_gemm_edge_ukr_query( dt_exec, gemm_ukrs );
+
 	// Invoke the function.
 	f( diagoffb,
 	   m,
@@ -131,7 +139,9 @@ void bli_trmm_ru_ker_var2( obj_t*  a,
 	   buf_b, rs_b, pd_b, ps_b,
 	   buf_beta,
 	   buf_c, rs_c, cs_c,
-	   gemm_ukr );
+	   gemm_ukr,
+	   gemm_edge_ukr,
+	   thread );
 }
 
 
@@ -148,11 +158,14 @@ void PASTEMAC(ch,varname)( \
                            void*   b, inc_t rs_b, inc_t pd_b, inc_t ps_b, \
                            void*   beta, \
                            void*   c, inc_t rs_c, inc_t cs_c, \
-                           void*   gemm_ukr  \
+                           void*   gemm_ukr, \
+                           void*   gemm_edge_ukr, \
+                           trmm_thrinfo_t* thread  \
                          ) \
 { \
 	/* Cast the micro-kernel address to its function pointer type. */ \
 	PASTECH(ch,ukrtype) gemm_ukr_cast = gemm_ukr; \
+	PASTECH(ch,gemm_edge_ukr_t) gemm_edge_ukr_cast = gemm_edge_ukr; \
 \
 	/* Temporary C buffer for edge cases. */ \
 	ctype           ct[ PASTEMAC(ch,maxmr) * \
@@ -185,6 +198,9 @@ void PASTEMAC(ch,varname)( \
 	dim_t           k_b0111; \
 	dim_t           off_b0111; \
 	dim_t           i, j; \
+	dim_t           jr_num_threads, jr_thread_id; \
+	dim_t           ir_num_threads, ir_thread_id; \
+	dim_t           jr_start, jr_end; \
 	inc_t           rstep_a; \
 	inc_t           cstep_b; \
 	inc_t           rstep_c, cstep_c; \
@@ -275,20 +291,43 @@ void PASTEMAC(ch,varname)( \
 \
 	/* Save the panel stride of A to the auxinfo_t object. */ \
 	bli_auxinfo_set_ps_a( ps_a, aux ); \
+\
+	/* Query the number of threads and thread ids for the jr and ir
+	   loops. Since the length of each packed micro-panel of B depends on
+	   where it lies relative to the diagonal, the column panels do not
+	   all cost the same. Thus, the jr loop is partitioned into contiguous
+	   ranges of micro-panels that each span (roughly) the same area of
+	   the stored region of B. The ir loop is partitioned round-robin, as
+	   in gemm. */ \
+	jr_num_threads = thread_n_way( thread ); \
+	jr_thread_id   = thread_work_id( thread ); \
+	ir_num_threads = thread_n_way( trmm_thread_sub_trmm( thread ) ); \
+	ir_thread_id   = thread_work_id( trmm_thread_sub_trmm( thread ) ); \
+\
+	bli_thread_get_range_weighted_l2r( jr_num_threads, jr_thread_id, \
+	                                   diagoffb, BLIS_UPPER, k, n, NR, \
+	                                   &jr_start, &jr_end ); \
+\
+	/* Convert the column range into a range of micro-panels. (A range
+	   boundary is either a multiple of NR or equal to n.) */ \
+	jr_start = ( jr_start + NR - 1 ) / NR; \
+	jr_end   = ( jr_end + NR - 1 ) / NR; \
 \
 	b1 = b_cast; \
 	c1 = c_cast; \
 \
-	/* Loop over the n dimension (NR columns at a time). */ \
-	for ( j = 0; j < n_iter; ++j ) \
+	/* Loop over the n dimension (NR columns at a time). Since the packed
+	   micro-panels of B vary in length, we must step through the panels
+	   that precede our range to find the first one. */ \
+	for ( j = 0; j < jr_end; ++j ) \
 	{ \
 		ctype* restrict a1; \
 		ctype* restrict c11; \
 		ctype* restrict b2; \
 \
 		diagoffb_j = diagoffb - ( doff_t )j*NR; \
-		a1         = a_cast; \
-		c11        = c1; \
+		a1         = a_cast + ir_thread_id * rstep_a; \
+		c11        = c1     + ir_thread_id * rstep_c; \
 \
 		n_cur = ( bli_is_not_edge_f( j, n_iter, n_left ) ? NR : n_left ); \
 \
@@ -296,6 +335,14 @@ void PASTEMAC(ch,varname)( \
 		   so we can index into the corresponding location in A. */ \
 		off_b0111 = 0; \
 		k_b0111   = bli_min( k, -diagoffb_j + NR ); \
+\
+		/* Skip over the micro-panels of B assigned to other threads. */ \
+		if ( j < jr_start ) \
+		{ \
+			b1 += k_b0111 * ss_b; \
+			c1 += cstep_c; \
+			continue; \
+		} \
 \
 		/* Initialize our next panel of B to be the current panel of B. */ \
 		b2 = b1; \
@@ -311,7 +358,7 @@ void PASTEMAC(ch,varname)( \
 		if ( bli_intersects_diag_n( diagoffb_j, k, NR ) ) \
 		{ \
 			/* Loop over the m dimension (MR rows at a time). */ \
-			for ( i = 0; i < m_iter; ++i ) \
+			for ( i = ir_thread_id; i < m_iter; i += ir_num_threads ) \
 			{ \
 				ctype* restrict a1_i; \
 				ctype* restrict a2; \
@@ -321,12 +368,12 @@ void PASTEMAC(ch,varname)( \
 				a1_i = a1 + off_b0111 * PACKMR; \
 \
 				/* Compute the addresses of the next panels of A and B. */ \
-				a2 = a1 + rstep_a; \
-				if ( bli_is_last_iter( i, m_iter ) ) \
+				a2 = a1 + ir_num_threads * rstep_a; \
+				if ( bli_is_last_iter_rr( i, m_iter, ir_thread_id, ir_num_threads ) ) \
 				{ \
-					a2 = a_cast; \
+					a2 = a_cast + ir_thread_id * rstep_a; \
 					b2 = b1 + k_b0111 * ss_b; \
-					if ( bli_is_last_iter( j, n_iter ) ) \
+					if ( bli_is_last_iter( j, jr_end ) ) \
 						b2 = b_cast; \
 				} \
 \
@@ -347,6 +394,20 @@ void PASTEMAC(ch,varname)( \
 					               c11, rs_c, cs_c, \
 					               &aux ); \
 				} \
+				else if ( gemm_edge_ukr_cast != NULL ) \
+				{ \
+					/* Invoke the edge micro-kernel, which updates only the
+					   m_cur x n_cur part of c11. */ \
+					gemm_edge_ukr_cast( m_cur, \
+					                    n_cur, \
+					                    k_b0111, \
+					                    alpha_cast, \
+					                    a1_i, \
+					                    b1, \
+					                    beta_cast, \
+					                    c11, rs_c, cs_c, \
+					                    &aux ); \
+				} \
 				else \
 				{ \
 					/* Copy edge elements of C to the temporary buffer. */ \
@@ -369,26 +430,26 @@ void PASTEMAC(ch,varname)( \
 					                        c11, rs_c,  cs_c ); \
 				} \
 \
-				a1  += rstep_a; \
-				c11 += rstep_c; \
+				a1  += ir_num_threads * rstep_a; \
+				c11 += ir_num_threads * rstep_c; \
 			} \
 		} \
 		else if ( bli_is_strictly_above_diag_n( diagoffb_j, k, NR ) ) \
 		{ \
 			/* Loop over the m dimension (MR rows at a time). */ \
-			for ( i = 0; i < m_iter; ++i ) \
+			for ( i = ir_thread_id; i < m_iter; i += ir_num_threads ) \
 			{ \
 				ctype* restrict a2; \
 \
 				m_cur = ( bli_is_not_edge_f( i, m_iter, m_left ) ? MR : m_left ); \
 \
 				/* Compute the addresses of the next panels of A and B. */ \
-				a2 = a1 + rstep_a; \
-				if ( bli_is_last_iter( i, m_iter ) ) \
+				a2 = a1 + ir_num_threads * rstep_a; \
+				if ( bli_is_last_iter_rr( i, m_iter, ir_thread_id, ir_num_threads ) ) \
 				{ \
-					a2 = a_cast; \
+					a2 = a_cast + ir_thread_id * rstep_a; \
 					b2 = b1 + cstep_b; \
-					if ( bli_is_last_iter( j, n_iter ) ) \
+					if ( bli_is_last_iter( j, jr_end ) ) \
 						b2 = b_cast; \
 				} \
 \
@@ -409,6 +470,20 @@ void PASTEMAC(ch,varname)( \
 					               c11, rs_c, cs_c, \
 					               &aux ); \
 				} \
+				else if ( gemm_edge_ukr_cast != NULL ) \
+				{ \
+					/* Invoke the edge micro-kernel, which updates only the
+					   m_cur x n_cur part of c11. */ \
+					gemm_edge_ukr_cast( m_cur, \
+					                    n_cur, \
+					                    k, \
+					                    alpha_cast, \
+					                    a1, \
+					                    b1, \
+					                    one, \
+					                    c11, rs_c, cs_c, \
+					                    &aux ); \
+				} \
 				else \
 				{ \
 					/* Invoke the gemm micro-kernel. */ \
@@ -426,8 +501,8 @@ void PASTEMAC(ch,varname)( \
 					                       c11, rs_c,  cs_c ); \
 				} \
 \
-				a1  += rstep_a; \
-				c11 += rstep_c; \
+				a1  += ir_num_threads * rstep_a; \
+				c11 += ir_num_threads * rstep_c; \
 			} \
 		} \
 \
@@ -0,0 +1,65 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+trmm_thrinfo_t** bli_trmm_thrinfo_create_paths( side_t side )
+{
+	dim_t jc_way = bli_thread_get_jc_nt();
+	dim_t ic_way = bli_thread_get_ic_nt();
+	dim_t jr_way = bli_thread_get_jr_nt();
+	dim_t ir_way = bli_thread_get_ir_nt();
+
+	// When multiplying from the left, the columns of B are independent,
+	// and so are the rows of the product once the current panel of B has
+	// been packed. Thus, every loop may be split except the kc loop
+	// (blk_var3), just as with gemm. When multiplying from the right, the
+	// product overwrites columns of B that the blocks to the right (or
+	// left) still need to read, and so the jc loop (blk_var2) must remain
+	// sequential. We fold the threads requested for it into the ic loop
+	// (blk_var1), over which the rows of B are independent.
+	if ( bli_is_left( side ) )
+		return bli_gemm_thrinfo_create_paths_ways( jc_way,
+		                                           1,
+		                                           ic_way,
+		                                           jr_way,
+		                                           ir_way );
+	else
+		return bli_gemm_thrinfo_create_paths_ways( 1,
+		                                           1,
+		                                           jc_way * ic_way,
+		                                           jr_way,
+		                                           ir_way );
+}
+
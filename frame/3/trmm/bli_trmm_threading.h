@@ -0,0 +1,50 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// The trmm control tree has the same shape as that of gemm (jc -> kc ->
+// ic -> jr -> ir), and so trmm reuses gemm's thread info type. However,
+// since B is overwritten in place, not every loop may be split among
+// threads, and so trmm creates its own per-thread paths.
+typedef gemm_thrinfo_t trmm_thrinfo_t;
+
+#define trmm_thread_sub_trmm( thread )  gemm_thread_sub_gemm( thread )
+#define trmm_thread_opackm( thread )    gemm_thread_opackm( thread )
+#define trmm_thread_ipackm( thread )    gemm_thread_ipackm( thread )
+
+#define BLIS_TRMM_SINGLE_THREADED       BLIS_GEMM_SINGLE_THREADED
+
+trmm_thrinfo_t** bli_trmm_thrinfo_create_paths( side_t side );
+
+#define bli_trmm_thrinfo_free_paths     bli_gemm_thrinfo_free_paths
+
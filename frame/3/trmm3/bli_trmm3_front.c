@@ -43,10 +43,12 @@ void bli_trmm3_front( side_t  side,
                       trmm_t* l_cntl,
                       trmm_t* r_cntl )
 {
-	trmm_t* cntl;
-	obj_t   a_local;
-	obj_t   b_local;
-	obj_t   c_local;
+	trmm_t*          cntl;
+	obj_t            a_local;
+	obj_t            b_local;
+	obj_t            c_local;
+	trmm_thrinfo_t** infos;
+	dim_t            n_threads;
 
 	// Check parameters.
 	if ( bli_error_checking_is_enabled() )
@@ -127,12 +129,24 @@ void bli_trmm3_front( side_t  side,
 	if ( bli_is_left( side ) ) cntl = l_cntl;
 	else                       cntl = r_cntl;
 
-	// Invoke the internal back-end.
-	bli_trmm_int( alpha,
-	              &a_local,
-	              &b_local,
-	              beta,
-	              &c_local,
-	              cntl );
+	// Create one path of thread info objects per thread, one node per
+	// level of the trmm control tree. This must wait until the side is
+	// final since it determines which loops may be split among threads.
+	infos     = bli_trmm_thrinfo_create_paths( side );
+	n_threads = thread_num_threads( infos[0] );
+
+	// Invoke the internal back-end via the thread decorator.
+	bli_level3_thread_decorator( n_threads,
+	                             ( level3_int_t ) bli_trmm_int,
+	                             alpha,
+	                             &a_local,
+	                             &b_local,
+	                             beta,
+	                             &c_local,
+	                             ( void* ) cntl,
+	                             ( void** ) infos );
+
+	// Free the thread info objects.
+	bli_trmm_thrinfo_free_paths( infos, n_threads );
 }
 
@@ -33,6 +33,7 @@
 */
 
 #include "bli_trsm_cntl.h"
+#include "bli_trsm_threading.h"
 #include "bli_trsm_check.h"
 #include "bli_trsm_front.h"
 #include "bli_trsm_int.h"
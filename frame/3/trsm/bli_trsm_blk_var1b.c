@@ -34,23 +34,49 @@
 
 #include "blis.h"
 
-void bli_trsm_blk_var1b( obj_t*  a,
-                         obj_t*  b,
-                         obj_t*  c,
-                         trsm_t* cntl )
+void bli_trsm_blk_var1b( obj_t*          a,
+                         obj_t*          b,
+                         obj_t*          c,
+                         trsm_t*         cntl,
+                         trsm_thrinfo_t* thread )
 {
-	obj_t a1, a1_pack;
-	obj_t b_pack;
-	obj_t c1;
+	obj_t  b_pack_s;
+	obj_t  a1_pack_s;
+
+	obj_t  a1, c1;
+	obj_t* a1_pack;
+	obj_t* b_pack;
+
+	dim_t  i;
+	dim_t  b_alg;
+	dim_t  m_trans;
+	dim_t  offA;
+	dim_t  my_start, my_end;
+
+	// The chief of the threads sharing this node initializes the pack
+	// object for B (which all of the threads share).
+	if ( thread_am_ochief( thread ) )
+	{
+		// Initialize the pack object for B that is passed into packm_init().
+		bli_obj_init_pack( &b_pack_s );
+
+		// Initialize object for packing B.
+		bli_packm_init( b, &b_pack_s,
+		                cntl_sub_packm_b( cntl ) );
+	}
+	b_pack = thread_obroadcast( thread, &b_pack_s );
 
-	dim_t i;
-	dim_t b_alg;
-	dim_t m_trans;
-	dim_t offA;
+	// Pack B (if instructed). All of the threads sharing this node
+	// cooperate in packing it.
+	bli_packm_int( b, b_pack,
+	               cntl_sub_packm_b( cntl ),
+	               trsm_thread_opackm( thread ) );
 
-	// Initialize all pack objects that are passed into packm_init().
-	bli_obj_init_pack( &a1_pack );
-	bli_obj_init_pack( &b_pack );
+	// The chief of each sub-group initializes the pack object for A1,
+	// which is shared by the threads of that sub-group.
+	if ( thread_am_ichief( thread ) )
+		bli_obj_init_pack( &a1_pack_s );
+	a1_pack = thread_ibroadcast( thread, &a1_pack_s );
 
 	// Set the default length of and offset to the non-zero part of A.
 	m_trans  = bli_obj_length_after_trans( *a );
@@ -62,19 +88,21 @@ void bli_trsm_blk_var1b( obj_t*  a,
 		offA = m_trans - bli_abs( bli_obj_diag_offset_after_trans( *a ) ) -
 		                 bli_obj_width_after_trans( *a );
 
-	// Initialize object for packing B.
-	bli_packm_init( b, &b_pack,
-	                cntl_sub_packm_b( cntl ) );
-
-	// Pack B1 (if instructed).
-	bli_packm_int( b, &b_pack,
-	               cntl_sub_packm_b( cntl ) );
+	// Determine the portion of the remaining m dimension assigned to this
+	// thread's sub-group, counting from the bottom. (This loop is only split among threads when
+	// the triangular matrix is on the right, in which case the rows of A
+	// are independent.)
+	bli_thread_get_range( thread_n_way( thread ),
+	                      thread_work_id( thread ),
+	                      offA, m_trans,
+	                      bli_blksz_mult_for_obj( a, cntl_blocksize( cntl ) ),
+	                      &my_start, &my_end );
 
 	// Partition along the remaining portion of the m dimension.
-	for ( i = offA; i < m_trans; i += b_alg )
+	for ( i = my_start; i < my_end; i += b_alg )
 	{
 		// Determine the current algorithmic blocksize.
-		b_alg = bli_determine_blocksize_b( i, m_trans, a,
+		b_alg = bli_determine_blocksize_b( i, my_end, a,
 		                                   cntl_blocksize( cntl ) );
 
 		// Acquire partitions for A1 and C1.
@@ -83,28 +111,40 @@ void bli_trsm_blk_var1b( obj_t*  a,
 		bli_acquire_mpart_b2t( BLIS_SUBPART1,
 		                       i, b_alg, c, &c1 );
 
-		//if ( bli_obj_is_zeros( a1 ) ) continue;
-
 		// Initialize object for packing A1.
-		bli_packm_init( &a1, &a1_pack,
-		                cntl_sub_packm_a( cntl ) );
+		if ( thread_am_ichief( thread ) )
+			bli_packm_init( &a1, a1_pack,
+			                cntl_sub_packm_a( cntl ) );
+		thread_ibarrier( thread );
 
-		// Pack A1 (if instructed).
-		bli_packm_int( &a1, &a1_pack,
-		               cntl_sub_packm_a( cntl ) );
+		// Pack A1 (if instructed). The threads of the sub-group cooperate
+		// in packing it.
+		bli_packm_int( &a1, a1_pack,
+		               cntl_sub_packm_a( cntl ),
+		               trsm_thread_ipackm( thread ) );
 
 		// Perform trsm subproblem.
 		bli_trsm_int( &BLIS_ONE,
-		              &a1_pack,
-		              &b_pack,
+		              a1_pack,
+		              b_pack,
 		              &BLIS_ONE,
 		              &c1,
-		              cntl_sub_trsm( cntl ) );
+		              cntl_sub_trsm( cntl ),
+		              trsm_thread_sub_trsm( thread ) );
+
+		// Wait for the sub-group to finish with A1 before its chief
+		// overwrites it in the next iteration.
+		thread_ibarrier( thread );
 	}
 
+	// Wait for all of the threads to finish with B before releasing it.
+	thread_obarrier( thread );
+
 	// If any packing buffers were acquired within packm, release them back
 	// to the memory manager.
-	bli_obj_release_pack( &a1_pack );
-	bli_obj_release_pack( &b_pack );
+	if ( thread_am_ochief( thread ) )
+		bli_obj_release_pack( b_pack );
+	if ( thread_am_ichief( thread ) )
+		bli_obj_release_pack( a1_pack );
 }
 
@@ -32,8 +32,9 @@
 
 */
 
-void bli_trsm_blk_var1f( obj_t*  a,
-                         obj_t*  b,
-                         obj_t*  c,
-                         trsm_t* cntl );
+void bli_trsm_blk_var1f( obj_t*          a,
+                         obj_t*          b,
+                         obj_t*          c,
+                         trsm_t*         cntl,
+                         trsm_thrinfo_t* thread );
 
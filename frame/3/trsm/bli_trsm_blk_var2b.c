@@ -34,45 +34,77 @@
 
 #include "blis.h"
 
-void bli_trsm_blk_var2b( obj_t*  a,
-                         obj_t*  b,
-                         obj_t*  c,
-                         trsm_t* cntl )
+void bli_trsm_blk_var2b( obj_t*          a,
+                         obj_t*          b,
+                         obj_t*          c,
+                         trsm_t*         cntl,
+                         trsm_thrinfo_t* thread )
 {
-	obj_t a_pack;
-	obj_t b1, b1_pack;
-	obj_t c1, c1_pack;
+	obj_t  a_pack_s;
+	obj_t  b1_pack_s, c1_pack_s;
+
+	obj_t  b1, c1;
+	obj_t* a_pack;
+	obj_t* b1_pack;
+	obj_t* c1_pack;
+
+	dim_t  i;
+	dim_t  b_alg;
+	dim_t  n_trans;
+	dim_t  my_start, my_end;
+
+	// The chief of the threads sharing this node initializes the pack
+	// object for A (which all of the threads share) and scales C.
+	if ( thread_am_ochief( thread ) )
+	{
+		// Initialize the pack object for A that is passed into packm_init().
+		bli_obj_init_pack( &a_pack_s );
 
-	dim_t i;
-	dim_t b_alg;
-	dim_t n_trans;
+		// Scale C by beta (if instructed).
+		bli_scalm_int( &BLIS_ONE,
+		               c,
+		               cntl_sub_scalm( cntl ) );
 
-	// Initialize all pack objects that are passed into packm_init().
-	bli_obj_init_pack( &a_pack );
-	bli_obj_init_pack( &b1_pack );
-	bli_obj_init_pack( &c1_pack );
+		// Initialize object for packing A.
+		bli_packm_init( a, &a_pack_s,
+		                cntl_sub_packm_a( cntl ) );
+	}
+	a_pack = thread_obroadcast( thread, &a_pack_s );
 
-	// Query dimension in partitioning direction.
-	n_trans = bli_obj_width_after_trans( *b );
+	// Pack A (if instructed). All of the threads sharing this node
+	// cooperate in packing it.
+	bli_packm_int( a, a_pack,
+	               cntl_sub_packm_a( cntl ),
+	               trsm_thread_opackm( thread ) );
 
-	// Scale C by beta (if instructed).
-	bli_scalm_int( &BLIS_ONE,
-	               c,
-	               cntl_sub_scalm( cntl ) );
+	// The chief of each sub-group initializes the pack objects for B1 and
+	// C1, which are shared by the threads of that sub-group.
+	if ( thread_am_ichief( thread ) )
+	{
+		bli_obj_init_pack( &b1_pack_s );
+		bli_obj_init_pack( &c1_pack_s );
+	}
+	b1_pack = thread_ibroadcast( thread, &b1_pack_s );
+	c1_pack = thread_ibroadcast( thread, &c1_pack_s );
 
-	// Initialize object for packing A.
-	bli_packm_init( a, &a_pack,
-	                cntl_sub_packm_a( cntl ) );
+	// Query dimension in partitioning direction.
+	n_trans = bli_obj_width_after_trans( *b );
 
-	// Pack A (if instructed).
-	bli_packm_int( a, &a_pack,
-	               cntl_sub_packm_a( cntl ) );
+	// Determine the portion of the n dimension assigned to this thread's
+	// sub-group, counting from the right. (This loop is only split among threads when the
+	// triangular matrix is on the left, in which case the columns of B
+	// are independent.)
+	bli_thread_get_range( thread_n_way( thread ),
+	                      thread_work_id( thread ),
+	                      0, n_trans,
+	                      bli_blksz_mult_for_obj( b, cntl_blocksize( cntl ) ),
+	                      &my_start, &my_end );
 
 	// Partition along the n dimension.
-	for ( i = 0; i < n_trans; i += b_alg )
+	for ( i = my_start; i < my_end; i += b_alg )
 	{
 		// Determine the current algorithmic blocksize.
-		b_alg = bli_determine_blocksize_b( i, n_trans, b,
+		b_alg = bli_determine_blocksize_b( i, my_end, b,
 		                                   cntl_blocksize( cntl ) );
 
 		// Acquire partitions for B1 and C1.
@@ -81,37 +113,55 @@ void bli_trsm_blk_var2b( obj_t*  a,
 		bli_acquire_mpart_r2l( BLIS_SUBPART1,
 		                       i, b_alg, c, &c1 );
 
-		// Initialize objects for packing A1 and B1.
-		bli_packm_init( &b1, &b1_pack,
-		                cntl_sub_packm_b( cntl ) );
-		bli_packm_init( &c1, &c1_pack,
-		                cntl_sub_packm_c( cntl ) );
-
-		// Pack B1 (if instructed).
-		bli_packm_int( &b1, &b1_pack,
-		               cntl_sub_packm_b( cntl ) );
-
-		// Pack C1 (if instructed).
-		bli_packm_int( &c1, &c1_pack,
-		               cntl_sub_packm_c( cntl ) );
+		if ( thread_am_ichief( thread ) )
+		{
+			// Initialize objects for packing B1 and C1.
+			bli_packm_init( &b1, b1_pack,
+			                cntl_sub_packm_b( cntl ) );
+			bli_packm_init( &c1, c1_pack,
+			                cntl_sub_packm_c( cntl ) );
+		}
+		thread_ibarrier( thread );
+
+		// Pack B1 and C1 (if instructed). The threads of the sub-group
+		// cooperate in packing them.
+		bli_packm_int( &b1, b1_pack,
+		               cntl_sub_packm_b( cntl ),
+		               trsm_thread_ipackm( thread ) );
+		bli_packm_int( &c1, c1_pack,
+		               cntl_sub_packm_c( cntl ),
+		               trsm_thread_ipackm( thread ) );
 
 		// Perform trsm subproblem.
 		bli_trsm_int( &BLIS_ONE,
-		              &a_pack,
-		              &b1_pack,
+		              a_pack,
+		              b1_pack,
 		              &BLIS_ONE,
-		              &c1_pack,
-		              cntl_sub_trsm( cntl ) );
+		              c1_pack,
+		              cntl_sub_trsm( cntl ),
+		              trsm_thread_sub_trsm( thread ) );
+
+		// Wait for the sub-group to finish with B1 before its chief
+		// overwrites it in the next iteration.
+		thread_ibarrier( thread );
 
 		// Unpack C1 (if C1 was packed).
-		bli_unpackm_int( &c1_pack, &c1,
-		                 cntl_sub_unpackm_c( cntl ) );
+		if ( thread_am_ichief( thread ) )
+			bli_unpackm_int( c1_pack, &c1,
+			                 cntl_sub_unpackm_c( cntl ) );
 	}
 
+	// Wait for all of the threads to finish with A before releasing it.
+	thread_obarrier( thread );
+
 	// If any packing buffers were acquired within packm, release them back
 	// to the memory manager.
-	bli_obj_release_pack( &a_pack );
-	bli_obj_release_pack( &b1_pack );
-	bli_obj_release_pack( &c1_pack );
+	if ( thread_am_ochief( thread ) )
+		bli_obj_release_pack( a_pack );
+	if ( thread_am_ichief( thread ) )
+	{
+		bli_obj_release_pack( b1_pack );
+		bli_obj_release_pack( c1_pack );
+	}
 }
 
@@ -34,91 +34,145 @@
 
 #include "blis.h"
 
-void bli_trsm_blk_var3f( obj_t*  a,
-                         obj_t*  b,
-                         obj_t*  c,
-                         trsm_t* cntl )
+void bli_trsm_blk_var3f( obj_t*          a,
+                         obj_t*          b,
+                         obj_t*          c,
+                         trsm_t*         cntl,
+                         trsm_thrinfo_t* thread )
 {
-	obj_t  a1, a1_pack;
-	obj_t  b1, b1_pack;
-	obj_t  c_pack;
+	obj_t  c_pack_s;
+	obj_t  a1_pack_s, b1_pack_s;
+
+	obj_t  a_local, b_local;
+	obj_t  a1, b1;
+	obj_t* a1_pack;
+	obj_t* b1_pack;
+	obj_t* c_pack;
 
 	dim_t  i;
 	dim_t  b_alg;
 	dim_t  k_trans;
 
-	// Initialize all pack objects that are passed into packm_init().
-	bli_obj_init_pack( &a1_pack );
-	bli_obj_init_pack( &b1_pack );
-	bli_obj_init_pack( &c_pack );
+	// The chief of the threads sharing this node initializes the pack
+	// object for C (which all of the threads share) and scales C.
+	if ( thread_am_ochief( thread ) )
+	{
+		// Initialize the pack object for C that is passed into packm_init().
+		bli_obj_init_pack( &c_pack_s );
 
-	// Query dimension in partitioning direction.
-	k_trans = bli_obj_width_after_trans( *a );
+		// Scale C by beta (if instructed).
+		bli_scalm_int( &BLIS_ONE,
+		               c,
+		               cntl_sub_scalm( cntl ) );
 
-	// Scale C by beta (if instructed).
-	bli_scalm_int( &BLIS_ONE,
-	               c,
-	               cntl_sub_scalm( cntl ) );
+		// Initialize object for packing C.
+		bli_packm_init( c, &c_pack_s,
+		                cntl_sub_packm_c( cntl ) );
+	}
+	c_pack = thread_obroadcast( thread, &c_pack_s );
 
-	// Initialize object for packing C.
-	bli_packm_init( c, &c_pack,
-	                cntl_sub_packm_c( cntl ) );
+	// Pack C (if instructed). All of the threads sharing this node
+	// cooperate in packing it.
+	bli_packm_int( c, c_pack,
+	               cntl_sub_packm_c( cntl ),
+	               trsm_thread_opackm( thread ) );
 
-	// Pack C (if instructed).
-	bli_packm_int( c, &c_pack,
-	               cntl_sub_packm_c( cntl ) );
+	// The chief of each sub-group initializes the pack objects for A1 and
+	// B1, which are shared by the threads of that sub-group.
+	if ( thread_am_ichief( thread ) )
+	{
+		bli_obj_init_pack( &a1_pack_s );
+		bli_obj_init_pack( &b1_pack_s );
+	}
+	a1_pack = thread_ibroadcast( thread, &a1_pack_s );
+	b1_pack = thread_ibroadcast( thread, &b1_pack_s );
+
+	// Alias A and B so that each thread may reset the scalars attached to
+	// them below without disturbing the (possibly shared) originals.
+	bli_obj_alias_to( *a, a_local );
+	bli_obj_alias_to( *b, b_local );
+
+	// Query dimension in partitioning direction.
+	k_trans = bli_obj_width_after_trans( a_local );
 
-	// Partition along the k dimension.
+	// Partition along the k dimension. (Each iteration depends on the
+	// result of the previous one, so the iterations are never split among
+	// threads.)
 	for ( i = 0; i < k_trans; i += b_alg )
 	{
 		// Determine the current algorithmic blocksize.
-		b_alg = bli_determine_blocksize_f( i, k_trans, b,
+		b_alg = bli_determine_blocksize_f( i, k_trans, &b_local,
 		                                   cntl_blocksize( cntl ) );
 
 		// Acquire partitions for A1 and B1.
 		bli_acquire_mpart_l2r( BLIS_SUBPART1,
-		                       i, b_alg, a, &a1 );
+		                       i, b_alg, &a_local, &a1 );
 		bli_acquire_mpart_t2b( BLIS_SUBPART1,
-		                       i, b_alg, b, &b1 );
-
-		// Initialize objects for packing A1 and B1.
-		bli_packm_init( &a1, &a1_pack,
-		                cntl_sub_packm_a( cntl ) );
-		bli_packm_init( &b1, &b1_pack,
-		                cntl_sub_packm_b( cntl ) );
-
-		// Pack A1 (if instructed).
-		bli_packm_int( &a1, &a1_pack,
-		               cntl_sub_packm_a( cntl ) );
-
-		// Pack B1 (if instructed).
-		bli_packm_int( &b1, &b1_pack,
-		               cntl_sub_packm_b( cntl ) );
+		                       i, b_alg, &b_local, &b1 );
+
+		if ( thread_am_ichief( thread ) )
+		{
+			// Initialize objects for packing A1 and B1.
+			bli_packm_init( &a1, a1_pack,
+			                cntl_sub_packm_a( cntl ) );
+			bli_packm_init( &b1, b1_pack,
+			                cntl_sub_packm_b( cntl ) );
+		}
+		thread_ibarrier( thread );
+
+		// Pack A1 and B1 (if instructed). The threads of the sub-group
+		// cooperate in packing them.
+		bli_packm_int( &a1, a1_pack,
+		               cntl_sub_packm_a( cntl ),
+		               trsm_thread_ipackm( thread ) );
+		bli_packm_int( &b1, b1_pack,
+		               cntl_sub_packm_b( cntl ),
+		               trsm_thread_ipackm( thread ) );
 
 		// Perform trsm subproblem.
 		bli_trsm_int( &BLIS_ONE,
-		              &a1_pack,
-		              &b1_pack,
+		              a1_pack,
+		              b1_pack,
 		              &BLIS_ONE,
-		              &c_pack,
-		              cntl_sub_trsm( cntl ) );
+		              c_pack,
+		              cntl_sub_trsm( cntl ),
+		              trsm_thread_sub_trsm( thread ) );
+
+		// Wait for the sub-group to finish with A1, B1, and the scalar
+		// attached to C before its chief modifies them.
+		thread_ibarrier( thread );
 
 		// This variant executes multiple rank-k updates. Therefore, if the
 		// internal alpha scalars on A/B and C are non-zero, we must ensure
-		// that they are only used in the first iteration.
-		if ( i == 0 ) { bli_obj_scalar_reset( a );
-		                bli_obj_scalar_reset( b );
-		                bli_obj_scalar_reset( &c_pack ); }
+		// that they are only used in the first iteration. The scalars on
+		// A and B are reset in each thread's local aliases, while the one
+		// on C (which is shared) is reset only by the chief.
+		if ( i == 0 )
+		{
+			bli_obj_scalar_reset( &a_local );
+			bli_obj_scalar_reset( &b_local );
+			if ( thread_am_ochief( thread ) )
+				bli_obj_scalar_reset( c_pack );
+		}
 	}
 
-	// Unpack C (if C was packed).
-	bli_unpackm_int( &c_pack, c,
-	                 cntl_sub_unpackm_c( cntl ) );
+	// Wait for all of the threads to finish with C before unpacking it.
+	thread_obarrier( thread );
 
-	// If any packing buffers were acquired within packm, release them back
-	// to the memory manager.
-	bli_obj_release_pack( &a1_pack );
-	bli_obj_release_pack( &b1_pack );
-	bli_obj_release_pack( &c_pack );
+	if ( thread_am_ochief( thread ) )
+	{
+		// Unpack C (if C was packed).
+		bli_unpackm_int( c_pack, c,
+		                 cntl_sub_unpackm_c( cntl ) );
+
+		// If any packing buffers were acquired within packm, release them
+		// back to the memory manager.
+		bli_obj_release_pack( c_pack );
+	}
+	if ( thread_am_ichief( thread ) )
+	{
+		bli_obj_release_pack( a1_pack );
+		bli_obj_release_pack( b1_pack );
+	}
 }
 
@@ -32,9 +32,10 @@
 
 */
 
-void bli_trsm_int( obj_t*  alpha,
-                   obj_t*  a,
-                   obj_t*  b,
-                   obj_t*  beta,
-                   obj_t*  c,
-                   trsm_t* cntl );
+void bli_trsm_int( obj_t*          alpha,
+                   obj_t*          a,
+                   obj_t*          b,
+                   obj_t*          beta,
+                   obj_t*          c,
+                   trsm_t*         cntl,
+                   trsm_thrinfo_t* thread );
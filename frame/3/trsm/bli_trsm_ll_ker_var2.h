@@ -36,10 +36,11 @@
 //
 // Prototype object-based interface.
 //
-void bli_trsm_ll_ker_var2( obj_t*  a,
-                           obj_t*  b,
-                           obj_t*  c,
-                           trsm_t* cntl );
+void bli_trsm_ll_ker_var2( obj_t*          a,
+                           obj_t*          b,
+                           obj_t*          c,
+                           trsm_t*         cntl,
+                           trsm_thrinfo_t* thread );
 
 
 //
@@ -59,7 +60,9 @@ void PASTEMAC(ch,varname)( \
                            void*   alpha2, \
                            void*   c, inc_t rs_c, inc_t cs_c, \
                            void*   gemmtrsm_ukr, \
-                           void*   gemm_ukr  \
+                           void*   gemm_ukr, \
+                           void*   gemm_edge_ukr, \
+                           trsm_thrinfo_t* thread  \
                          );
 
 INSERT_GENTPROT_BASIC( trsm_ll_ker_var2 )
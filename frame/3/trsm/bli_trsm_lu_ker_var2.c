@@ -47,16 +47,19 @@ typedef void (*FUNCPTR_T)(
                            void*   alpha2,
                            void*   c, inc_t rs_c, inc_t cs_c,
                            void*   gemmtrsm_ukr,
-                           void*   gemm_ukr
+                           void*   gemm_ukr,
+                           void*   gemm_edge_ukr,
+                           trsm_thrinfo_t* thread
                          );
 
 static FUNCPTR_T GENARRAY(ftypes,trsm_lu_ker_var2);
 
 
-void bli_trsm_lu_ker_var2( obj_t*  a,
-                           obj_t*  b,
-                           obj_t*  c,
-                           trsm_t* cntl )
+void bli_trsm_lu_ker_var2( obj_t*          a,
+                           obj_t*          b,
+                           obj_t*          c,
+                           trsm_t*         cntl,
+                           trsm_thrinfo_t* thread )
 {
 	num_t     dt_exec   = bli_obj_execution_datatype( *c );
 
@@ -89,6 +92,7 @@ void bli_trsm_lu_ker_var2( obj_t*  a,
 	func_t*   gemm_ukrs;
 	void*     gemmtrsm_ukr;
 	void*     gemm_ukr;
+	void*     gemm_edge_ukr;
 
 
 	// Grab the address of the internal scalar buffer for the scalar
@@ -128,6 +132,10 @@ void bli_trsm_lu_ker_var2( obj_t*  a,
 	gemmtrsm_ukr  = bli_func_obj_query( dt_exec, gemmtrsm_ukrs );
 	gemm_ukr      = bli_func_obj_query( dt_exec, gemm_ukrs );
 
+	// Query the edge micro-kernel, if any, that accompanies the gemm
+	// micro-kernel.
+	gemm_edge_ukr = bli_gemm_edge_ukr_query( dt_exec, gemm_ukrs );
+
 	// Invoke the function.
 	f( diagoffa,
 	   m,
@@ -139,7 +147,9 @@ void bli_trsm_lu_ker_var2( obj_t*  a,
 	   buf_alpha2,
 	   buf_c, rs_c, cs_c,
 	   gemmtrsm_ukr,
-	   gemm_ukr );
+	   gemm_ukr,
+	   gemm_edge_ukr,
+	   thread );
 }
 
 
@@ -157,12 +167,15 @@ void PASTEMAC(ch,varname)( \
                            void*   alpha2, \
                            void*   c, inc_t rs_c, inc_t cs_c, \
                            void*   gemmtrsm_ukr, \
-                           void*   gemm_ukr  \
+                           void*   gemm_ukr, \
+                           void*   gemm_edge_ukr, \
+                           trsm_thrinfo_t* thread  \
                          ) \
 { \
 	/* Cast the micro-kernels' addresses to their function pointer types. */ \
 	PASTECH(ch,gemmtrsmtype) gemmtrsm_ukr_cast = gemmtrsm_ukr; \
 	PASTECH(ch,gemmtype)     gemm_ukr_cast     = gemm_ukr; \
+	PASTECH(ch,gemm_edge_ukr_t) gemm_edge_ukr_cast = gemm_edge_ukr; \
 \
 	/* Temporary C buffer for edge cases. */ \
 	ctype           ct[ PASTEMAC(ch,maxmr) * \
@@ -199,6 +212,7 @@ void PASTEMAC(ch,varname)( \
 	dim_t           off_a11; \
 	dim_t           off_a12; \
 	dim_t           i, j, ib; \
+	dim_t           jr_num_threads, jr_thread_id; \
 	inc_t           rstep_a; \
 	inc_t           cstep_b; \
 	inc_t           rstep_c, cstep_c; \
@@ -299,15 +313,23 @@ void PASTEMAC(ch,varname)( \
 	/* Save the panel stride of B to the auxinfo_t object. */ \
 	bli_auxinfo_set_ps_b( ps_b, aux ); \
 \
-	b1 = b_cast; \
-	c1 = c_cast; \
+	/* Query the number of threads and thread id for the jr loop. The
+	   column panels of B are independent of one another, and so they are
+	   assigned to threads in a round-robin fashion. The loop over the m
+	   dimension, however, must proceed sequentially since each block of B
+	   that it solves is needed to update the blocks that follow. */ \
+	jr_num_threads = thread_n_way( thread ); \
+	jr_thread_id   = thread_work_id( thread ); \
 \
 	/* Loop over the n dimension (NR columns at a time). */ \
-	for ( j = 0; j < n_iter; ++j ) \
+	for ( j = jr_thread_id; j < n_iter; j += jr_num_threads ) \
 	{ \
 		ctype* restrict a1; \
 		ctype* restrict c11; \
 		ctype* restrict b2; \
+\
+		b1  = b_cast + j * cstep_b; \
+		c1  = c_cast + j * cstep_c; \
 \
 		a1  = a_cast; \
 		c11 = c1 + (m_iter-1)*rstep_c; \
@@ -361,9 +383,9 @@ void PASTEMAC(ch,varname)( \
 				if ( bli_is_last_iter( ib, m_iter ) ) \
 				{ \
 					a2 = a_cast; \
-					b2 = b1 + cstep_b; \
-					if ( bli_is_last_iter( j, n_iter ) ) \
-						b2 = b_cast; \
+					b2 = b1 + jr_num_threads * cstep_b; \
+					if ( bli_is_last_iter_rr( j, n_iter, jr_thread_id, jr_num_threads ) ) \
+						b2 = b_cast + jr_thread_id * cstep_b; \
 				} \
 \
 				/* Save addresses of next panels of A and B to the auxinfo_t
@@ -417,9 +439,9 @@ void PASTEMAC(ch,varname)( \
 				if ( bli_is_last_iter( ib, m_iter ) ) \
 				{ \
 					a2 = a_cast; \
-					b2 = b1 + cstep_b; \
-					if ( bli_is_last_iter( j, n_iter ) ) \
-						b2 = b_cast; \
+					b2 = b1 + jr_num_threads * cstep_b; \
+					if ( bli_is_last_iter_rr( j, n_iter, jr_thread_id, jr_num_threads ) ) \
+						b2 = b_cast + jr_thread_id * cstep_b; \
 				} \
 \
 				/* Save addresses of next panels of A and B to the auxinfo_t
@@ -443,6 +465,20 @@ void PASTEMAC(ch,varname)( \
 					               c11, rs_c, cs_c, \
 					               &aux ); \
 				} \
+				else if ( gemm_edge_ukr_cast != NULL ) \
+				{ \
+					/* Invoke the edge micro-kernel, which updates only the
+					   m_cur x n_cur part of c11. */ \
+					gemm_edge_ukr_cast( m_cur, \
+					                    n_cur, \
+					                    k, \
+					                    minus_one, \
+					                    a1, \
+					                    b1, \
+					                    alpha2_cast, \
+					                    c11, rs_c, cs_c, \
+					                    &aux ); \
+				} \
 				else \
 				{ \
 					/* Invoke the gemm micro-kernel. */ \
@@ -466,9 +502,6 @@ void PASTEMAC(ch,varname)( \
 \
 			c11 -= rstep_c; \
 		} \
-\
-		b1 += cstep_b; \
-		c1 += cstep_c; \
 	} \
 \
 /*
@@ -47,16 +47,19 @@ typedef void (*FUNCPTR_T)(
                            void*   alpha2,
                            void*   c, inc_t rs_c, inc_t cs_c,
                            void*   gemmtrsm_ukr,
-                           void*   gemm_ukr
+                           void*   gemm_ukr,
+                           void*   gemm_edge_ukr,
+                           trsm_thrinfo_t* thread
                          );
 
 static FUNCPTR_T GENARRAY(ftypes,trsm_rl_ker_var2);
 
 
-void bli_trsm_rl_ker_var2( obj_t*  a,
-                           obj_t*  b,
-                           obj_t*  c,
-                           trsm_t* cntl )
+void bli_trsm_rl_ker_var2( obj_t*          a,
+                           obj_t*          b,
+                           obj_t*          c,
+                           trsm_t*         cntl,
+                           trsm_thrinfo_t* thread )
 {
 	num_t     dt_exec   = bli_obj_execution_datatype( *c );
 
@@ -89,6 +92,7 @@ void bli_trsm_rl_ker_var2( obj_t*  a,
 	func_t*   gemm_ukrs;
 	void*     gemmtrsm_ukr;
 	void*     gemm_ukr;
+	void*     gemm_edge_ukr;
 
 
 	// Grab the address of the internal scalar buffer for the scalar
@@ -128,6 +132,10 @@ void bli_trsm_rl_ker_var2( obj_t*  a,
 	gemmtrsm_ukr  = bli_func_obj_query( dt_exec, gemmtrsm_ukrs );
 	gemm_ukr      = bli_func_obj_query( dt_exec, gemm_ukrs );
 
+	// Query the edge micro-kernel, if any, that accompanies the gemm
+	// micro-kernel.
+	gemm_edge_ukr = bli_gemm_edge_ukr_query( dt_exec, gemm_ukrs );
+
 	// Invoke the function.
 	f( diagoffb,
 	   m,
@@ -139,7 +147,9 @@ void bli_trsm_rl_ker_var2( obj_t*  a,
 	   buf_alpha2,
 	   buf_c, rs_c, cs_c,
 	   gemmtrsm_ukr,
-	   gemm_ukr );
+	   gemm_ukr,
+	   gemm_edge_ukr,
+	   thread );
 }
 
 
@@ -157,12 +167,15 @@ void PASTEMAC(ch,varname)( \
                            void*   alpha2, \
                            void*   c, inc_t rs_c, inc_t cs_c, \
                            void*   gemmtrsm_ukr, \
-                           void*   gemm_ukr  \
+                           void*   gemm_ukr, \
+                           void*   gemm_edge_ukr, \
+                           trsm_thrinfo_t* thread  \
                          ) \
 { \
 	/* Cast the micro-kernels' addresses to their function pointer types. */ \
 	PASTECH(ch,gemmtrsmtype) gemmtrsm_ukr_cast = gemmtrsm_ukr; \
 	PASTECH(ch,gemmtype)     gemm_ukr_cast     = gemm_ukr; \
+	PASTECH(ch,gemm_edge_ukr_t) gemm_edge_ukr_cast = gemm_edge_ukr; \
 \
 	/* Temporary C buffer for edge cases. */ \
 	ctype           ct[ PASTEMAC(ch,maxnr) * \
@@ -199,6 +212,7 @@ void PASTEMAC(ch,varname)( \
 	dim_t           off_b11; \
 	dim_t           off_b21; \
 	dim_t           i, j, jb; \
+	dim_t           jr_num_threads, jr_thread_id; \
 	inc_t           rstep_a; \
 	inc_t           cstep_b; \
 	inc_t           rstep_c, cstep_c; \
@@ -313,6 +327,17 @@ void PASTEMAC(ch,varname)( \
 	   NOTE: We swap the values for A and B since the triangular
 	   "A" matrix is actually contained within B. */ \
 	bli_auxinfo_set_ps_b( ps_a, aux ); \
+\
+	/* Query the number of threads and thread id for the loop over the m
+	   dimension. Here, the row panels of A (the right-hand sides) are
+	   independent of one another, and so they are assigned to the threads
+	   of the jr node in a round-robin fashion. The loop over the n
+	   dimension, however, must proceed sequentially since each block of
+	   the solution is needed to update the blocks that follow. Since each
+	   thread always updates the same row panels of A, no synchronization
+	   is needed between iterations of the n loop. */ \
+	jr_num_threads = thread_n_way( thread ); \
+	jr_thread_id   = thread_work_id( thread ); \
 \
 	b1 = b_cast; \
 	c1 = c_cast; \
@@ -328,8 +353,8 @@ void PASTEMAC(ch,varname)( \
 \
 		j          = n_iter - 1 - jb; \
 		diagoffb_j = diagoffb - ( doff_t )j*NR; \
-		a1         = a_cast; \
-		c11        = c1 + (n_iter-1)*cstep_c; \
+		a1         = a_cast + jr_thread_id * rstep_a; \
+		c11        = c1 + (n_iter-1)*cstep_c + jr_thread_id * rstep_c; \
 \
 		n_cur = ( bli_is_not_edge_b( jb, n_iter, n_left ) ? NR : n_left ); \
 \
@@ -363,7 +388,7 @@ void PASTEMAC(ch,varname)( \
 		if ( bli_intersects_diag_n( diagoffb_j, k, NR ) ) \
 		{ \
 			/* Loop over the m dimension (MR rows at a time). */ \
-			for ( i = 0; i < m_iter; ++i ) \
+			for ( i = jr_thread_id; i < m_iter; i += jr_num_threads ) \
 			{ \
 				ctype* restrict a11; \
 				ctype* restrict a12; \
@@ -376,10 +401,10 @@ void PASTEMAC(ch,varname)( \
 				a12  = a1 + off_b21 * PACKMR; \
 \
 				/* Compute the addresses of the next panels of A and B. */ \
-                a2 = a1 + rstep_a; \
-				if ( bli_is_last_iter( i, m_iter ) ) \
+				a2 = a1 + jr_num_threads * rstep_a; \
+				if ( bli_is_last_iter_rr( i, m_iter, jr_thread_id, jr_num_threads ) ) \
 				{ \
-					a2 = a_cast; \
+					a2 = a_cast + jr_thread_id * rstep_a; \
 					b2 = b1 + k_b1121 * ss_b; \
 					if ( bli_is_last_iter( jb, n_iter ) ) \
 						b2 = b_cast; \
@@ -422,24 +447,24 @@ void PASTEMAC(ch,varname)( \
 					                        c11, rs_c,  cs_c ); \
 				} \
 \
-				a1  += rstep_a; \
-				c11 += rstep_c; \
+				a1  += jr_num_threads * rstep_a; \
+				c11 += jr_num_threads * rstep_c; \
 			} \
 		} \
 		else if ( bli_is_strictly_below_diag_n( diagoffb_j, k, NR ) ) \
 		{ \
 			/* Loop over the m dimension (MR rows at a time). */ \
-			for ( i = 0; i < m_iter; ++i ) \
+			for ( i = jr_thread_id; i < m_iter; i += jr_num_threads ) \
 			{ \
 				ctype* restrict a2; \
 \
 				m_cur = ( bli_is_not_edge_f( i, m_iter, m_left ) ? MR : m_left ); \
 \
 				/* Compute the addresses of the next panels of A and B. */ \
-                a2 = a1 + rstep_a; \
-				if ( bli_is_last_iter( i, m_iter ) ) \
+				a2 = a1 + jr_num_threads * rstep_a; \
+				if ( bli_is_last_iter_rr( i, m_iter, jr_thread_id, jr_num_threads ) ) \
 				{ \
-					a2 = a_cast; \
+					a2 = a_cast + jr_thread_id * rstep_a; \
 					b2 = b1 + cstep_b; \
 					if ( bli_is_last_iter( jb, n_iter ) ) \
 						b2 = b_cast; \
@@ -463,6 +488,20 @@ void PASTEMAC(ch,varname)( \
 					               c11, cs_c, rs_c, \
 					               &aux ); \
 				} \
+				else if ( gemm_edge_ukr_cast != NULL ) \
+				{ \
+					/* Invoke the edge micro-kernel, which updates only the
+					   m_cur x n_cur part of c11. */ \
+					gemm_edge_ukr_cast( n_cur, \
+					                    m_cur, \
+					                    k, \
+					                    minus_one, \
+					                    b1, \
+					                    a1, \
+					                    alpha2_cast, \
+					                    c11, cs_c, rs_c, \
+					                    &aux ); \
+				} \
 				else \
 				{ \
 					/* Invoke the gemm micro-kernel. */ \
@@ -481,8 +520,8 @@ void PASTEMAC(ch,varname)( \
 					                        c11, rs_c,  cs_c ); \
 				} \
 \
-				a1  += rstep_a; \
-				c11 += rstep_c; \
+				a1  += jr_num_threads * rstep_a; \
+				c11 += jr_num_threads * rstep_c; \
 			} \
 		} \
 \
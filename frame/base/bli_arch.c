@@ -0,0 +1,92 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// The sub-configuration chosen by bli_arch_init().
+static arch_t bli_arch_id = BLIS_ARCH_GENERIC;
+
+static char* bli_arch_strings[ BLIS_NUM_ARCHS ] =
+{
+	"generic",
+	"sandybridge",
+	"haswell",
+};
+
+
+void bli_arch_init( void )
+{
+	arch_t id;
+	arch_t i;
+	char*  str;
+
+	// Find the most capable sub-configuration that the hardware supports.
+	id = bli_cpuid_query_id();
+
+	// Let the environment select a less capable sub-configuration. This is
+	// mostly useful for testing all of the kernels of a multi-architecture
+	// library on a single machine. Requests for a sub-configuration that
+	// the hardware does not support are ignored.
+	str = getenv( "BLIS_ARCH" );
+
+	if ( str != NULL )
+	{
+		for ( i = BLIS_ARCH_GENERIC; i < id; ++i )
+		{
+			if ( strcmp( str, bli_arch_strings[ i ] ) == 0 ) id = i;
+		}
+	}
+
+	bli_arch_id = id;
+
+#ifdef BLIS_ENABLE_ARCH_DISPATCH
+	// Bind the kernels and blocksizes of the chosen sub-configuration.
+	// This happens exactly once, before the control trees (and the
+	// blocksize and function pointer objects they contain) are created,
+	// so that calls made after initialization pay no dispatch cost.
+	bli_arch_select( id );
+#endif
+}
+
+arch_t bli_arch_query_id( void )
+{
+	return bli_arch_id;
+}
+
+char* bli_arch_string( arch_t id )
+{
+	return bli_arch_strings[ id ];
+}
+
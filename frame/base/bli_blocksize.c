@@ -68,6 +68,17 @@ void bli_blksz_obj_init( blksz_t* b,
 	b->e[BLIS_BITVAL_DOUBLE_TYPE]   = be_d;
 	b->e[BLIS_BITVAL_SCOMPLEX_TYPE] = be_c;
 	b->e[BLIS_BITVAL_DCOMPLEX_TYPE] = be_z;
+	b->mult                         = NULL;
+}
+
+
+void bli_blksz_obj_attach_mult_to( blksz_t* br,
+                                   blksz_t* bc )
+{
+	// Record br as the blocksize object whose values bc should be
+	// partitioned into multiples of (eg: MR for MC) when the range of
+	// a blocked loop is split across threads.
+	bc->mult = br;
 }
 
 
@@ -119,6 +130,17 @@ dim_t bli_blksz_total_for_obj( obj_t*   obj,
 }
 
 
+dim_t bli_blksz_mult_for_obj( obj_t*   obj,
+                              blksz_t* b )
+{
+	// If no multiple blocksize object was attached, any partitioning of
+	// the dimension is acceptable.
+	if ( b->mult == NULL ) return 1;
+
+	return bli_blksz_for_type( bli_obj_execution_datatype( *obj ), b->mult );
+}
+
+
 dim_t bli_determine_blocksize_f( dim_t    i,
                                  dim_t    dim,
                                  obj_t*   obj,
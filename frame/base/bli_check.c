@@ -714,6 +714,23 @@ err_t bli_check_packv_schema_on_unpack( obj_t* a )
 	return e_val;
 }
 
+err_t bli_check_pack_schema_if_packed( pack_t schema, obj_t* a )
+{
+	err_t e_val = BLIS_SUCCESS;
+
+	// A packed operand may only be used where its schema is expected, and
+	// it may not be transposed since packing already applied any
+	// transposition.
+	if ( bli_obj_pack_status( *a ) != BLIS_NOT_PACKED )
+	{
+		if ( bli_obj_pack_status( *a ) != schema ||
+		     bli_obj_has_trans( *a ) )
+			e_val = BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_OPERAND;
+	}
+
+	return e_val;
+}
+
 
 // -- Memory allocator checks --------------------------------------------------
 
@@ -763,3 +780,16 @@ err_t bli_check_object_alias_of( obj_t* a, obj_t* b )
 	return e_val;
 }
 
+
+// -- Threading-related checks -------------------------------------------------
+
+err_t bli_check_valid_num_threads( dim_t n_threads )
+{
+	err_t e_val = BLIS_SUCCESS;
+
+	if ( n_threads < 1 || BLIS_MAX_NUM_THREADS < n_threads )
+		e_val = BLIS_INVALID_NUM_THREADS;
+
+	return e_val;
+}
+
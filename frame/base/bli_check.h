@@ -92,6 +92,7 @@ err_t bli_check_valid_cntl( void* cntl );
 
 err_t bli_check_packm_schema_on_unpack( obj_t* a );
 err_t bli_check_packv_schema_on_unpack( obj_t* a );
+err_t bli_check_pack_schema_if_packed( pack_t schema, obj_t* a );
 
 err_t bli_check_valid_packbuf( packbuf_t buf_type );
 err_t bli_check_requested_block_size_for_pool( siz_t req_size, pool_t* pool );
@@ -99,3 +100,5 @@ err_t bli_check_if_exhausted_pool( pool_t* pool );
 
 err_t bli_check_object_alias_of( obj_t* a, obj_t* b );
 
+err_t bli_check_valid_num_threads( dim_t n_threads );
+
@@ -34,7 +34,10 @@
 
 #include "blis.h"
 
-static double gtod_ref_time_sec = 0.0;
+// The time (in seconds) of the first reading of the clock, which all later
+// readings are relative to. It is set exactly once, even if several threads
+// read the clock for the first time at once.
+static volatile long gtod_ref_time_sec = 0;
 
 double bli_clock( void )
 {
@@ -76,8 +79,8 @@ double bli_clock_helper()
 
 	gettimeofday( &tv, NULL );
 
-	if ( gtod_ref_time_sec == 0.0 )
-		gtod_ref_time_sec = ( double ) tv.tv_sec;
+	if ( gtod_ref_time_sec == 0 )
+		__sync_bool_compare_and_swap( &gtod_ref_time_sec, 0, ( long ) tv.tv_sec );
 
 	norm_sec = ( double ) tv.tv_sec - gtod_ref_time_sec;
 
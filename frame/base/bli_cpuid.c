@@ -0,0 +1,123 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// --- Begin x86_64 definitions ------------------------------------------------
+#ifdef __x86_64__
+
+// Feature bits reported by cpuid.
+#define FEATURE_EBX7_AVX2    ( 1U <<  5 ) // leaf 7, ebx
+#define FEATURE_ECX1_FMA3    ( 1U << 12 ) // leaf 1, ecx
+#define FEATURE_ECX1_OSXSAVE ( 1U << 27 ) // leaf 1, ecx
+#define FEATURE_ECX1_AVX     ( 1U << 28 ) // leaf 1, ecx
+
+// The XCR0 bits that indicate that the operating system saves the SSE
+// and AVX (ymm) register state across context switches.
+#define XCR0_SSE_AVX_STATE   ( 0x6U )
+
+static void bli_cpuid( unsigned int  leaf,
+                       unsigned int  subleaf,
+                       unsigned int* eax,
+                       unsigned int* ebx,
+                       unsigned int* ecx,
+                       unsigned int* edx )
+{
+	__asm__ __volatile__
+	(
+	  "cpuid"
+	  : "=a" (*eax), "=b" (*ebx), "=c" (*ecx), "=d" (*edx)
+	  : "a" (leaf), "c" (subleaf)
+	);
+}
+
+static unsigned int bli_xgetbv_lo( void )
+{
+	unsigned int eax, edx;
+
+	// The xgetbv instruction is emitted as raw bytes so that this file may
+	// be compiled without -mxsave.
+	__asm__ __volatile__
+	(
+	  ".byte 0x0f, 0x01, 0xd0"
+	  : "=a" (eax), "=d" (edx)
+	  : "c" (0)
+	);
+
+	return eax;
+}
+
+arch_t bli_cpuid_query_id( void )
+{
+	unsigned int max_leaf;
+	unsigned int eax, ebx, ecx, edx;
+	unsigned int ecx1;
+	unsigned int ebx7 = 0;
+
+	bli_cpuid( 0, 0, &max_leaf, &ebx, &ecx, &edx );
+
+	if ( max_leaf < 1 ) return BLIS_ARCH_GENERIC;
+
+	bli_cpuid( 1, 0, &eax, &ebx, &ecx1, &edx );
+
+	if ( max_leaf >= 7 )
+		bli_cpuid( 7, 0, &eax, &ebx7, &ecx, &edx );
+
+	// AVX is only usable if the processor supports it and the operating
+	// system has enabled saving of the ymm registers.
+	if ( ( ecx1 & FEATURE_ECX1_AVX     ) == 0 ||
+	     ( ecx1 & FEATURE_ECX1_OSXSAVE ) == 0 ) return BLIS_ARCH_GENERIC;
+
+	if ( ( bli_xgetbv_lo() & XCR0_SSE_AVX_STATE ) != XCR0_SSE_AVX_STATE )
+		return BLIS_ARCH_GENERIC;
+
+	if ( ( ebx7 & FEATURE_EBX7_AVX2 ) != 0 &&
+	     ( ecx1 & FEATURE_ECX1_FMA3 ) != 0 ) return BLIS_ARCH_HASWELL;
+
+	return BLIS_ARCH_SANDYBRIDGE;
+}
+
+// --- End x86_64 definitions --------------------------------------------------
+#else
+// --- Begin generic definitions -----------------------------------------------
+
+arch_t bli_cpuid_query_id( void )
+{
+	return BLIS_ARCH_GENERIC;
+}
+
+#endif
+// --- End generic definitions -------------------------------------------------
+
@@ -181,6 +181,12 @@ void bli_error_msgs_init( void )
 
 	sprintf( bli_error_string_for_code(BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_UNPACK),
 	         "Pack schema not yet supported/implemented for use with unpacking." );
+	sprintf( bli_error_string_for_code(BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_OPERAND),
+	         "Operand was packed to a schema not supported for its role in the operation." );
+	sprintf( bli_error_string_for_code(BLIS_INVALID_PACK_FILE),
+	         "Packed matrix file is malformed or was written for a different configuration." );
+	sprintf( bli_error_string_for_code(BLIS_PACK_FILE_IO_FAILURE),
+	         "Failed to read, write, or map packed matrix file." );
 
 	sprintf( bli_error_string_for_code(BLIS_INVALID_PACKBUF),
 	         "Invalid packbuf_t value." );
@@ -191,5 +197,8 @@ void bli_error_msgs_init( void )
 
 	sprintf( bli_error_string_for_code(BLIS_EXPECTED_OBJECT_ALIAS),
 	         "Expected object to be alias." );
+
+	sprintf( bli_error_string_for_code(BLIS_INVALID_NUM_THREADS),
+	         "Requested number of threads exceeds BLIS_MAX_NUM_THREADS." );
 }
 
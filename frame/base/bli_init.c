@@ -36,7 +36,12 @@
 
 // -- Global variables --
 
-static bool_t bli_initialized = FALSE;
+static volatile bool_t bli_initialized = FALSE;
+
+// A spin lock that serializes bli_init_safe() so that, when several
+// application threads make their first calls at the same time, exactly
+// one of them initializes BLIS while the others wait for it to finish.
+static volatile gint_t bli_init_lock = 0;
 
 obj_t BLIS_TWO;
 obj_t BLIS_ONE;
@@ -50,7 +55,9 @@ obj_t BLIS_MINUS_TWO;
 
 void bli_init( void )
 {
-	bli_initialized = TRUE;
+	// Choose the sub-configuration first, since the blocksizes and kernels
+	// stored in the control trees depend on it.
+	bli_arch_init();
 
 	bli_init_const();
 
@@ -58,7 +65,15 @@ void bli_init( void )
 
 	bli_error_msgs_init();
 
+	bli_thread_init();
+
 	bli_mem_init();
+
+	// Mark BLIS as initialized only once everything above is visible to
+	// other threads, since bli_init_safe() checks the flag without taking
+	// the lock.
+	__sync_synchronize();
+	bli_initialized = TRUE;
 }
 
 void bli_finalize( void )
@@ -71,6 +86,8 @@ void bli_finalize( void )
 
 	// Don't need to do anything to finalize error messages.
 
+	bli_thread_finalize();
+
 	bli_mem_finalize();
 }
 
@@ -98,6 +115,16 @@ void bli_finalize_const( void )
 
 void bli_init_safe( err_t* init_result )
 {
+	// Return early (without taking the lock) in the common case that
+	// BLIS is already initialized.
+	if ( bli_initialized )
+	{
+		*init_result = BLIS_FAILURE;
+		return;
+	}
+
+	while ( __sync_lock_test_and_set( &bli_init_lock, 1 ) ) ;
+
 	if ( bli_initialized )
 	{
 		*init_result = BLIS_FAILURE;
@@ -107,6 +134,8 @@ void bli_init_safe( err_t* init_result )
 		bli_init();
 		*init_result = BLIS_SUCCESS;
 	}
+
+	__sync_lock_release( &bli_init_lock );
 }
 
 void bli_finalize_safe( err_t init_result )
@@ -121,7 +150,10 @@ void bli_finalize_safe( err_t init_result )
 #else
 	// Only finalize if the corresponding bli_init_safe() actually
 	// resulted in BLIS being initialized; if it did nothing, we
-	// similarly do nothing here.
+	// similarly do nothing here. (Note that this means application
+	// threads may only call BLIS concurrently if BLIS was initialized
+	// explicitly, since otherwise the first caller would finalize BLIS
+	// out from under the others.)
 	if ( init_result == BLIS_SUCCESS )
 		bli_finalize();
 #endif
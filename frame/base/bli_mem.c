@@ -32,8 +32,20 @@
 
 */
 
+// MAP_ANONYMOUS and MAP_HUGETLB for mmap(), and MADV_HUGEPAGE for
+// madvise(), are not part of POSIX, so we must ask for them explicitly.
+#define _DEFAULT_SOURCE
+#define _BSD_SOURCE
+
 #include "blis.h"
 
+#ifndef BLIS_ENABLE_WINDOWS_BUILD
+  #include <sys/mman.h>
+  #if defined(MAP_ANONYMOUS)
+    #define BLIS_MEM_HAVE_MMAP
+  #endif
+#endif
+
 
 // Declare one memory pool structure for each block size/shape we want to
 // be able to allocate.
@@ -41,51 +53,362 @@
 static pool_t pools[3];
 
 
-// Physically contiguous memory for each pool.
+// Bookkeeping arrays for each pool.
+//
+// The blocks themselves are allocated from the operating system when they
+// are first needed (see bli_mem_pool_grow()), so a process that never
+// packs a matrix never allocates any contiguous memory. The default size
+// of the blocks is computed in a sub-header of blis.h as follows:
+//
+//   BLIS_MK_BLOCK_SIZE = ( BLIS_DEFAULT_MC_? + BLIS_EXTEND_MC_? ) *
+//                        ( BLIS_DEFAULT_KC_? + BLIS_EXTEND_KC_? ) * BLIS_SIZEOF_?
+//
+// where "?" is the datatype that results in the largest block size. The
+// constants BLIS_KN_BLOCK_SIZE and BLIS_MN_BLOCK_SIZE are computed in a
+// similar manner. If a larger block is ever requested (eg: because the
+// cache blocksizes were changed at runtime), the block is reallocated and
+// the pool's block size is raised accordingly.
 //
-// Generally speaking, the pool sizes are computed in a sub-header of blis.h
-// as follows:
+// The arrays below bound the number of blocks each pool can track to
+// BLIS_POOL_MAX_NUM_BLOCKS. Requests beyond that number are still served,
+// but with a block that is returned to the operating system upon release.
 //
-//   BLIS_MK_POOL_SIZE = ( BLIS_DEFAULT_MC_? + BLIS_EXTEND_MC_? ) *
-//                       ( BLIS_DEFAULT_KC_? + BLIS_EXTEND_KC_? ) * BLIS_SIZEOF_?
+
+static void*  pool_mk_blk_ptrs[ BLIS_POOL_MAX_NUM_BLOCKS ];
+static siz_t  pool_mk_blk_sizes[ BLIS_POOL_MAX_NUM_BLOCKS ];
+static siz_t  pool_mk_map_sizes[ BLIS_POOL_MAX_NUM_BLOCKS ];
+static gint_t pool_mk_next[ BLIS_POOL_MAX_NUM_BLOCKS ];
+
+static void*  pool_kn_blk_ptrs[ BLIS_POOL_MAX_NUM_BLOCKS ];
+static siz_t  pool_kn_blk_sizes[ BLIS_POOL_MAX_NUM_BLOCKS ];
+static siz_t  pool_kn_map_sizes[ BLIS_POOL_MAX_NUM_BLOCKS ];
+static gint_t pool_kn_next[ BLIS_POOL_MAX_NUM_BLOCKS ];
+
+static void*  pool_mn_blk_ptrs[ BLIS_POOL_MAX_NUM_BLOCKS ];
+static siz_t  pool_mn_blk_sizes[ BLIS_POOL_MAX_NUM_BLOCKS ];
+static siz_t  pool_mn_map_sizes[ BLIS_POOL_MAX_NUM_BLOCKS ];
+static gint_t pool_mn_next[ BLIS_POOL_MAX_NUM_BLOCKS ];
+
+
+// Per-thread block caches.
 //
-// where "?" is the datatype that results in the largest pool size. The
-// constants BLIS_KN_POOL_SIZE and BLIS_MN_POOL_SIZE are computed in a 
-// similar manner. All constants are computed with appropriate "padding"
-// to ensure enough space given the alignments required by bli_config.h.
+// Each thread that acquires a block from a pool is assigned one of
+// BLIS_MAX_NUM_THREADS cache slots (round-robin, upon its first request).
+// A released block is parked in the releasing thread's slot if it is
+// empty, and a thread looks in its own slot before going to the shared
+// free stack. Since a thread usually releases and then re-acquires a block
+// of the same pool from one call to the next, most requests are served
+// without touching the shared stack. The slots are padded to a cache line
+// to avoid false sharing, and a thread whose slot and the shared stack are
+// both empty may take the block parked in any other slot, so a cached
+// block is never lost to a thread that does not need it.
+
+typedef struct
+{
+	volatile gint_t index;
+	char            pad[ BLIS_CACHE_LINE_SIZE - sizeof( gint_t ) ];
+} pool_slot_t;
+
+static pool_slot_t pool_slots[3][ BLIS_MAX_NUM_THREADS ];
+
+static volatile dim_t  pool_slot_counter = 0;
+static __thread dim_t  pool_slot_id      = -1;
+
+
+static dim_t bli_mem_slot_id( void )
+{
+	// Assign a cache slot to the calling thread the first time it asks.
+	if ( pool_slot_id == -1 )
+		pool_slot_id = __sync_fetch_and_add( &pool_slot_counter, 1 ) %
+		               BLIS_MAX_NUM_THREADS;
+
+	return pool_slot_id;
+}
+
+
+// Huge pages.
 //
+// When enabled, the blocks of the pools that span at least one huge page
+// are mapped directly from the operating system with huge pages (of
+// BLIS_HUGE_PAGE_SIZE bytes each), which greatly reduces the number of TLB
+// entries needed by the macro-kernel as it streams through a packed panel
+// of B. We first try to map explicit huge pages (MAP_HUGETLB), which
+// succeeds only if the administrator has reserved them (eg: via
+// /proc/sys/vm/nr_hugepages). Otherwise, we map ordinary pages aligned to
+// a huge page boundary and ask the kernel to back them with transparent
+// huge pages (madvise(MADV_HUGEPAGE)). The counters below record how many
+// blocks were obtained each way since bli_mem_init(), so that the caller
+// can tell whether huge pages were actually obtained.
+
+#ifdef BLIS_ENABLE_HUGE_PAGES
+static bool_t         bli_mem_huge_pages        = TRUE;
+#else
+static bool_t         bli_mem_huge_pages        = FALSE;
+#endif
+static volatile dim_t bli_mem_n_hugetlb_blocks  = 0;
+static volatile dim_t bli_mem_n_thp_blocks      = 0;
+
+
+bool_t bli_mem_huge_pages_is_enabled( void )
+{
+	return bli_mem_huge_pages;
+}
+
+bool_t bli_mem_huge_pages_set( bool_t enable )
+{
+	bool_t old_enable = bli_mem_huge_pages;
+
+	// The new setting only applies to blocks allocated from now on.
+	bli_mem_huge_pages = enable;
+
+	return old_enable;
+}
+
+dim_t bli_mem_num_hugetlb_blocks( void )
+{
+	return bli_mem_n_hugetlb_blocks;
+}
+
+dim_t bli_mem_num_thp_blocks( void )
+{
+	return bli_mem_n_thp_blocks;
+}
+
+
+#ifdef BLIS_MEM_HAVE_MMAP
+static void* bli_mem_map_huge_block( siz_t size, siz_t* map_size )
+{
+	const siz_t huge_size = BLIS_HUGE_PAGE_SIZE;
+	siz_t       len;
+	char*       p;
+
+	// Round the length of the mapping up to a whole number of huge pages.
+	len = ( ( size + huge_size - 1 ) / huge_size ) * huge_size;
+
+#ifdef MAP_HUGETLB
+	p = mmap( NULL, len, PROT_READ | PROT_WRITE,
+	          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+
+	if ( p != MAP_FAILED )
+	{
+		__sync_fetch_and_add( &bli_mem_n_hugetlb_blocks, 1 );
+
+		*map_size = len;
+		return p;
+	}
+#endif
+
+#ifdef MADV_HUGEPAGE
+	{
+		char* p_align;
+		siz_t head;
+
+		// Map one extra huge page so that we can trim the mapping to a huge
+		// page boundary at both ends.
+		p = mmap( NULL, len + huge_size, PROT_READ | PROT_WRITE,
+		          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+		if ( p == MAP_FAILED ) return NULL;
+
+		p_align = p + ( huge_size - ( ( uintptr_t )p % huge_size ) ) % huge_size;
+		head    = p_align - p;
+
+		if ( head > 0 )             munmap( p, head );
+		if ( huge_size - head > 0 ) munmap( p_align + len, huge_size - head );
+
+		if ( madvise( p_align, len, MADV_HUGEPAGE ) == 0 )
+			__sync_fetch_and_add( &bli_mem_n_thp_blocks, 1 );
+
+		*map_size = len;
+		return p_align;
+	}
+#else
+	return NULL;
+#endif
+}
+#endif
+
+
+static void* bli_mem_alloc_block( siz_t size, siz_t* map_size )
+{
+	void* p = NULL;
+	int   r_val;
+
+	// Pad the block so that the micro-kernel, when computing with the end
+	// of the block, can preload beyond the usable portion of the block
+	// without causing a segmentation fault.
+	size += BLIS_MAX_PRELOAD_BYTE_OFFSET;
+
+#ifdef BLIS_MEM_HAVE_MMAP
+	// Try to map the block with huge pages if the caller can keep track of
+	// the mapping (map_size != NULL). Blocks smaller than a huge page (eg:
+	// most packed blocks of A) already need few TLB entries, and rounding
+	// them up to a huge page would only waste memory, so they are left on
+	// the heap.
+	if ( map_size != NULL && bli_mem_huge_pages_is_enabled() &&
+	     size >= BLIS_HUGE_PAGE_SIZE )
+	{
+		p = bli_mem_map_huge_block( size, map_size );
+
+		if ( p != NULL ) return p;
+	}
+#endif
+
+	// Otherwise, allocate the block from the heap.
+	if ( map_size != NULL ) *map_size = 0;
+
+	r_val = posix_memalign( &p,
+	                        ( size_t )BLIS_CONTIG_ADDR_ALIGN_SIZE,
+	                        ( size_t )size );
+
+	if ( r_val != 0 || p == NULL ) bli_abort();
+
+	return p;
+}
+
+
+static void bli_mem_free_block( void* p, siz_t map_size )
+{
+#ifdef BLIS_MEM_HAVE_MMAP
+	if ( map_size != 0 )
+	{
+		munmap( p, map_size );
+		return;
+	}
+#endif
+
+	free( p );
+}
+
+
+static gint_t bli_mem_pool_pop( pool_t* pool )
+{
+	gint_t*  next_index = bli_pool_next_index( pool );
+	uint64_t top;
+	uint64_t new_top;
+	gint_t   i;
+
+	do
+	{
+		top = bli_pool_top( pool );
+		i   = bli_pool_top_index_of( top );
+
+		// Return -1 if the free stack is empty.
+		if ( i == -1 ) return -1;
+
+		// If another thread pops i before we swap, the tag of the top will
+		// have changed, so the next_index[i] we read here is never used.
+		new_top = bli_pool_top_make( next_index[i],
+		                             bli_pool_top_tag_of( top ) + 1 );
+	}
+	while ( !__sync_bool_compare_and_swap( &bli_pool_top( pool ),
+	                                       top, new_top ) );
+
+	return i;
+}
+
+
+static void bli_mem_pool_push( pool_t* pool, gint_t i )
+{
+	gint_t*  next_index = bli_pool_next_index( pool );
+	uint64_t top;
+	uint64_t new_top;
+
+	do
+	{
+		top = bli_pool_top( pool );
+
+		next_index[i] = bli_pool_top_index_of( top );
+
+		new_top = bli_pool_top_make( i, bli_pool_top_tag_of( top ) + 1 );
+	}
+	while ( !__sync_bool_compare_and_swap( &bli_pool_top( pool ),
+	                                       top, new_top ) );
+}
 
-static void*  pool_mk_blk_ptrs[ BLIS_NUM_MC_X_KC_BLOCKS ];
-static char   pool_mk_mem[ BLIS_MK_POOL_SIZE ];
 
-static void*  pool_kn_blk_ptrs[ BLIS_NUM_KC_X_NC_BLOCKS ];
-static char   pool_kn_mem[ BLIS_KN_POOL_SIZE ];
+static void bli_mem_pool_raise_block_size( pool_t* pool, siz_t req_size )
+{
+	siz_t block_size;
 
-static void*  pool_mn_blk_ptrs[ BLIS_NUM_MC_X_NC_BLOCKS ];
-static char   pool_mn_mem[ BLIS_MN_POOL_SIZE ];
+	// Raise the size used for newly allocated blocks to req_size, unless
+	// another thread has already raised it at least that far.
+	do
+	{
+		block_size = bli_pool_block_size( pool );
 
+		if ( req_size <= block_size ) return;
+	}
+	while ( !__sync_bool_compare_and_swap( &bli_pool_block_size( pool ),
+	                                       block_size, req_size ) );
+}
 
 
+static gint_t bli_mem_pool_grow( pool_t* pool )
+{
+	void**  block_ptrs  = bli_pool_block_ptrs( pool );
+	siz_t*  block_sizes = bli_pool_block_sizes( pool );
+	siz_t*  map_sizes   = bli_pool_map_sizes( pool );
+	siz_t   block_size  = bli_pool_block_size( pool );
+	dim_t   n_prev;
+	dim_t   n_new;
+	dim_t   i;
+
+	// Claim a range of unused block indices. The first thread to grow a
+	// pool reserves the pool's initial number of blocks; afterwards, pools
+	// grow one block at a time.
+	do
+	{
+		n_prev = bli_pool_num_blocks( pool );
+
+		if ( n_prev == 0 ) n_new = bli_max( bli_pool_init_num_blocks( pool ), 1 );
+		else               n_new = n_prev + 1;
+
+		// Return -1 if the pool cannot track any more blocks.
+		if ( n_new > bli_pool_max_num_blocks( pool ) ) return -1;
+	}
+	while ( !__sync_bool_compare_and_swap( &bli_pool_num_blocks( pool ),
+	                                       n_prev, n_new ) );
+
+	// Allocate the claimed blocks. We keep the first one for the caller
+	// and push the rest onto the free stack.
+	for ( i = n_prev; i < n_new; ++i )
+	{
+		block_ptrs[i]  = bli_mem_alloc_block( block_size, &map_sizes[i] );
+		block_sizes[i] = block_size;
+
+		if ( i != n_prev ) bli_mem_pool_push( pool, i );
+	}
+
+	return n_prev;
+}
 
 
 void bli_mem_acquire_m( siz_t     req_size,
                         packbuf_t buf_type,
                         mem_t*    mem )
 {
-	siz_t   block_size;
-	dim_t   pool_index;
-	pool_t* pool;
-	void**  block_ptrs;
-	void*   block;
-	gint_t  i;
+	siz_t        block_size;
+	dim_t        pool_index;
+	pool_t*      pool;
+	pool_slot_t* slots;
+	void**       block_ptrs;
+	siz_t*       block_sizes;
+	siz_t*       map_sizes;
+	void*        block;
+	gint_t       i;
+	dim_t        s, t;
 
 
 	if ( buf_type == BLIS_BUFFER_FOR_GEN_USE )
 	{
 		// For general-use buffer requests, such as those used by level-2
 		// operations, using bli_malloc() is sufficient, since using
-		// physically contiguous memory is not as important there.
-		block = bli_malloc( req_size );
+		// physically contiguous memory is not as important there. As with
+		// the pool blocks, we pad the allocation since operands packed
+		// ahead of time (see bli_gemm_pack_a()) are read by micro-kernels
+		// that may preload beyond the end of the buffer.
+		block = bli_malloc( req_size + BLIS_MAX_PRELOAD_BYTE_OFFSET );
 
 		// Initialize the mem_t object with:
 		// - the address of the memory block,
@@ -106,59 +429,88 @@ void bli_mem_acquire_m( siz_t     req_size,
 		// we then use to select the corresponding memory pool.
 		pool_index = bli_packbuf_index( buf_type );
 		pool       = &pools[ pool_index ];
+		slots      = pool_slots[ pool_index ];
 
-		// Unconditionally perform error checking on the memory pool.
-		{
-			err_t e_val;
+		// Access the block pointer, block size, and mapping size arrays from
+		// the memory pool data structure.
+		block_ptrs  = bli_pool_block_ptrs( pool );
+		block_sizes = bli_pool_block_sizes( pool );
+		map_sizes   = bli_pool_map_sizes( pool );
 
-			// Make sure that the requested matrix size fits inside of a block
-			// of the corresponding pool.
-			e_val = bli_check_requested_block_size_for_pool( req_size, pool );
-			bli_check_error_code( e_val );
+		// If the requested region is larger than the pool's blocks, raise
+		// the size of the blocks allocated from now on.
+		bli_mem_pool_raise_block_size( pool, req_size );
 
-			// Make sure that the pool contains at least one block to check out
-			// to the thread.
-			e_val = bli_check_if_exhausted_pool( pool );
-			bli_check_error_code( e_val );
-		}
+		s = bli_mem_slot_id();
 
-		// Access the block pointer array from the memory pool data structure.
-		block_ptrs = bli_pool_block_ptrs( pool );
-
-
-		// BEGIN CRITICAL SECTION
-
-
-		// Query the index of the contiguous memory block that resides at the
-		// "top" of the pool.
-		i = bli_pool_top_index( pool );
-	
-		// Extract the address of the top block from the block pointer array.
-		block = block_ptrs[i];
-
-		// Clear the entry from the block pointer array. (This is actually not
-		// necessary.)
-		//block_ptrs[i] = NULL; 
-
-		// Decrement the top of the memory pool.
-		bli_pool_dec_top_index( pool );
-
-
-		// END CRITICAL SECTION
+		do
+		{
+			// First, try to take the block parked in our own cache slot.
+			i = __sync_lock_test_and_set( &slots[ s ].index, -1 );
+			if ( i != -1 ) break;
+
+			// Next, try to pop a block from the shared free stack.
+			i = bli_mem_pool_pop( pool );
+			if ( i != -1 ) break;
+
+			// Next, try to take a block parked in another thread's slot.
+			for ( t = 1; t < BLIS_MAX_NUM_THREADS; ++t )
+			{
+				volatile gint_t* slot_index;
+
+				slot_index = &slots[ ( s + t ) % BLIS_MAX_NUM_THREADS ].index;
+
+				if ( *slot_index != -1 )
+				{
+					i = __sync_lock_test_and_set( slot_index, -1 );
+					if ( i != -1 ) break;
+				}
+			}
+			if ( i != -1 ) break;
+
+			// Finally, allocate a new block for the pool.
+			i = bli_mem_pool_grow( pool );
+		}
+		while ( 0 );
 
-		// Query the size of the blocks in the pool so we can store it in the
-		// mem_t object.
-		block_size = bli_pool_block_size( pool );
+		if ( i != -1 )
+		{
+			// If the block is too small (eg: because it was allocated before
+			// the cache blocksizes were increased), replace it with a block
+			// of the current size. The block is ours alone at this point.
+			if ( block_sizes[i] < req_size )
+			{
+				block_size = bli_pool_block_size( pool );
+
+				bli_mem_free_block( block_ptrs[i], map_sizes[i] );
+
+				block_ptrs[i]  = bli_mem_alloc_block( block_size, &map_sizes[i] );
+				block_sizes[i] = block_size;
+			}
+
+			// Extract the address and size of the block.
+			block      = block_ptrs[i];
+			block_size = block_sizes[i];
+		}
+		else
+		{
+			// If the pool cannot track any more blocks, allocate a block that
+			// does not belong to the pool. It will be freed upon release.
+			block_size = req_size;
+			block      = bli_mem_alloc_block( block_size, NULL );
+		}
 
 		// Initialize the mem_t object with:
 		// - the address of the memory block,
 		// - the buffer type (a packbuf_t value),
-		// - the address of the memory pool to which it belongs, and
+		// - the address of the memory pool to which it belongs,
+		// - the index of the block within that pool (or -1), and
 		// - the size of the contiguous memory block (NOT the size of the
 		//   requested region).
 		bli_mem_set_buffer( block, mem );
 		bli_mem_set_buf_type( buf_type, mem );
 		bli_mem_set_pool( pool, mem );
+		bli_mem_set_block_index( i, mem );
 		bli_mem_set_size( block_size, mem );
 	}
 }
@@ -166,11 +518,12 @@ void bli_mem_acquire_m( siz_t     req_size,
 
 void bli_mem_release( mem_t* mem )
 {
-	packbuf_t buf_type;
-	pool_t*   pool;
-	void**    block_ptrs;
-	void*     block;
-	gint_t    i;
+	packbuf_t    buf_type;
+	pool_t*      pool;
+	pool_slot_t* slots;
+	void*        block;
+	gint_t       i;
+	dim_t        s;
 
 	// Extract the address of the memory block we are trying to
 	// release.
@@ -190,27 +543,27 @@ void bli_mem_release( mem_t* mem )
 		// This branch handles cases where the memory block came from one
 		// of the contiguous memory pools.
 
-		// Extract the pool from which the block was allocated.
-		pool = bli_mem_pool( mem );
-
-		// Extract the block pointer array associated with the pool.
-		block_ptrs = bli_pool_block_ptrs( pool );
-
-
-		// BEGIN CRITICAL SECTION
-
-
-		// Increment the top of the memory pool.
-		bli_pool_inc_top_index( pool );
-
-		// Query the newly incremented top index.
-		i = bli_pool_top_index( pool );
-
-		// Place the address of the block back onto the top of the memory pool.
-		block_ptrs[i] = block;
+		// Extract the pool from which the block was allocated, and the
+		// index of the block within that pool.
+		pool  = bli_mem_pool( mem );
+		slots = pool_slots[ pool - pools ];
+		i     = bli_mem_block_index( mem );
 
+		if ( i == -1 )
+		{
+			// The block was allocated outside of the pool, so we return it
+			// to the operating system.
+			bli_mem_free_block( block, 0 );
+		}
+		else
+		{
+			// Park the block in our own cache slot if it is empty.
+			// Otherwise, push it back onto the shared free stack.
+			s = bli_mem_slot_id();
 
-		// END CRITICAL SECTION
+			if ( !__sync_bool_compare_and_swap( &slots[ s ].index, -1, i ) )
+				bli_mem_pool_push( pool, i );
+		}
 	}
 
 
@@ -241,6 +594,19 @@ void bli_mem_init()
 	dim_t index_a;
 	dim_t index_b;
 	dim_t index_c;
+	dim_t i, s;
+	char* str;
+
+	// Let the environment override the configuration's default choice
+	// of whether to back the pools with huge pages.
+	str = getenv( "BLIS_HUGE_PAGES" );
+
+	if ( str != NULL )
+		bli_mem_huge_pages_set( strtol( str, NULL, 10 ) != 0 );
+
+	// Reset the huge page counters.
+	bli_mem_n_hugetlb_blocks = 0;
+	bli_mem_n_thp_blocks     = 0;
 
 	// Map each of the packbuf_t values to an index starting at zero.
 	index_a = bli_packbuf_index( BLIS_BUFFER_FOR_A_BLOCK );
@@ -248,79 +614,85 @@ void bli_mem_init()
 	index_c = bli_packbuf_index( BLIS_BUFFER_FOR_C_PANEL );
 
 	// Initialize contiguous memory pool for MC x KC blocks.
-	bli_mem_init_pool( pool_mk_mem,
-	                   BLIS_MK_BLOCK_SIZE,
+	bli_mem_init_pool( BLIS_MK_BLOCK_SIZE,
 	                   BLIS_NUM_MC_X_KC_BLOCKS,
+	                   BLIS_POOL_MAX_NUM_BLOCKS,
 	                   pool_mk_blk_ptrs,
+	                   pool_mk_blk_sizes,
+	                   pool_mk_map_sizes,
+	                   pool_mk_next,
 	                   &pools[ index_a ] );
 
 	// Initialize contiguous memory pool for KC x NC blocks.
-	bli_mem_init_pool( pool_kn_mem,
-	                   BLIS_KN_BLOCK_SIZE,
+	bli_mem_init_pool( BLIS_KN_BLOCK_SIZE,
 	                   BLIS_NUM_KC_X_NC_BLOCKS,
+	                   BLIS_POOL_MAX_NUM_BLOCKS,
 	                   pool_kn_blk_ptrs,
+	                   pool_kn_blk_sizes,
+	                   pool_kn_map_sizes,
+	                   pool_kn_next,
 	                   &pools[ index_b ] );
 
 	// Initialize contiguous memory pool for MC x NC blocks.
-	bli_mem_init_pool( pool_mn_mem,
-	                   BLIS_MN_BLOCK_SIZE,
+	bli_mem_init_pool( BLIS_MN_BLOCK_SIZE,
 	                   BLIS_NUM_MC_X_NC_BLOCKS,
+	                   BLIS_POOL_MAX_NUM_BLOCKS,
 	                   pool_mn_blk_ptrs,
+	                   pool_mn_blk_sizes,
+	                   pool_mn_map_sizes,
+	                   pool_mn_next,
 	                   &pools[ index_c ] );
+
+	// Mark all per-thread cache slots as empty.
+	for ( i = 0; i < 3; ++i )
+		for ( s = 0; s < BLIS_MAX_NUM_THREADS; ++s )
+			pool_slots[i][s].index = -1;
 }
 
 
-void bli_mem_init_pool( char*   pool_mem,
-                        siz_t   block_size,
-                        dim_t   num_blocks,
+void bli_mem_init_pool( siz_t   block_size,
+                        dim_t   init_num_blocks,
+                        dim_t   max_num_blocks,
                         void**  block_ptrs,
+                        siz_t*  block_sizes,
+                        siz_t*  map_sizes,
+                        gint_t* next_index,
                         pool_t* pool )
 {
-	const siz_t align_size = BLIS_CONTIG_ADDR_ALIGN_SIZE;
-	dim_t       i;
-
-	// If the pool starting address is not already aligned, advance it
-	// accordingly.
-	if ( bli_is_unaligned_to( ( uintptr_t )pool_mem, ( uintptr_t )align_size ) )
-	{
-		// Notice that this works even if the alignment is not a power of two.
-		pool_mem += (   ( uintptr_t )align_size - 
-		              ( ( uintptr_t )pool_mem % align_size ) );
-	}
-
-	// Step through the memory pool, beginning with the aligned address
-	// determined above, assigning pointers to the beginning of each block_size
-	// bytes to the ith element of the block_ptrs array.
-	for ( i = 0; i < num_blocks; ++i )
-	{
-		// Save the address of pool, which is guaranteed to be aligned.
-		block_ptrs[i] = pool_mem;
-
-		// Advance pool by one block.
-		pool_mem += block_size;
-
-		// Advance pool a bit further if needed in order to get to the
-		// beginning of an alignment boundary.
-		if ( bli_is_unaligned_to( ( uintptr_t )pool_mem, ( uintptr_t )align_size ) )
-		{
-			pool_mem += (   ( uintptr_t )align_size -
-			              ( ( uintptr_t )pool_mem % align_size ) );
-		}
-	}
-
-	// Now that we have initialized the array of pointers to the individual
-	// blocks in the pool, we initialize a pool_t data structure so that we
-	// can easily manage this pool.
-	bli_pool_init( num_blocks,
+	// Initialize a pool_t data structure with an empty free stack. No
+	// blocks are allocated until the pool is first used.
+	bli_pool_init( init_num_blocks,
+	               max_num_blocks,
 	               block_size,
 	               block_ptrs,
+	               block_sizes,
+	               map_sizes,
+	               next_index,
 	               pool );
 }
 
 
+void bli_mem_finalize_pool( pool_t* pool )
+{
+	void** block_ptrs = bli_pool_block_ptrs( pool );
+	siz_t* map_sizes  = bli_pool_map_sizes( pool );
+	dim_t  i;
+
+	// Return every block allocated for the pool to the operating system.
+	// This assumes that all blocks have been released.
+	for ( i = 0; i < bli_pool_num_blocks( pool ); ++i )
+		bli_mem_free_block( block_ptrs[i], map_sizes[i] );
+
+	bli_pool_set_num_blocks( 0, pool );
+	bli_pool_set_top( bli_pool_top_make( -1, 0 ), pool );
+}
+
 
 void bli_mem_finalize()
 {
-	// Nothing to do.
+	dim_t i;
+
+	for ( i = 0; i < 3; ++i )
+		bli_mem_finalize_pool( &pools[i] );
 }
 
@@ -44,9 +44,18 @@ void bli_mem_release( mem_t* mem );
 void bli_mem_init( void );
 void bli_mem_finalize( void );
 
-void bli_mem_init_pool( char*   pool_mem,
-                        siz_t   block_size,
-                        dim_t   n_blocks,
+void bli_mem_init_pool( siz_t   block_size,
+                        dim_t   init_num_blocks,
+                        dim_t   max_num_blocks,
                         void**  block_ptrs,
+                        siz_t*  block_sizes,
+                        siz_t*  map_sizes,
+                        gint_t* next_index,
                         pool_t* pool_struct );
+void bli_mem_finalize_pool( pool_t* pool_struct );
+
+bool_t bli_mem_huge_pages_is_enabled( void );
+bool_t bli_mem_huge_pages_set( bool_t enable );
+dim_t  bli_mem_num_hugetlb_blocks( void );
+dim_t  bli_mem_num_thp_blocks( void );
 
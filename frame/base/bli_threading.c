@@ -0,0 +1,453 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// -- Global variables --
+
+thread_comm_t BLIS_SINGLE_COMM = { NULL, 1, FALSE, 0 };
+
+// The number of ways of parallelism to extract from each of the loops
+// around the micro-kernel: the jc (NC), ic (MC), jr (NR), and ir (MR)
+// loops. (The kc loop is never parallelized since its iterations
+// accumulate into the same block of C.)
+static dim_t bli_jc_nt = 1;
+static dim_t bli_ic_nt = 1;
+static dim_t bli_jr_nt = 1;
+static dim_t bli_ir_nt = 1;
+
+// The number of microseconds for which an idle thread of the thread pool
+// spins before going to sleep.
+static dim_t bli_spin_usec = BLIS_THREAD_SPIN_USEC;
+
+
+// -- Thread communicators --
+
+thread_comm_t* bli_thread_comm_create( dim_t n_threads )
+{
+	thread_comm_t* comm;
+
+	comm = ( thread_comm_t* ) bli_malloc( sizeof(thread_comm_t) );
+
+	bli_thread_comm_init( n_threads, comm );
+
+	return comm;
+}
+
+void bli_thread_comm_init( dim_t n_threads, thread_comm_t* comm )
+{
+	comm->sent_object             = NULL;
+	comm->n_threads               = n_threads;
+	comm->barrier_sense           = FALSE;
+	comm->barrier_threads_arrived = 0;
+}
+
+void bli_thread_comm_free( thread_comm_t* comm )
+{
+	// The single-thread communicator is statically allocated.
+	if ( comm == NULL || comm == &BLIS_SINGLE_COMM ) return;
+
+	bli_free( comm );
+}
+
+void bli_thread_barrier( thread_comm_t* comm, dim_t t_id )
+{
+	// A barrier among one thread is a no-op.
+	if ( comm == NULL || comm->n_threads == 1 ) return;
+
+#ifdef BLIS_ENABLE_MULTITHREADING
+	{
+		bool_t my_sense;
+		dim_t  my_threads_arrived;
+
+		// This is a sense-reversing centralized barrier. Every thread
+		// records the current sense before announcing its arrival. The last
+		// thread to arrive resets the counter and then flips the sense,
+		// which releases the threads that are spinning on it.
+		my_sense = comm->barrier_sense;
+
+		my_threads_arrived = __sync_add_and_fetch( &comm->barrier_threads_arrived, 1 );
+
+		if ( my_threads_arrived == comm->n_threads )
+		{
+			comm->barrier_threads_arrived = 0;
+			__sync_synchronize();
+			comm->barrier_sense = !my_sense;
+		}
+		else
+		{
+			double spin_sec = ( double )bli_spin_usec * 1.0e-6;
+			double t_start  = bli_clock();
+			dim_t  n_spins  = 0;
+
+			// Spin until the sense flips. If that takes longer than the
+			// spin time (eg: because there are more threads than cores),
+			// yield the processor to the threads we are waiting for.
+			while ( comm->barrier_sense == my_sense )
+			{
+				if ( ++n_spins % 256 == 0 &&
+				     bli_clock() - t_start >= spin_sec ) sched_yield();
+			}
+		}
+
+		// Make sure that writes performed by other threads before they
+		// arrived at the barrier are visible once we leave it.
+		__sync_synchronize();
+	}
+#endif
+}
+
+void* bli_thread_broadcast( thread_comm_t* comm, dim_t t_id, void* to_send )
+{
+	void* object;
+
+	// There is nobody to broadcast to within a group of one thread.
+	if ( comm == NULL || comm->n_threads == 1 ) return to_send;
+
+	// The chief thread (id 0) deposits its object in the communicator.
+	// All threads wait until it is there, read it, and then wait again so
+	// that the chief cannot overwrite it (via a subsequent broadcast) until
+	// everyone has read it.
+	if ( t_id == 0 ) comm->sent_object = to_send;
+
+	bli_thread_barrier( comm, t_id );
+	object = comm->sent_object;
+	bli_thread_barrier( comm, t_id );
+
+	return object;
+}
+
+
+// -- Work partitioning --
+
+void bli_thread_get_range( dim_t  n_way,
+                           dim_t  work_id,
+                           dim_t  all_start,
+                           dim_t  all_end,
+                           dim_t  block_factor,
+                           dim_t* start,
+                           dim_t* end )
+{
+	dim_t size       = all_end - all_start;
+	dim_t n_bf_whole = size / block_factor;
+	dim_t n_bf_left  = size % block_factor;
+	dim_t n_bf_lo    = n_bf_whole / n_way;
+	dim_t n_th_hi    = n_bf_whole % n_way;
+
+	// Partition the range [all_start,all_end) into n_way sub-ranges whose
+	// boundaries fall on multiples of block_factor (typically a register
+	// blocksize). The whole blocks are divided as evenly as possible: the
+	// first n_th_hi groups receive one more block than the others. The
+	// partial block at the end of the range (if any) is assigned to the
+	// last group, which is never one of the groups that received an extra
+	// whole block.
+	if ( work_id < n_th_hi )
+	{
+		*start = all_start + ( work_id * ( n_bf_lo + 1 ) ) * block_factor;
+		*end   = *start    + ( n_bf_lo + 1 ) * block_factor;
+	}
+	else
+	{
+		*start = all_start + ( n_th_hi * ( n_bf_lo + 1 ) +
+		                       ( work_id - n_th_hi ) * n_bf_lo ) * block_factor;
+		*end   = *start    + ( n_bf_lo ) * block_factor;
+	}
+
+	if ( work_id == n_way - 1 ) *end += n_bf_left;
+}
+
+static double bli_thread_stored_area( doff_t diagoff,
+                                      uplo_t uplo,
+                                      dim_t  m,
+                                      dim_t  j_start,
+                                      dim_t  j_end )
+{
+	double area = 0.0;
+	dim_t  j, m_j;
+
+	// Sum the number of stored elements in columns [j_start,j_end) of an
+	// m x n matrix whose diagonal begins at diagoff. An element (i,j) lies
+	// on the diagonal when j - i == diagoff.
+	for ( j = j_start; j < j_end; ++j )
+	{
+		if ( bli_is_lower( uplo ) ) m_j = m - bli_min( bli_max( j - diagoff, 0 ), m );
+		else                        m_j = bli_min( bli_max( j - diagoff + 1, 0 ), m );
+
+		area += ( double )m_j;
+	}
+
+	return area;
+}
+
+void bli_thread_get_range_weighted_l2r( dim_t  n_way,
+                                        dim_t  work_id,
+                                        doff_t diagoff,
+                                        uplo_t uplo,
+                                        dim_t  m,
+                                        dim_t  n,
+                                        dim_t  block_factor,
+                                        dim_t* start,
+                                        dim_t* end )
+{
+	dim_t  n_iter = ( n + block_factor - 1 ) / block_factor;
+	double area_total;
+	double area_blk;
+	double area_cum;
+	double target;
+	dim_t  bound[2];
+	dim_t  b, i;
+
+	// A dense matrix is partitioned evenly by width.
+	if ( bli_is_dense( uplo ) || n_way == 1 )
+	{
+		bli_thread_get_range( n_way, work_id, 0, n, block_factor,
+		                      start, end );
+		return;
+	}
+
+	// Partition the columns [0,n) into n_way sub-ranges whose boundaries
+	// fall on multiples of block_factor so that each sub-range contains
+	// (approximately) the same number of elements of the stored triangle,
+	// rather than the same number of columns. The boundary between groups
+	// t-1 and t is placed at the block boundary whose cumulative area is
+	// closest to t/n_way of the total. Since every thread computes the
+	// boundaries identically, the sub-ranges never overlap or leave gaps.
+	area_total = bli_thread_stored_area( diagoff, uplo, m, 0, n );
+
+	for ( i = 0; i < 2; ++i )
+	{
+		target   = area_total * ( double )( work_id + i ) / ( double )n_way;
+		area_cum = 0.0;
+
+		for ( b = 0; b < n_iter; ++b )
+		{
+			area_blk = bli_thread_stored_area( diagoff, uplo, m,
+			                                   b * block_factor,
+			                                   bli_min( ( b + 1 ) * block_factor, n ) );
+
+			if ( area_cum + area_blk > target )
+			{
+				if ( area_cum + area_blk - target < target - area_cum ) ++b;
+				break;
+			}
+
+			area_cum += area_blk;
+		}
+
+		bound[i] = bli_min( b * block_factor, n );
+	}
+
+	*start = ( work_id == 0         ? 0 : bound[0] );
+	*end   = ( work_id == n_way - 1 ? n : bound[1] );
+}
+
+void bli_thread_get_range_weighted_t2b( dim_t  n_way,
+                                        dim_t  work_id,
+                                        doff_t diagoff,
+                                        uplo_t uplo,
+                                        dim_t  m,
+                                        dim_t  n,
+                                        dim_t  block_factor,
+                                        dim_t* start,
+                                        dim_t* end )
+{
+	// Partitioning the rows of a matrix is equivalent to partitioning the
+	// columns of its transpose.
+	if ( bli_is_upper_or_lower( uplo ) ) bli_toggle_uplo( uplo );
+
+	bli_thread_get_range_weighted_l2r( n_way, work_id,
+	                                   -diagoff, uplo, n, m, block_factor,
+	                                   start, end );
+}
+
+
+// -- Thread count query/setting --
+
+static dim_t bli_thread_read_nway_from_env( char* env_var )
+{
+	char* str;
+	dim_t n_way = 1;
+
+	str = getenv( env_var );
+
+	if ( str != NULL ) n_way = ( dim_t ) strtol( str, NULL, 10 );
+
+	// Disregard nonsensical values.
+	if ( n_way < 1 ) n_way = 1;
+
+	return n_way;
+}
+
+static dim_t bli_thread_read_spin_usec_from_env( void )
+{
+	char* str;
+	dim_t spin_usec = BLIS_THREAD_SPIN_USEC;
+
+	str = getenv( "BLIS_THREAD_SPIN_USEC" );
+
+	if ( str != NULL ) spin_usec = ( dim_t ) strtol( str, NULL, 10 );
+
+	// Disregard nonsensical values.
+	if ( spin_usec < 0 ) spin_usec = BLIS_THREAD_SPIN_USEC;
+
+	return spin_usec;
+}
+
+void bli_thread_init( void )
+{
+	// Read the default number of ways of parallelism for each loop from
+	// the environment. These may be changed later via
+	// bli_thread_set_num_ways().
+	bli_thread_set_num_ways( bli_thread_read_nway_from_env( "BLIS_JC_NT" ),
+	                         bli_thread_read_nway_from_env( "BLIS_IC_NT" ),
+	                         bli_thread_read_nway_from_env( "BLIS_JR_NT" ),
+	                         bli_thread_read_nway_from_env( "BLIS_IR_NT" ) );
+
+	bli_thread_set_spin_usec( bli_thread_read_spin_usec_from_env() );
+
+	// Start the threads of the thread pool (if the threading back-end
+	// uses one) so that the first level-3 call does not pay for it.
+	bli_thread_pool_init( bli_thread_get_num_threads() );
+}
+
+void bli_thread_finalize( void )
+{
+	bli_thread_pool_finalize();
+}
+
+void bli_thread_set_num_ways( dim_t jc_nt,
+                              dim_t ic_nt,
+                              dim_t jr_nt,
+                              dim_t ir_nt )
+{
+#ifdef BLIS_ENABLE_MULTITHREADING
+	err_t e_val;
+
+	e_val = bli_check_valid_num_threads( jc_nt * ic_nt * jr_nt * ir_nt );
+	bli_check_error_code( e_val );
+
+	bli_jc_nt = bli_max( jc_nt, 1 );
+	bli_ic_nt = bli_max( ic_nt, 1 );
+	bli_jr_nt = bli_max( jr_nt, 1 );
+	bli_ir_nt = bli_max( ir_nt, 1 );
+#else
+	// Without a threading back-end, every loop is executed by one thread.
+	bli_jc_nt = 1;
+	bli_ic_nt = 1;
+	bli_jr_nt = 1;
+	bli_ir_nt = 1;
+#endif
+}
+
+dim_t bli_thread_get_jc_nt( void )
+{
+	return bli_jc_nt;
+}
+
+dim_t bli_thread_get_ic_nt( void )
+{
+	return bli_ic_nt;
+}
+
+dim_t bli_thread_get_jr_nt( void )
+{
+	return bli_jr_nt;
+}
+
+dim_t bli_thread_get_ir_nt( void )
+{
+	return bli_ir_nt;
+}
+
+dim_t bli_thread_get_num_threads( void )
+{
+	return bli_jc_nt * bli_ic_nt * bli_jr_nt * bli_ir_nt;
+}
+
+void bli_thread_set_spin_usec( dim_t spin_usec )
+{
+	bli_spin_usec = bli_max( spin_usec, 0 );
+}
+
+dim_t bli_thread_get_spin_usec( void )
+{
+	return bli_spin_usec;
+}
+
+
+// --- Begin single-threaded definitions ---------------------------------------
+#ifndef BLIS_ENABLE_MULTITHREADING
+
+void bli_mutex_init( bli_mutex_t* m )
+{
+}
+
+void bli_mutex_finalize( bli_mutex_t* m )
+{
+}
+
+void bli_mutex_lock( bli_mutex_t* m )
+{
+}
+
+void bli_mutex_unlock( bli_mutex_t* m )
+{
+}
+
+void bli_thread_pool_init( dim_t n_threads )
+{
+}
+
+void bli_thread_pool_finalize( void )
+{
+}
+
+void bli_level3_thread_decorator( dim_t        n_threads,
+                                  level3_int_t func,
+                                  obj_t*       alpha,
+                                  obj_t*       a,
+                                  obj_t*       b,
+                                  obj_t*       beta,
+                                  obj_t*       c,
+                                  void*        cntl,
+                                  void**       thread )
+{
+	// Without a threading back-end, n_threads is always one, so we simply
+	// call the function from the current thread.
+	func( alpha, a, b, beta, c, cntl, thread[0] );
+}
+
+#endif
+// --- End single-threaded definitions -----------------------------------------
+
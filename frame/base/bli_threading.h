@@ -0,0 +1,229 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_THREADING_H
+#define BLIS_THREADING_H
+
+// Perform a sanity check to make sure the user doesn't try to enable
+// both OpenMP and pthreads.
+#if defined ( BLIS_ENABLE_OPENMP ) && \
+    defined ( BLIS_ENABLE_PTHREADS )
+  #error "BLIS_ENABLE_OPENMP and BLIS_ENABLE_PTHREADS may not be simultaneously defined."
+#endif
+
+// Define a single macro that indicates whether any threading back-end
+// was enabled.
+#if defined ( BLIS_ENABLE_OPENMP ) || \
+    defined ( BLIS_ENABLE_PTHREADS )
+  #define BLIS_ENABLE_MULTITHREADING
+#endif
+
+// Include the back-end-specific definitions (each of which is empty
+// unless its back-end was enabled).
+#include "bli_threading_omp.h"
+#include "bli_threading_pthreads.h"
+
+// If no threading back-end was enabled, mutexes are never contended and
+// are therefore no-ops.
+#ifndef BLIS_ENABLE_MULTITHREADING
+typedef int bli_mutex_t;
+#endif
+
+// The default number of microseconds for which an idle thread of the
+// thread pool spins while waiting for work before it goes to sleep. This
+// may be changed at runtime via the BLIS_THREAD_SPIN_USEC environment
+// variable or bli_thread_set_spin_usec().
+#ifndef BLIS_THREAD_SPIN_USEC
+#define BLIS_THREAD_SPIN_USEC 100
+#endif
+
+
+// -- Thread communicator type --
+
+// A thread communicator is shared by a group of threads that need to
+// synchronize (eg: because they share a packed block of A or panel of B).
+typedef struct thread_comm_s
+{
+	void*           sent_object;
+	dim_t           n_threads;
+
+	volatile bool_t barrier_sense;
+	volatile dim_t  barrier_threads_arrived;
+} thread_comm_t;
+
+
+// -- Thread info type --
+
+// A thread info object describes the position of a single thread within
+// one node of a control tree. The threads that execute a node (those in
+// ocomm) are split n_way ways into sub-groups, each of which shares an
+// icomm and executes a disjoint portion (work_id) of the node's loop.
+// Operation-specific thread info types (eg: gemm_thrinfo_t) begin with
+// the same fields so that the thread_*() macros below apply to them as
+// well.
+typedef struct thrinfo_s
+{
+	// The communicator shared by all threads executing the current node,
+	// and the id of this thread within it.
+	thread_comm_t*  ocomm;
+	dim_t           ocomm_id;
+
+	// The communicator shared by the threads of this thread's sub-group,
+	// and the id of this thread within it.
+	thread_comm_t*  icomm;
+	dim_t           icomm_id;
+
+	// The number of sub-groups into which the threads of ocomm are split,
+	// and the index of the sub-group to which this thread belongs.
+	dim_t           n_way;
+	dim_t           work_id;
+} thrinfo_t;
+
+#define thread_num_threads( t )      ( (t)->ocomm->n_threads )
+#define thread_n_way( t )            ( (t)->n_way )
+#define thread_work_id( t )          ( (t)->work_id )
+#define thread_ocomm_id( t )         ( (t)->ocomm_id )
+#define thread_icomm_id( t )         ( (t)->icomm_id )
+
+#define thread_am_ochief( t )        ( (t)->ocomm_id == 0 )
+#define thread_am_ichief( t )        ( (t)->icomm_id == 0 )
+
+#define thread_obroadcast( t, ptr )  bli_thread_broadcast( (t)->ocomm, (t)->ocomm_id, ptr )
+#define thread_ibroadcast( t, ptr )  bli_thread_broadcast( (t)->icomm, (t)->icomm_id, ptr )
+#define thread_obarrier( t )         bli_thread_barrier( (t)->ocomm, (t)->ocomm_id )
+#define thread_ibarrier( t )         bli_thread_barrier( (t)->icomm, (t)->icomm_id )
+
+
+// -- Level-3 internal back-end function type --
+
+// The signature shared by the internal back-ends (eg: bli_gemm_int())
+// that are executed by each thread spawned by the thread decorator.
+typedef void (*level3_int_t)( obj_t* alpha,
+                              obj_t* a,
+                              obj_t* b,
+                              obj_t* beta,
+                              obj_t* c,
+                              void*  cntl,
+                              void*  thread );
+
+
+// -- Global variables --
+
+// A communicator for a "group" of one thread, which may be shared by any
+// number of single-threaded thread info objects since no synchronization
+// ever takes place on it.
+extern thread_comm_t BLIS_SINGLE_COMM;
+
+
+// -- Thread communicator prototypes --
+
+thread_comm_t* bli_thread_comm_create( dim_t n_threads );
+void           bli_thread_comm_init( dim_t n_threads, thread_comm_t* comm );
+void           bli_thread_comm_free( thread_comm_t* comm );
+
+void           bli_thread_barrier( thread_comm_t* comm, dim_t t_id );
+void*          bli_thread_broadcast( thread_comm_t* comm, dim_t t_id, void* to_send );
+
+
+// -- Work partitioning prototypes --
+
+void           bli_thread_get_range( dim_t  n_way,
+                                     dim_t  work_id,
+                                     dim_t  all_start,
+                                     dim_t  all_end,
+                                     dim_t  block_factor,
+                                     dim_t* start,
+                                     dim_t* end );
+void           bli_thread_get_range_weighted_l2r( dim_t  n_way,
+                                                  dim_t  work_id,
+                                                  doff_t diagoff,
+                                                  uplo_t uplo,
+                                                  dim_t  m,
+                                                  dim_t  n,
+                                                  dim_t  block_factor,
+                                                  dim_t* start,
+                                                  dim_t* end );
+void           bli_thread_get_range_weighted_t2b( dim_t  n_way,
+                                                  dim_t  work_id,
+                                                  doff_t diagoff,
+                                                  uplo_t uplo,
+                                                  dim_t  m,
+                                                  dim_t  n,
+                                                  dim_t  block_factor,
+                                                  dim_t* start,
+                                                  dim_t* end );
+
+
+// -- Thread count query/setting prototypes --
+
+void           bli_thread_init( void );
+void           bli_thread_finalize( void );
+
+void           bli_thread_set_num_ways( dim_t jc_nt,
+                                        dim_t ic_nt,
+                                        dim_t jr_nt,
+                                        dim_t ir_nt );
+dim_t          bli_thread_get_jc_nt( void );
+dim_t          bli_thread_get_ic_nt( void );
+dim_t          bli_thread_get_jr_nt( void );
+dim_t          bli_thread_get_ir_nt( void );
+dim_t          bli_thread_get_num_threads( void );
+
+void           bli_thread_set_spin_usec( dim_t spin_usec );
+dim_t          bli_thread_get_spin_usec( void );
+
+
+// -- Back-end-specific prototypes --
+
+void           bli_mutex_init( bli_mutex_t* m );
+void           bli_mutex_finalize( bli_mutex_t* m );
+void           bli_mutex_lock( bli_mutex_t* m );
+void           bli_mutex_unlock( bli_mutex_t* m );
+
+void           bli_thread_pool_init( dim_t n_threads );
+void           bli_thread_pool_finalize( void );
+
+void           bli_level3_thread_decorator( dim_t        n_threads,
+                                            level3_int_t func,
+                                            obj_t*       alpha,
+                                            obj_t*       a,
+                                            obj_t*       b,
+                                            obj_t*       beta,
+                                            obj_t*       c,
+                                            void*        cntl,
+                                            void**       thread );
+
+
+#endif
+
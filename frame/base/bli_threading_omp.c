@@ -0,0 +1,96 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_OPENMP
+
+void bli_mutex_init( bli_mutex_t* m )
+{
+	omp_init_lock( m );
+}
+
+void bli_mutex_finalize( bli_mutex_t* m )
+{
+	omp_destroy_lock( m );
+}
+
+void bli_mutex_lock( bli_mutex_t* m )
+{
+	omp_set_lock( m );
+}
+
+void bli_mutex_unlock( bli_mutex_t* m )
+{
+	omp_unset_lock( m );
+}
+
+void bli_thread_pool_init( dim_t n_threads )
+{
+	// The OpenMP runtime maintains its own pool of threads, which persist
+	// across parallel regions. (The time for which they spin before going
+	// to sleep is governed by the runtime, eg: via OMP_WAIT_POLICY.)
+}
+
+void bli_thread_pool_finalize( void )
+{
+}
+
+void bli_level3_thread_decorator( dim_t        n_threads,
+                                  level3_int_t func,
+                                  obj_t*       alpha,
+                                  obj_t*       a,
+                                  obj_t*       b,
+                                  obj_t*       beta,
+                                  obj_t*       c,
+                                  void*        cntl,
+                                  void**       thread )
+{
+	// Skip the parallel region entirely when there is only one thread.
+	if ( n_threads == 1 )
+	{
+		func( alpha, a, b, beta, c, cntl, thread[0] );
+		return;
+	}
+
+	#pragma omp parallel num_threads( n_threads )
+	{
+		dim_t omp_id = omp_get_thread_num();
+
+		func( alpha, a, b, beta, c, cntl, thread[omp_id] );
+	}
+}
+
+#endif
+
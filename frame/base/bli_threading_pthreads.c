@@ -0,0 +1,429 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_PTHREADS
+
+void bli_mutex_init( bli_mutex_t* m )
+{
+	pthread_mutex_init( m, NULL );
+}
+
+void bli_mutex_finalize( bli_mutex_t* m )
+{
+	pthread_mutex_destroy( m );
+}
+
+void bli_mutex_lock( bli_mutex_t* m )
+{
+	pthread_mutex_lock( m );
+}
+
+void bli_mutex_unlock( bli_mutex_t* m )
+{
+	pthread_mutex_unlock( m );
+}
+
+// A structure to package the arguments passed to each spawned thread.
+typedef struct thread_data_s
+{
+	level3_int_t func;
+	obj_t*       alpha;
+	obj_t*       a;
+	obj_t*       b;
+	obj_t*       beta;
+	obj_t*       c;
+	void*        cntl;
+	void*        thread;
+} thread_data_t;
+
+static void* bli_l3_thread_entry( void* data_void )
+{
+	thread_data_t* data = data_void;
+
+	data->func( data->alpha,
+	            data->a,
+	            data->b,
+	            data->beta,
+	            data->c,
+	            data->cntl,
+	            data->thread );
+
+	return NULL;
+}
+
+// -- Thread pool --
+
+// A worker of the thread pool. The worker assumes the role of one of the
+// threads 1 through n_threads-1 of each job posted to it.
+typedef struct thread_pool_worker_s
+{
+	pthread_t       pthread;
+
+	// The arguments of the current job. A NULL function tells the worker
+	// to exit.
+	thread_data_t   data;
+
+	// Set by the posting thread when a job is available, and cleared by
+	// the worker once it has finished the job.
+	volatile bool_t has_job;
+
+	// Set by the worker while it is (about to be) blocked on cond, in
+	// which case the posting thread must signal cond to wake it up.
+	volatile bool_t sleeping;
+	pthread_mutex_t lock;
+	pthread_cond_t  cond;
+} thread_pool_worker_t;
+
+// The threads of the pool persist from bli_init() until bli_finalize() so
+// that each level-3 call only pays for handing its work to threads that
+// already exist rather than for creating and joining them.
+typedef struct thread_pool_s
+{
+	bool_t               initialized;
+
+	// Held by the application thread that is currently using the pool.
+	// Only one application thread may use the pool at a time; any other
+	// thread that finds the pool busy (including a thread of the pool
+	// itself, should a level-3 operation ever be nested) spawns its own
+	// threads instead of waiting.
+	pthread_mutex_t      busy;
+
+	// The number of workers that have been started, and the number of
+	// workers that have yet to finish the current job.
+	dim_t                n_workers;
+	volatile dim_t       n_running;
+
+	thread_pool_worker_t workers[ BLIS_MAX_NUM_THREADS ];
+} thread_pool_t;
+
+static thread_pool_t bli_pool = { FALSE };
+
+static void bli_thread_pool_wait_job( thread_pool_worker_t* worker )
+{
+	double spin_sec = ( double )bli_thread_get_spin_usec() * 1.0e-6;
+	double t_start  = bli_clock();
+	dim_t  n_spins  = 0;
+
+	// Spin until a job is posted or the spin time elapses, whichever comes
+	// first. (The clock is only read every so often since reading it takes
+	// much longer than checking for a job.)
+	while ( !worker->has_job )
+	{
+		if ( ++n_spins % 256 == 0 && bli_clock() - t_start >= spin_sec )
+			break;
+	}
+
+	if ( worker->has_job ) return;
+
+	// Go to sleep. Since we announce that we are sleeping before checking
+	// for a job one last time (and the posting thread checks whether we
+	// are sleeping only after posting the job), a job is never posted
+	// without either us noticing it or the posting thread signaling us.
+	pthread_mutex_lock( &worker->lock );
+
+	worker->sleeping = TRUE;
+	__sync_synchronize();
+
+	while ( !worker->has_job )
+		pthread_cond_wait( &worker->cond, &worker->lock );
+
+	worker->sleeping = FALSE;
+
+	pthread_mutex_unlock( &worker->lock );
+}
+
+static void* bli_thread_pool_worker_entry( void* worker_void )
+{
+	thread_pool_worker_t* worker = worker_void;
+
+	while ( 1 )
+	{
+		bli_thread_pool_wait_job( worker );
+
+		// Make sure that we see the job's arguments.
+		__sync_synchronize();
+
+		if ( worker->data.func == NULL ) break;
+
+		bli_l3_thread_entry( &worker->data );
+
+		// Announce that we are done. The job flag must be cleared before
+		// the posting thread can observe that the job is complete.
+		worker->has_job = FALSE;
+		__sync_fetch_and_sub( &bli_pool.n_running, 1 );
+	}
+
+	return NULL;
+}
+
+static void bli_thread_pool_post_job( thread_pool_worker_t* worker )
+{
+	// Make the job's arguments visible before announcing the job, and
+	// announce the job before checking whether the worker is asleep.
+	__sync_synchronize();
+	worker->has_job = TRUE;
+	__sync_synchronize();
+
+	if ( worker->sleeping )
+	{
+		pthread_mutex_lock( &worker->lock );
+		pthread_cond_signal( &worker->cond );
+		pthread_mutex_unlock( &worker->lock );
+	}
+}
+
+static void bli_thread_pool_grow( dim_t n_workers )
+{
+	thread_pool_worker_t* worker;
+	dim_t                 i;
+
+	// Start workers until there are n_workers of them. The caller must
+	// hold the busy lock (or otherwise have exclusive use of the pool).
+	for ( i = bli_pool.n_workers; i < n_workers; ++i )
+	{
+		worker = &bli_pool.workers[i];
+
+		worker->has_job  = FALSE;
+		worker->sleeping = FALSE;
+		pthread_mutex_init( &worker->lock, NULL );
+		pthread_cond_init( &worker->cond, NULL );
+
+		pthread_create( &worker->pthread, NULL,
+		                bli_thread_pool_worker_entry, worker );
+	}
+
+	bli_pool.n_workers = bli_max( bli_pool.n_workers, n_workers );
+}
+
+void bli_thread_pool_init( dim_t n_threads )
+{
+	if ( bli_pool.initialized ) return;
+
+	pthread_mutex_init( &bli_pool.busy, NULL );
+
+	bli_pool.n_workers   = 0;
+	bli_pool.n_running   = 0;
+	bli_pool.initialized = TRUE;
+
+	// Start enough workers to accompany the calling thread in executing
+	// the default number of threads. More are started on demand if the
+	// number of threads is later increased.
+	bli_thread_pool_grow( bli_min( n_threads, BLIS_MAX_NUM_THREADS ) - 1 );
+}
+
+void bli_thread_pool_finalize( void )
+{
+	thread_pool_worker_t* worker;
+	dim_t                 i;
+
+	if ( !bli_pool.initialized ) return;
+
+	// Wait for any application thread that is using the pool to finish.
+	pthread_mutex_lock( &bli_pool.busy );
+
+	// Tell each worker to exit and wait for it to do so.
+	for ( i = 0; i < bli_pool.n_workers; ++i )
+	{
+		worker = &bli_pool.workers[i];
+
+		worker->data.func = NULL;
+		bli_thread_pool_post_job( worker );
+	}
+
+	for ( i = 0; i < bli_pool.n_workers; ++i )
+	{
+		worker = &bli_pool.workers[i];
+
+		pthread_join( worker->pthread, NULL );
+		pthread_mutex_destroy( &worker->lock );
+		pthread_cond_destroy( &worker->cond );
+	}
+
+	bli_pool.n_workers   = 0;
+	bli_pool.initialized = FALSE;
+
+	pthread_mutex_unlock( &bli_pool.busy );
+	pthread_mutex_destroy( &bli_pool.busy );
+}
+
+static void bli_level3_thread_decorator_pool( dim_t        n_threads,
+                                              level3_int_t func,
+                                              obj_t*       alpha,
+                                              obj_t*       a,
+                                              obj_t*       b,
+                                              obj_t*       beta,
+                                              obj_t*       c,
+                                              void*        cntl,
+                                              void**       thread )
+{
+	thread_data_t         data;
+	thread_pool_worker_t* worker;
+	double                spin_sec;
+	double                t_start;
+	dim_t                 n_spins;
+	dim_t                 i;
+
+	bli_thread_pool_grow( n_threads - 1 );
+
+	bli_pool.n_running = n_threads - 1;
+
+	// Hand threads 1 through n_threads-1 to the workers.
+	for ( i = 1; i < n_threads; ++i )
+	{
+		worker = &bli_pool.workers[i-1];
+
+		worker->data.func   = func;
+		worker->data.alpha  = alpha;
+		worker->data.a      = a;
+		worker->data.b      = b;
+		worker->data.beta   = beta;
+		worker->data.c      = c;
+		worker->data.cntl   = cntl;
+		worker->data.thread = thread[i];
+
+		bli_thread_pool_post_job( worker );
+	}
+
+	// The calling thread assumes the role of thread 0.
+	data.func   = func;
+	data.alpha  = alpha;
+	data.a      = a;
+	data.b      = b;
+	data.beta   = beta;
+	data.c      = c;
+	data.cntl   = cntl;
+	data.thread = thread[0];
+
+	bli_l3_thread_entry( &data );
+
+	// Wait for the workers to finish. If they take longer than the spin
+	// time, yield the processor to them while we wait.
+	spin_sec = ( double )bli_thread_get_spin_usec() * 1.0e-6;
+	t_start  = bli_clock();
+	n_spins  = 0;
+
+	while ( bli_pool.n_running > 0 )
+	{
+		if ( ++n_spins % 256 == 0 && bli_clock() - t_start >= spin_sec )
+			sched_yield();
+	}
+
+	// Make sure that we see the results of the workers.
+	__sync_synchronize();
+}
+
+static void bli_level3_thread_decorator_spawn( dim_t        n_threads,
+                                               level3_int_t func,
+                                               obj_t*       alpha,
+                                               obj_t*       a,
+                                               obj_t*       b,
+                                               obj_t*       beta,
+                                               obj_t*       c,
+                                               void*        cntl,
+                                               void**       thread )
+{
+	pthread_t*     pthreads;
+	thread_data_t* datas;
+	dim_t          i;
+
+	pthreads = ( pthread_t*     ) bli_malloc( sizeof(pthread_t)     * n_threads );
+	datas    = ( thread_data_t* ) bli_malloc( sizeof(thread_data_t) * n_threads );
+
+	for ( i = 0; i < n_threads; ++i )
+	{
+		datas[i].func   = func;
+		datas[i].alpha  = alpha;
+		datas[i].a      = a;
+		datas[i].b      = b;
+		datas[i].beta   = beta;
+		datas[i].c      = c;
+		datas[i].cntl   = cntl;
+		datas[i].thread = thread[i];
+	}
+
+	// Spawn n_threads - 1 threads and let the calling thread assume the
+	// role of thread 0.
+	for ( i = 1; i < n_threads; ++i )
+		pthread_create( &pthreads[i], NULL, bli_l3_thread_entry, &datas[i] );
+
+	bli_l3_thread_entry( &datas[0] );
+
+	for ( i = 1; i < n_threads; ++i )
+		pthread_join( pthreads[i], NULL );
+
+	bli_free( pthreads );
+	bli_free( datas );
+}
+
+void bli_level3_thread_decorator( dim_t        n_threads,
+                                  level3_int_t func,
+                                  obj_t*       alpha,
+                                  obj_t*       a,
+                                  obj_t*       b,
+                                  obj_t*       beta,
+                                  obj_t*       c,
+                                  void*        cntl,
+                                  void**       thread )
+{
+	// Skip thread creation entirely when there is only one thread.
+	if ( n_threads == 1 )
+	{
+		func( alpha, a, b, beta, c, cntl, thread[0] );
+		return;
+	}
+
+	// Use the thread pool if it is available. Otherwise, (eg: because
+	// another application thread is currently using it), fall back to
+	// spawning threads for this call only.
+	if ( bli_pool.initialized &&
+	     pthread_mutex_trylock( &bli_pool.busy ) == 0 )
+	{
+		bli_level3_thread_decorator_pool( n_threads, func,
+		                                  alpha, a, b, beta, c,
+		                                  cntl, thread );
+
+		pthread_mutex_unlock( &bli_pool.busy );
+	}
+	else
+	{
+		bli_level3_thread_decorator_spawn( n_threads, func,
+		                                   alpha, a, b, beta, c,
+		                                   cntl, thread );
+	}
+}
+
+#endif
+
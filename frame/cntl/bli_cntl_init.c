@@ -36,6 +36,12 @@
 
 void bli_cntl_init( void )
 {
+	// The control trees created here are shared by every call to BLIS,
+	// including concurrent calls from different application threads. They
+	// must therefore never be modified after initialization; all state
+	// that is particular to a call (eg: pack objects, thread info) is kept
+	// by the call itself.
+
 	// Level-1
 	bli_scalv_cntl_init();
 	bli_packv_cntl_init();
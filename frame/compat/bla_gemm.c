@@ -111,6 +111,6 @@ void PASTEF77(ch,blasname)( \
 }
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
-INSERT_GENTFUNC_BLAS( gemm, gemm )
+INSERT_GENTFUNC_BLAS( gemm, gemm_fast )
 #endif
 
@@ -312,6 +312,45 @@
 
 
 
+// -- Define 3m-specific runtime blocksize macros ------------------------------
+
+// These are the 3m blocksizes stored in the control trees (see the runtime
+// blocksize macros in bli_kernel_macro_defs.h). The register blocksizes
+// always track those of the real micro-kernels. When the kernels are chosen
+// at runtime, the cache blocksizes are derived from the real runtime
+// blocksizes in the same way that the defaults above are derived from the
+// real defaults.
+
+// 3m runtime register blocksizes
+#define BLIS_RUNTIME_3M_MR_C     BLIS_RUNTIME_MR_S
+#define BLIS_RUNTIME_3M_KR_C     BLIS_RUNTIME_KR_S
+#define BLIS_RUNTIME_3M_NR_C     BLIS_RUNTIME_NR_S
+
+#define BLIS_RUNTIME_3M_MR_Z     BLIS_RUNTIME_MR_D
+#define BLIS_RUNTIME_3M_KR_Z     BLIS_RUNTIME_KR_D
+#define BLIS_RUNTIME_3M_NR_Z     BLIS_RUNTIME_NR_D
+
+// 3m runtime cache blocksizes
+#ifdef BLIS_ENABLE_ARCH_DISPATCH
+#define BLIS_RUNTIME_3M_MC_C     ((BLIS_RUNTIME_MC_S)/1)
+#define BLIS_RUNTIME_3M_KC_C     ((BLIS_RUNTIME_KC_S)/2)
+#define BLIS_RUNTIME_3M_NC_C     ((BLIS_RUNTIME_NC_S)/1)
+
+#define BLIS_RUNTIME_3M_MC_Z     ((BLIS_RUNTIME_MC_D)/1)
+#define BLIS_RUNTIME_3M_KC_Z     ((BLIS_RUNTIME_KC_D)/2)
+#define BLIS_RUNTIME_3M_NC_Z     ((BLIS_RUNTIME_NC_D)/1)
+#else
+#define BLIS_RUNTIME_3M_MC_C     BLIS_DEFAULT_3M_MC_C
+#define BLIS_RUNTIME_3M_KC_C     BLIS_DEFAULT_3M_KC_C
+#define BLIS_RUNTIME_3M_NC_C     BLIS_DEFAULT_3M_NC_C
+
+#define BLIS_RUNTIME_3M_MC_Z     BLIS_DEFAULT_3M_MC_Z
+#define BLIS_RUNTIME_3M_KC_Z     BLIS_DEFAULT_3M_KC_Z
+#define BLIS_RUNTIME_3M_NC_Z     BLIS_DEFAULT_3M_NC_Z
+#endif
+
+
+
 // -- Kernel blocksize checks --------------------------------------------------
 
 // Verify that cache blocksizes are whole multiples of register blocksizes.
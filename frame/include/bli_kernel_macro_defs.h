@@ -147,6 +147,39 @@
 #define BLIS_ZTRSM_U_UKERNEL BLIS_ZTRSM_U_UKERNEL_REF
 #endif
 
+// gemm edge micro-kernels
+
+// A configuration may optionally pair its gemm micro-kernel for a given
+// datatype with an edge micro-kernel, which computes only the leading
+// m x n part of an MR x NR tile (and so may update a partial tile of C
+// in place). These have no reference implementations; instead, we define
+// the corresponding _PTR macro to NULL, in which case the macro-kernels
+// compute partial tiles via a temporary buffer.
+
+#ifdef  BLIS_SGEMM_EDGE_UKERNEL
+#define BLIS_SGEMM_EDGE_UKERNEL_PTR BLIS_SGEMM_EDGE_UKERNEL
+#else
+#define BLIS_SGEMM_EDGE_UKERNEL_PTR NULL
+#endif
+
+#ifdef  BLIS_DGEMM_EDGE_UKERNEL
+#define BLIS_DGEMM_EDGE_UKERNEL_PTR BLIS_DGEMM_EDGE_UKERNEL
+#else
+#define BLIS_DGEMM_EDGE_UKERNEL_PTR NULL
+#endif
+
+#ifdef  BLIS_CGEMM_EDGE_UKERNEL
+#define BLIS_CGEMM_EDGE_UKERNEL_PTR BLIS_CGEMM_EDGE_UKERNEL
+#else
+#define BLIS_CGEMM_EDGE_UKERNEL_PTR NULL
+#endif
+
+#ifdef  BLIS_ZGEMM_EDGE_UKERNEL
+#define BLIS_ZGEMM_EDGE_UKERNEL_PTR BLIS_ZGEMM_EDGE_UKERNEL
+#else
+#define BLIS_ZGEMM_EDGE_UKERNEL_PTR NULL
+#endif
+
 //
 // Level-1m
 //
@@ -1287,6 +1320,123 @@
 
 
 
+// -- Define runtime blocksize macros ------------------------------------------
+
+// The blocksizes above are known at compile-time and are used to check the
+// constraints among them, to size the memory pools, and to size the stack
+// buffers used at edge cases. The macros below give the blocksizes that
+// are actually stored in the control trees and assumed by the micro-kernels.
+// Usually these are the same values. However, a configuration that defines
+// BLIS_ENABLE_ARCH_DISPATCH chooses its kernels (and thus its blocksizes)
+// when BLIS is initialized. Such a configuration defines the blocksizes
+// above to be upper bounds on those of all of its sub-configurations and
+// defines the runtime blocksizes below in terms of the values selected by
+// bli_arch_select().
+
+
+#ifndef BLIS_RUNTIME_MC_S
+#define BLIS_RUNTIME_MC_S  BLIS_DEFAULT_MC_S
+#endif
+
+#ifndef BLIS_RUNTIME_MC_D
+#define BLIS_RUNTIME_MC_D  BLIS_DEFAULT_MC_D
+#endif
+
+#ifndef BLIS_RUNTIME_MC_C
+#define BLIS_RUNTIME_MC_C  BLIS_DEFAULT_MC_C
+#endif
+
+#ifndef BLIS_RUNTIME_MC_Z
+#define BLIS_RUNTIME_MC_Z  BLIS_DEFAULT_MC_Z
+#endif
+
+
+#ifndef BLIS_RUNTIME_KC_S
+#define BLIS_RUNTIME_KC_S  BLIS_DEFAULT_KC_S
+#endif
+
+#ifndef BLIS_RUNTIME_KC_D
+#define BLIS_RUNTIME_KC_D  BLIS_DEFAULT_KC_D
+#endif
+
+#ifndef BLIS_RUNTIME_KC_C
+#define BLIS_RUNTIME_KC_C  BLIS_DEFAULT_KC_C
+#endif
+
+#ifndef BLIS_RUNTIME_KC_Z
+#define BLIS_RUNTIME_KC_Z  BLIS_DEFAULT_KC_Z
+#endif
+
+
+#ifndef BLIS_RUNTIME_NC_S
+#define BLIS_RUNTIME_NC_S  BLIS_DEFAULT_NC_S
+#endif
+
+#ifndef BLIS_RUNTIME_NC_D
+#define BLIS_RUNTIME_NC_D  BLIS_DEFAULT_NC_D
+#endif
+
+#ifndef BLIS_RUNTIME_NC_C
+#define BLIS_RUNTIME_NC_C  BLIS_DEFAULT_NC_C
+#endif
+
+#ifndef BLIS_RUNTIME_NC_Z
+#define BLIS_RUNTIME_NC_Z  BLIS_DEFAULT_NC_Z
+#endif
+
+
+#ifndef BLIS_RUNTIME_MR_S
+#define BLIS_RUNTIME_MR_S  BLIS_DEFAULT_MR_S
+#endif
+
+#ifndef BLIS_RUNTIME_MR_D
+#define BLIS_RUNTIME_MR_D  BLIS_DEFAULT_MR_D
+#endif
+
+#ifndef BLIS_RUNTIME_MR_C
+#define BLIS_RUNTIME_MR_C  BLIS_DEFAULT_MR_C
+#endif
+
+#ifndef BLIS_RUNTIME_MR_Z
+#define BLIS_RUNTIME_MR_Z  BLIS_DEFAULT_MR_Z
+#endif
+
+
+#ifndef BLIS_RUNTIME_KR_S
+#define BLIS_RUNTIME_KR_S  BLIS_DEFAULT_KR_S
+#endif
+
+#ifndef BLIS_RUNTIME_KR_D
+#define BLIS_RUNTIME_KR_D  BLIS_DEFAULT_KR_D
+#endif
+
+#ifndef BLIS_RUNTIME_KR_C
+#define BLIS_RUNTIME_KR_C  BLIS_DEFAULT_KR_C
+#endif
+
+#ifndef BLIS_RUNTIME_KR_Z
+#define BLIS_RUNTIME_KR_Z  BLIS_DEFAULT_KR_Z
+#endif
+
+
+#ifndef BLIS_RUNTIME_NR_S
+#define BLIS_RUNTIME_NR_S  BLIS_DEFAULT_NR_S
+#endif
+
+#ifndef BLIS_RUNTIME_NR_D
+#define BLIS_RUNTIME_NR_D  BLIS_DEFAULT_NR_D
+#endif
+
+#ifndef BLIS_RUNTIME_NR_C
+#define BLIS_RUNTIME_NR_C  BLIS_DEFAULT_NR_C
+#endif
+
+#ifndef BLIS_RUNTIME_NR_Z
+#define BLIS_RUNTIME_NR_Z  BLIS_DEFAULT_NR_Z
+#endif
+
+
+
 // -- Abbreiviated kernel blocksize macros -------------------------------------
 
 // Here, we shorten the blocksizes defined in bli_kernel.h so that they can
@@ -1294,39 +1444,39 @@
 
 // Default (minimum) cache blocksizes
 
-#define bli_smc      BLIS_DEFAULT_MC_S 
-#define bli_skc      BLIS_DEFAULT_KC_S
-#define bli_snc      BLIS_DEFAULT_NC_S
+#define bli_smc      BLIS_RUNTIME_MC_S 
+#define bli_skc      BLIS_RUNTIME_KC_S
+#define bli_snc      BLIS_RUNTIME_NC_S
 
-#define bli_dmc      BLIS_DEFAULT_MC_D 
-#define bli_dkc      BLIS_DEFAULT_KC_D
-#define bli_dnc      BLIS_DEFAULT_NC_D
+#define bli_dmc      BLIS_RUNTIME_MC_D 
+#define bli_dkc      BLIS_RUNTIME_KC_D
+#define bli_dnc      BLIS_RUNTIME_NC_D
 
-#define bli_cmc      BLIS_DEFAULT_MC_C 
-#define bli_ckc      BLIS_DEFAULT_KC_C
-#define bli_cnc      BLIS_DEFAULT_NC_C
+#define bli_cmc      BLIS_RUNTIME_MC_C 
+#define bli_ckc      BLIS_RUNTIME_KC_C
+#define bli_cnc      BLIS_RUNTIME_NC_C
 
-#define bli_zmc      BLIS_DEFAULT_MC_Z 
-#define bli_zkc      BLIS_DEFAULT_KC_Z
-#define bli_znc      BLIS_DEFAULT_NC_Z
+#define bli_zmc      BLIS_RUNTIME_MC_Z 
+#define bli_zkc      BLIS_RUNTIME_KC_Z
+#define bli_znc      BLIS_RUNTIME_NC_Z
 
 // Register blocksizes
 
-#define bli_smr      BLIS_DEFAULT_MR_S 
-#define bli_skr      BLIS_DEFAULT_KR_S
-#define bli_snr      BLIS_DEFAULT_NR_S
+#define bli_smr      BLIS_RUNTIME_MR_S 
+#define bli_skr      BLIS_RUNTIME_KR_S
+#define bli_snr      BLIS_RUNTIME_NR_S
 
-#define bli_dmr      BLIS_DEFAULT_MR_D 
-#define bli_dkr      BLIS_DEFAULT_KR_D
-#define bli_dnr      BLIS_DEFAULT_NR_D
+#define bli_dmr      BLIS_RUNTIME_MR_D 
+#define bli_dkr      BLIS_RUNTIME_KR_D
+#define bli_dnr      BLIS_RUNTIME_NR_D
 
-#define bli_cmr      BLIS_DEFAULT_MR_C 
-#define bli_ckr      BLIS_DEFAULT_KR_C
-#define bli_cnr      BLIS_DEFAULT_NR_C
+#define bli_cmr      BLIS_RUNTIME_MR_C 
+#define bli_ckr      BLIS_RUNTIME_KR_C
+#define bli_cnr      BLIS_RUNTIME_NR_C
 
-#define bli_zmr      BLIS_DEFAULT_MR_Z 
-#define bli_zkr      BLIS_DEFAULT_KR_Z
-#define bli_znr      BLIS_DEFAULT_NR_Z
+#define bli_zmr      BLIS_RUNTIME_MR_Z 
+#define bli_zkr      BLIS_RUNTIME_KR_Z
+#define bli_znr      BLIS_RUNTIME_NR_Z
 
 // Extended (maximum) cache blocksizes
 
@@ -1348,21 +1498,21 @@
 
 // Extended (packing) register blocksizes
 
-#define bli_spackmr  BLIS_PACKDIM_MR_S
-#define bli_spackkr  BLIS_PACKDIM_KR_S
-#define bli_spacknr  BLIS_PACKDIM_NR_S
+#define bli_spackmr  ( BLIS_RUNTIME_MR_S + BLIS_EXTEND_MR_S )
+#define bli_spackkr  ( BLIS_RUNTIME_KR_S                    )
+#define bli_spacknr  ( BLIS_RUNTIME_NR_S + BLIS_EXTEND_NR_S )
 
-#define bli_dpackmr  BLIS_PACKDIM_MR_D
-#define bli_dpackkr  BLIS_PACKDIM_KR_D
-#define bli_dpacknr  BLIS_PACKDIM_NR_D
+#define bli_dpackmr  ( BLIS_RUNTIME_MR_D + BLIS_EXTEND_MR_D )
+#define bli_dpackkr  ( BLIS_RUNTIME_KR_D                    )
+#define bli_dpacknr  ( BLIS_RUNTIME_NR_D + BLIS_EXTEND_NR_D )
 
-#define bli_cpackmr  BLIS_PACKDIM_MR_C
-#define bli_cpackkr  BLIS_PACKDIM_KR_C
-#define bli_cpacknr  BLIS_PACKDIM_NR_C
+#define bli_cpackmr  ( BLIS_RUNTIME_MR_C + BLIS_EXTEND_MR_C )
+#define bli_cpackkr  ( BLIS_RUNTIME_KR_C                    )
+#define bli_cpacknr  ( BLIS_RUNTIME_NR_C + BLIS_EXTEND_NR_C )
 
-#define bli_zpackmr  BLIS_PACKDIM_MR_Z
-#define bli_zpackkr  BLIS_PACKDIM_KR_Z
-#define bli_zpacknr  BLIS_PACKDIM_NR_Z
+#define bli_zpackmr  ( BLIS_RUNTIME_MR_Z + BLIS_EXTEND_MR_Z )
+#define bli_zpackkr  ( BLIS_RUNTIME_KR_Z                    )
+#define bli_zpacknr  ( BLIS_RUNTIME_NR_Z + BLIS_EXTEND_NR_Z )
 
 // Level-1f fusing factors
 
@@ -38,6 +38,12 @@
 
 // -- Define PASTEMAC-friendly kernel function name macros ---------------------
 
+// NOTE: The prototypes below are explicitly declared extern so that a
+// configuration that chooses its kernels at runtime (see
+// BLIS_ENABLE_ARCH_DISPATCH) may define a kernel name to be a dereferenced
+// function pointer, e.g. ( *bli_x86_64_sgemm_ukernel ), in which case the
+// prototype declares that pointer.
+
 //
 // Level-3
 //
@@ -52,7 +58,7 @@
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        dim_t           k, \
        ctype* restrict alpha, \
@@ -75,7 +81,7 @@ INSERT_GENTPROT_BASIC( GEMM_UKERNEL )
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        dim_t           k, \
        ctype* restrict alpha, \
@@ -99,7 +105,7 @@ INSERT_GENTPROT_BASIC( GEMMTRSM_L_UKERNEL )
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        dim_t           k, \
        ctype* restrict alpha, \
@@ -123,7 +129,7 @@ INSERT_GENTPROT_BASIC( GEMMTRSM_U_UKERNEL )
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        ctype* restrict a11, \
        ctype* restrict b11, \
@@ -143,7 +149,7 @@ INSERT_GENTPROT_BASIC( TRSM_L_UKERNEL )
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        ctype* restrict a11, \
        ctype* restrict b11, \
@@ -153,6 +159,42 @@ void PASTEMAC(ch,kername) \
 
 INSERT_GENTPROT_BASIC( TRSM_U_UKERNEL )
 
+// gemm edge micro-kernels (optional)
+
+#define bli_sGEMM_EDGE_UKERNEL BLIS_SGEMM_EDGE_UKERNEL
+#define bli_dGEMM_EDGE_UKERNEL BLIS_DGEMM_EDGE_UKERNEL
+#define bli_cGEMM_EDGE_UKERNEL BLIS_CGEMM_EDGE_UKERNEL
+#define bli_zGEMM_EDGE_UKERNEL BLIS_ZGEMM_EDGE_UKERNEL
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, kername ) \
+\
+extern void PASTEMAC(ch,kername) \
+     ( \
+       dim_t           m, \
+       dim_t           n, \
+       dim_t           k, \
+       ctype* restrict alpha, \
+       ctype* restrict a, \
+       ctype* restrict b, \
+       ctype* restrict beta, \
+       ctype* restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t*      data  \
+     );
+
+#ifdef BLIS_SGEMM_EDGE_UKERNEL
+GENTPROT( float,    s, GEMM_EDGE_UKERNEL )
+#endif
+#ifdef BLIS_DGEMM_EDGE_UKERNEL
+GENTPROT( double,   d, GEMM_EDGE_UKERNEL )
+#endif
+#ifdef BLIS_CGEMM_EDGE_UKERNEL
+GENTPROT( scomplex, c, GEMM_EDGE_UKERNEL )
+#endif
+#ifdef BLIS_ZGEMM_EDGE_UKERNEL
+GENTPROT( dcomplex, z, GEMM_EDGE_UKERNEL )
+#endif
+
 
 //
 // Level-3 4m
@@ -166,7 +208,7 @@ INSERT_GENTPROT_BASIC( TRSM_U_UKERNEL )
 #undef  GENTPROTCO
 #define GENTPROTCO( ctype, ctype_r, ch, chr, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        dim_t           k, \
        ctype* restrict alpha, \
@@ -187,7 +229,7 @@ INSERT_GENTPROTCO_BASIC( GEMM4M_UKERNEL )
 #undef  GENTPROTCO
 #define GENTPROTCO( ctype, ctype_r, ch, chr, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        dim_t           k, \
        ctype* restrict alpha, \
@@ -209,7 +251,7 @@ INSERT_GENTPROTCO_BASIC( GEMMTRSM4M_L_UKERNEL )
 #undef  GENTPROTCO
 #define GENTPROTCO( ctype, ctype_r, ch, chr, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        dim_t           k, \
        ctype* restrict alpha, \
@@ -231,7 +273,7 @@ INSERT_GENTPROTCO_BASIC( GEMMTRSM4M_U_UKERNEL )
 #undef  GENTPROTCO
 #define GENTPROTCO( ctype, ctype_r, ch, chr, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        ctype_r* restrict a11r, \
        ctype_r* restrict b11r, \
@@ -249,7 +291,7 @@ INSERT_GENTPROTCO_BASIC( TRSM4M_L_UKERNEL )
 #undef  GENTPROTCO
 #define GENTPROTCO( ctype, ctype_r, ch, chr, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        ctype_r* restrict a11r, \
        ctype_r* restrict b11r, \
@@ -272,7 +314,7 @@ INSERT_GENTPROTCO_BASIC( TRSM4M_U_UKERNEL )
 #undef  GENTPROTCO
 #define GENTPROTCO( ctype, ctype_r, ch, chr, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        dim_t           k, \
        ctype* restrict alpha, \
@@ -293,7 +335,7 @@ INSERT_GENTPROTCO_BASIC( GEMM3M_UKERNEL )
 #undef  GENTPROTCO
 #define GENTPROTCO( ctype, ctype_r, ch, chr, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        dim_t           k, \
        ctype* restrict alpha, \
@@ -315,7 +357,7 @@ INSERT_GENTPROTCO_BASIC( GEMMTRSM3M_L_UKERNEL )
 #undef  GENTPROTCO
 #define GENTPROTCO( ctype, ctype_r, ch, chr, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        dim_t           k, \
        ctype* restrict alpha, \
@@ -337,7 +379,7 @@ INSERT_GENTPROTCO_BASIC( GEMMTRSM3M_U_UKERNEL )
 #undef  GENTPROTCO
 #define GENTPROTCO( ctype, ctype_r, ch, chr, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        ctype_r* restrict a11r, \
        ctype_r* restrict b11r, \
@@ -355,7 +397,7 @@ INSERT_GENTPROTCO_BASIC( TRSM3M_L_UKERNEL )
 #undef  GENTPROTCO
 #define GENTPROTCO( ctype, ctype_r, ch, chr, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        ctype_r* restrict a11r, \
        ctype_r* restrict b11r, \
@@ -370,9 +412,73 @@ INSERT_GENTPROTCO_BASIC( TRSM3M_U_UKERNEL )
 // Level-1m
 //
 
-// NOTE: We don't need any PASTEMAC-friendly aliases to packm kernel
-// macros because they are used directly in the initialization of the
-// function pointer array, rather than via a templatizing wrapper macro.
+// packm kernels
+
+// NOTE: The packm kernel macros are used directly in the initialization
+// of the function pointer array in bli_packm_cxk.c, rather than via a
+// templatizing wrapper macro. We define PASTEMAC-friendly aliases here
+// only so that we can declare prototypes for optimized packm kernels.
+
+#define bli_sPACKM_2XK_KERNEL BLIS_SPACKM_2XK_KERNEL
+#define bli_dPACKM_2XK_KERNEL BLIS_DPACKM_2XK_KERNEL
+#define bli_cPACKM_2XK_KERNEL BLIS_CPACKM_2XK_KERNEL
+#define bli_zPACKM_2XK_KERNEL BLIS_ZPACKM_2XK_KERNEL
+
+#define bli_sPACKM_4XK_KERNEL BLIS_SPACKM_4XK_KERNEL
+#define bli_dPACKM_4XK_KERNEL BLIS_DPACKM_4XK_KERNEL
+#define bli_cPACKM_4XK_KERNEL BLIS_CPACKM_4XK_KERNEL
+#define bli_zPACKM_4XK_KERNEL BLIS_ZPACKM_4XK_KERNEL
+
+#define bli_sPACKM_6XK_KERNEL BLIS_SPACKM_6XK_KERNEL
+#define bli_dPACKM_6XK_KERNEL BLIS_DPACKM_6XK_KERNEL
+#define bli_cPACKM_6XK_KERNEL BLIS_CPACKM_6XK_KERNEL
+#define bli_zPACKM_6XK_KERNEL BLIS_ZPACKM_6XK_KERNEL
+
+#define bli_sPACKM_8XK_KERNEL BLIS_SPACKM_8XK_KERNEL
+#define bli_dPACKM_8XK_KERNEL BLIS_DPACKM_8XK_KERNEL
+#define bli_cPACKM_8XK_KERNEL BLIS_CPACKM_8XK_KERNEL
+#define bli_zPACKM_8XK_KERNEL BLIS_ZPACKM_8XK_KERNEL
+
+#define bli_sPACKM_10XK_KERNEL BLIS_SPACKM_10XK_KERNEL
+#define bli_dPACKM_10XK_KERNEL BLIS_DPACKM_10XK_KERNEL
+#define bli_cPACKM_10XK_KERNEL BLIS_CPACKM_10XK_KERNEL
+#define bli_zPACKM_10XK_KERNEL BLIS_ZPACKM_10XK_KERNEL
+
+#define bli_sPACKM_12XK_KERNEL BLIS_SPACKM_12XK_KERNEL
+#define bli_dPACKM_12XK_KERNEL BLIS_DPACKM_12XK_KERNEL
+#define bli_cPACKM_12XK_KERNEL BLIS_CPACKM_12XK_KERNEL
+#define bli_zPACKM_12XK_KERNEL BLIS_ZPACKM_12XK_KERNEL
+
+#define bli_sPACKM_14XK_KERNEL BLIS_SPACKM_14XK_KERNEL
+#define bli_dPACKM_14XK_KERNEL BLIS_DPACKM_14XK_KERNEL
+#define bli_cPACKM_14XK_KERNEL BLIS_CPACKM_14XK_KERNEL
+#define bli_zPACKM_14XK_KERNEL BLIS_ZPACKM_14XK_KERNEL
+
+#define bli_sPACKM_16XK_KERNEL BLIS_SPACKM_16XK_KERNEL
+#define bli_dPACKM_16XK_KERNEL BLIS_DPACKM_16XK_KERNEL
+#define bli_cPACKM_16XK_KERNEL BLIS_CPACKM_16XK_KERNEL
+#define bli_zPACKM_16XK_KERNEL BLIS_ZPACKM_16XK_KERNEL
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, kername ) \
+\
+extern void PASTEMAC(ch,kername) \
+     ( \
+       conj_t  conja, \
+       dim_t   n, \
+       void*   beta, \
+       void*   a, inc_t inca, inc_t lda, \
+       void*   p,             inc_t ldp  \
+     );
+
+INSERT_GENTPROT_BASIC( PACKM_2XK_KERNEL )
+INSERT_GENTPROT_BASIC( PACKM_4XK_KERNEL )
+INSERT_GENTPROT_BASIC( PACKM_6XK_KERNEL )
+INSERT_GENTPROT_BASIC( PACKM_8XK_KERNEL )
+INSERT_GENTPROT_BASIC( PACKM_10XK_KERNEL )
+INSERT_GENTPROT_BASIC( PACKM_12XK_KERNEL )
+INSERT_GENTPROT_BASIC( PACKM_14XK_KERNEL )
+INSERT_GENTPROT_BASIC( PACKM_16XK_KERNEL )
 
 
 //
@@ -389,7 +495,7 @@ INSERT_GENTPROTCO_BASIC( TRSM3M_U_UKERNEL )
 #undef  GENTPROT3U12
 #define GENTPROT3U12( ctype_x, ctype_y, ctype_z, ctype_xy, chx, chy, chz, chxy, kername ) \
 \
-void PASTEMAC3(chx,chy,chz,kername) \
+extern void PASTEMAC3(chx,chy,chz,kername) \
      ( \
        conj_t             conjx, \
        conj_t             conjy, \
@@ -413,7 +519,7 @@ INSERT_GENTPROT3U12_BASIC( AXPY2V_KERNEL )
 #undef  GENTPROT3U12
 #define GENTPROT3U12( ctype_x, ctype_y, ctype_z, ctype_xy, chx, chy, chz, chxy, kername ) \
 \
-void PASTEMAC3(chx,chy,chz,kername) \
+extern void PASTEMAC3(chx,chy,chz,kername) \
      ( \
        conj_t             conjxt, \
        conj_t             conjx, \
@@ -438,7 +544,7 @@ INSERT_GENTPROT3U12_BASIC( DOTAXPYV_KERNEL )
 #undef  GENTPROT3U12
 #define GENTPROT3U12( ctype_a, ctype_x, ctype_y, ctype_ax, cha, chx, chy, chax, kername ) \
 \
-void PASTEMAC3(cha,chx,chy,kername) \
+extern void PASTEMAC3(cha,chx,chy,kername) \
      ( \
        conj_t             conja, \
        conj_t             conjx, \
@@ -462,7 +568,7 @@ INSERT_GENTPROT3U12_BASIC( AXPYF_KERNEL )
 #undef  GENTPROT3U12
 #define GENTPROT3U12( ctype_a, ctype_x, ctype_y, ctype_ax, cha, chx, chy, chax, kername ) \
 \
-void PASTEMAC3(cha,chx,chy,kername) \
+extern void PASTEMAC3(cha,chx,chy,kername) \
      ( \
        conj_t             conjat, \
        conj_t             conjx, \
@@ -487,7 +593,7 @@ INSERT_GENTPROT3U12_BASIC( DOTXF_KERNEL )
 #undef  GENTPROT3U12
 #define GENTPROT3U12( ctype_a, ctype_b, ctype_c, ctype_ab, cha, chb, chc, chab, kername ) \
 \
-void PASTEMAC3(cha,chb,chc,kername) \
+extern void PASTEMAC3(cha,chb,chc,kername) \
      ( \
        conj_t             conjat, \
        conj_t             conja, \
@@ -521,7 +627,7 @@ INSERT_GENTPROT3U12_BASIC( DOTXAXPYF_KERNEL )
 #undef  GENTPROT2
 #define GENTPROT2( ctype_x, ctype_y, chx, chy, kername ) \
 \
-void PASTEMAC2(chx,chy,kername) \
+extern void PASTEMAC2(chx,chy,kername) \
      ( \
        conj_t            conjx, \
        dim_t             n, \
@@ -541,7 +647,7 @@ INSERT_GENTPROT2_BASIC( ADDV_KERNEL )
 #undef  GENTPROT3
 #define GENTPROT3( ctype_a, ctype_x, ctype_y, cha, chx, chy, kername ) \
 \
-void PASTEMAC3(cha,chx,chy,kername) \
+extern void PASTEMAC3(cha,chx,chy,kername) \
      ( \
        conj_t            conjx, \
        dim_t             n, \
@@ -562,7 +668,7 @@ INSERT_GENTPROT3_BASIC( AXPYV_KERNEL )
 #undef  GENTPROT2
 #define GENTPROT2( ctype_x, ctype_y, chx, chy, kername ) \
 \
-void PASTEMAC2(chx,chy,kername) \
+extern void PASTEMAC2(chx,chy,kername) \
      ( \
        conj_t            conjx, \
        dim_t             n, \
@@ -582,7 +688,7 @@ INSERT_GENTPROT2_BASIC( COPYV_KERNEL )
 #undef  GENTPROT3
 #define GENTPROT3( ctype_x, ctype_y, ctype_r, chx, chy, chr, kername ) \
 \
-void PASTEMAC3(chx,chy,chr,kername) \
+extern void PASTEMAC3(chx,chy,chr,kername) \
      ( \
        conj_t            conjx, \
        conj_t            conjy, \
@@ -604,7 +710,7 @@ INSERT_GENTPROT3_BASIC( DOTV_KERNEL )
 #undef  GENTPROT3U12
 #define GENTPROT3U12( ctype_x, ctype_y, ctype_r, ctype_xy, chx, chy, chr, chxy, kername ) \
 \
-void PASTEMAC3(chx,chy,chr,kername) \
+extern void PASTEMAC3(chx,chy,chr,kername) \
      ( \
        conj_t             conjx, \
        conj_t             conjy, \
@@ -628,7 +734,7 @@ INSERT_GENTPROT3U12_BASIC( DOTXV_KERNEL )
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, kername ) \
 \
-void PASTEMAC(ch,kername) \
+extern void PASTEMAC(ch,kername) \
      ( \
        dim_t           n, \
        ctype* restrict x, inc_t incx  \
@@ -646,7 +752,7 @@ INSERT_GENTPROT_BASIC( INVERTV_KERNEL )
 #undef  GENTPROT3
 #define GENTPROT3( ctype_b, ctype_x, ctype_y, chb, chx, chy, kername ) \
 \
-void PASTEMAC3(chb,chx,chy,kername) \
+extern void PASTEMAC3(chb,chx,chy,kername) \
      ( \
        conj_t            conjx, \
        dim_t             n, \
@@ -667,7 +773,7 @@ INSERT_GENTPROT3_BASIC( SCAL2V_KERNEL )
 #undef  GENTPROT2
 #define GENTPROT2( ctype_b, ctype_x, chb, chx, kername ) \
 \
-void PASTEMAC2(chb,chx,kername) \
+extern void PASTEMAC2(chb,chx,kername) \
      ( \
        conj_t            conjbeta, \
        dim_t             n, \
@@ -687,7 +793,7 @@ INSERT_GENTPROT2_BASIC( SCALV_KERNEL )
 #undef  GENTPROT2
 #define GENTPROT2( ctype_b, ctype_x, chb, chx, kername ) \
 \
-void PASTEMAC2(chb,chx,kername) \
+extern void PASTEMAC2(chb,chx,kername) \
      ( \
        dim_t             n, \
        ctype_b* restrict beta, \
@@ -706,7 +812,7 @@ INSERT_GENTPROT2_BASIC( SETV_KERNEL )
 #undef  GENTPROT2
 #define GENTPROT2( ctype_x, ctype_y, chx, chy, kername ) \
 \
-void PASTEMAC2(chx,chy,kername) \
+extern void PASTEMAC2(chx,chy,kername) \
      ( \
        conj_t            conjx, \
        dim_t             n, \
@@ -726,7 +832,7 @@ INSERT_GENTPROT2_BASIC( SUBV_KERNEL )
 #undef  GENTPROT2
 #define GENTPROT2( ctype_x, ctype_y, chx, chy, kername ) \
 \
-void PASTEMAC2(chx,chy,kername) \
+extern void PASTEMAC2(chx,chy,kername) \
      ( \
        dim_t             n, \
        ctype_x* restrict x, inc_t incx, \
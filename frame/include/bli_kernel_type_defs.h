@@ -65,6 +65,27 @@ typedef void \
 INSERT_GENTPROT_BASIC( gemm_ukr_t )
 
 
+// -- gemm edge micro-kernel --
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, tname ) \
+\
+typedef void \
+(*PASTECH(ch,tname))( \
+                      dim_t           m, \
+                      dim_t           n, \
+                      dim_t           k, \
+                      ctype* restrict alpha, \
+                      ctype* restrict a, \
+                      ctype* restrict b, \
+                      ctype* restrict beta, \
+                      ctype* restrict c, inc_t rs_c, inc_t cs_c, \
+                      auxinfo_t*      data  \
+                    );
+
+INSERT_GENTPROT_BASIC( gemm_edge_ukr_t )
+
+
 // -- trsm_l/u micro-kernels --
 
 #undef  GENTPROT
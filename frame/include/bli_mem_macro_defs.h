@@ -50,6 +50,10 @@
 \
     ( (mem_p)->pool )
 
+#define bli_mem_block_index( mem_p ) \
+\
+    ( (mem_p)->block_index )
+
 #define bli_mem_size( mem_p ) \
 \
 	( (mem_p)->size )
@@ -80,6 +84,11 @@
     mem_p->pool = pool0; \
 }
 
+#define bli_mem_set_block_index( index0, mem_p ) \
+{ \
+    mem_p->block_index = index0; \
+}
+
 #define bli_mem_set_size( size0, mem_p ) \
 { \
     mem_p->size = size0; \
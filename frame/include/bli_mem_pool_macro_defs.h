@@ -465,43 +465,23 @@
 #endif
 
 
-// -- Compute pool sizes -------------------------------------------------------
+// -- Pool capacity ------------------------------------------------------------
 
+// The maximum number of blocks that each pool can track. Pools start out
+// empty and grow on demand up to this number of blocks. A configuration
+// may override this value in its bli_config.h.
+#ifndef BLIS_POOL_MAX_NUM_BLOCKS
+#define BLIS_POOL_MAX_NUM_BLOCKS 1024
+#endif
 
-// Define each pool's total size using the block sizes determined above.
 
-//
-// Pool for MC x KC blocks of A.
-//
-#define BLIS_MK_POOL_SIZE  ( \
-                             BLIS_NUM_MC_X_KC_BLOCKS * \
-                             ( BLIS_MK_BLOCK_SIZE + \
-                               BLIS_CONTIG_ADDR_ALIGN_SIZE \
-                             ) + \
-                             BLIS_MAX_PRELOAD_BYTE_OFFSET \
-                           )
+// -- Huge pages ---------------------------------------------------------------
 
-//
-// Pool for KC x NC panels of B.
-//
-#define BLIS_KN_POOL_SIZE  ( \
-                             BLIS_NUM_KC_X_NC_BLOCKS * \
-                             ( BLIS_KN_BLOCK_SIZE + \
-                               BLIS_CONTIG_ADDR_ALIGN_SIZE \
-                             ) + \
-                             BLIS_MAX_PRELOAD_BYTE_OFFSET \
-                           )
-
-//
-// Pool for MC x NC panels of C.
-//
-#define BLIS_MN_POOL_SIZE  ( \
-                             BLIS_NUM_MC_X_NC_BLOCKS * \
-                             ( BLIS_MN_BLOCK_SIZE + \
-                               BLIS_CONTIG_ADDR_ALIGN_SIZE \
-                             ) + \
-                             BLIS_MAX_PRELOAD_BYTE_OFFSET \
-                           )
+// The size of the huge pages used to back the pools when huge pages are
+// enabled. A configuration may override this value in its bli_config.h.
+#ifndef BLIS_HUGE_PAGE_SIZE
+#define BLIS_HUGE_PAGE_SIZE ( 2 * 1024 * 1024 )
+#endif
 
 
 #endif 
@@ -818,6 +818,22 @@ bli_obj_width_stored( obj )
 	bli_obj_init_basic_shallow_copy_of( a, b ); \
 }
 
+// Make an alias (shallow copy) of an object to stand in for its packed
+// counterpart when packing is skipped. This copies every field except the
+// pack_mem entry, so that the alias never takes ownership of (and later
+// releases or packs into) a buffer cached in the source object, which
+// may belong to the caller or to a packed object at a higher level.
+
+#define bli_obj_alias_for_pack_skip( a, b ) \
+{ \
+	bli_obj_init_basic_shallow_copy_of( a, b ); \
+\
+	(b).m_padded  = (a).m_padded; \
+	(b).n_padded  = (a).n_padded; \
+	(b).ps        = (a).ps; \
+	(b).pd        = (a).pd; \
+}
+
 // Make a full alias (shallow copy), including pack_mem and friends
 
 #define bli_obj_alias_to( a, b ) \
@@ -495,6 +495,12 @@
 \
 	( i1 == iter - 1 )
 
+// Determine whether i1 is the last iteration executed by thread t_id when
+// the iterations are assigned to n_t threads in a round-robin fashion.
+#define bli_is_last_iter_rr( i1, iter, t_id, n_t ) \
+\
+	( i1 == iter - 1 - ( ( iter - t_id - 1 ) % n_t ) )
+
 
 // packbuf_t-related
 
@@ -42,23 +42,62 @@
 \
 	( (pool_p)->block_ptrs )
 
+#define bli_pool_block_sizes( pool_p ) \
+\
+	( (pool_p)->block_sizes )
+
+#define bli_pool_map_sizes( pool_p ) \
+\
+	( (pool_p)->map_sizes )
+
+#define bli_pool_next_index( pool_p ) \
+\
+	( (pool_p)->next_index )
+
 #define bli_pool_num_blocks( pool_p ) \
 \
 	( (pool_p)->num_blocks )
 
+#define bli_pool_init_num_blocks( pool_p ) \
+\
+	( (pool_p)->init_num_blocks )
+
+#define bli_pool_max_num_blocks( pool_p ) \
+\
+	( (pool_p)->max_num_blocks )
+
 #define bli_pool_block_size( pool_p ) \
 \
 	( (pool_p)->block_size )
 
+#define bli_pool_top( pool_p ) \
+\
+	( (pool_p)->top )
+
 #define bli_pool_top_index( pool_p ) \
 \
-	( (pool_p)->top_index )
+	bli_pool_top_index_of( bli_pool_top( pool_p ) )
 
 #define bli_pool_is_exhausted( pool_p ) \
 \
 	( bli_pool_top_index( pool_p ) == -1 )
 
 
+// Tagged top-of-stack manipulation
+
+#define bli_pool_top_index_of( top ) \
+\
+	( ( gint_t )( ( top ) & 0xFFFFFFFFULL ) - 1 )
+
+#define bli_pool_top_tag_of( top ) \
+\
+	( ( top ) >> 32 )
+
+#define bli_pool_top_make( index, tag ) \
+\
+	( ( ( uint64_t )( tag ) << 32 ) | ( uint64_t )( ( index ) + 1 ) )
+
+
 // Pool entry modification
 
 #define bli_pool_set_block_ptrs( block_ptrs0, pool_p ) \
@@ -66,37 +105,57 @@
     (pool_p)->block_ptrs = block_ptrs0; \
 }
 
+#define bli_pool_set_block_sizes( block_sizes0, pool_p ) \
+{ \
+    (pool_p)->block_sizes = block_sizes0; \
+}
+
+#define bli_pool_set_map_sizes( map_sizes0, pool_p ) \
+{ \
+    (pool_p)->map_sizes = map_sizes0; \
+}
+
+#define bli_pool_set_next_index( next_index0, pool_p ) \
+{ \
+    (pool_p)->next_index = next_index0; \
+}
+
 #define bli_pool_set_num_blocks( num_blocks0, pool_p ) \
 { \
     (pool_p)->num_blocks = num_blocks0; \
 }
 
-#define bli_pool_set_block_size( block_size0, pool_p ) \
+#define bli_pool_set_init_num_blocks( init_num_blocks0, pool_p ) \
 { \
-    (pool_p)->block_size = block_size0; \
+    (pool_p)->init_num_blocks = init_num_blocks0; \
 }
 
-#define bli_pool_set_top_index( top_index0, pool_p ) \
+#define bli_pool_set_max_num_blocks( max_num_blocks0, pool_p ) \
 { \
-    (pool_p)->top_index = top_index0; \
+    (pool_p)->max_num_blocks = max_num_blocks0; \
 }
 
-#define bli_pool_dec_top_index( pool_p ) \
+#define bli_pool_set_block_size( block_size0, pool_p ) \
 { \
-    ((pool_p)->top_index)--; \
+    (pool_p)->block_size = block_size0; \
 }
 
-#define bli_pool_inc_top_index( pool_p ) \
+#define bli_pool_set_top( top0, pool_p ) \
 { \
-    ((pool_p)->top_index)++; \
+    (pool_p)->top = top0; \
 }
 
-#define bli_pool_init( num_blocks, block_size, block_ptrs, pool_p ) \
+#define bli_pool_init( init_num_blocks, max_num_blocks, block_size, block_ptrs, block_sizes, map_sizes, next_index, pool_p ) \
 { \
-	bli_pool_set_num_blocks( num_blocks, pool_p ); \
+	bli_pool_set_num_blocks( 0, pool_p ); \
+	bli_pool_set_init_num_blocks( init_num_blocks, pool_p ); \
+	bli_pool_set_max_num_blocks( max_num_blocks, pool_p ); \
 	bli_pool_set_block_size( block_size, pool_p ); \
 	bli_pool_set_block_ptrs( block_ptrs, pool_p ); \
-	bli_pool_set_top_index( num_blocks - 1, pool_p ); \
+	bli_pool_set_block_sizes( block_sizes, pool_p ); \
+	bli_pool_set_map_sizes( map_sizes, pool_p ); \
+	bli_pool_set_next_index( next_index, pool_p ); \
+	bli_pool_set_top( bli_pool_top_make( -1, 0 ), pool_p ); \
 }
 
 
@@ -393,12 +393,29 @@ typedef enum
 
 // -- Memory pool type --
 
+// The free blocks of a pool are kept on a lock-free stack. The stack is
+// linked through next_index, and top holds the index of the top block
+// (plus one, so that zero denotes an empty stack) in its low 32 bits and
+// a tag in its high 32 bits. The tag is incremented with every update so
+// that a stale compare-and-swap cannot succeed (the "ABA" problem).
+// Blocks are allocated when they are first needed. num_blocks counts the
+// blocks allocated so far (at most max_num_blocks), init_num_blocks is the
+// number of blocks allocated upon first use, and block_size is the size of
+// newly allocated blocks, which is raised if a larger block is requested.
+// map_sizes records the length of the mapping behind each block that was
+// mapped directly from the operating system (eg: with huge pages), or zero
+// if the block came from the heap.
 typedef struct
 {
-    void** block_ptrs;
-    gint_t top_index;
-    siz_t  num_blocks;
-    siz_t  block_size;
+    void**            block_ptrs;
+    siz_t*            block_sizes;
+    siz_t*            map_sizes;
+    gint_t*           next_index;
+    volatile uint64_t top;
+    volatile dim_t    num_blocks;
+    dim_t             init_num_blocks;
+    dim_t             max_num_blocks;
+    volatile siz_t    block_size;
 } pool_t;
 
 // -- Memory object type --
@@ -408,6 +425,7 @@ typedef struct mem_s
 	void*     buf;
 	packbuf_t buf_type;
 	pool_t*   pool;
+	gint_t    block_index;
 	siz_t     size;
 } mem_t;
 
@@ -420,6 +438,10 @@ typedef struct blksz_s
 
 	// Blocksize Extensions.
 	dim_t e[BLIS_NUM_FP_TYPES];
+
+	// The blocksize object whose values are multiples of which the values
+	// in this object should be partitioned (eg: MR for MC). May be NULL.
+	struct blksz_s* mult;
 } blksz_t;
 
 // -- Function pointer object type --
@@ -644,6 +666,21 @@ typedef enum
 #define BLIS_MACH_PARAM_LAST   BLIS_MACH_EPS2
 
 
+// -- Architecture (sub-configuration) ID type --
+
+// NOTE: The x86_64 IDs are ordered so that each sub-configuration requires
+// a superset of the instruction set extensions required by those before it.
+
+typedef enum
+{
+	BLIS_ARCH_GENERIC = 0,
+	BLIS_ARCH_SANDYBRIDGE,
+	BLIS_ARCH_HASWELL
+} arch_t;
+
+#define BLIS_NUM_ARCHS         3
+
+
 // -- Error types --
 
 typedef enum
@@ -722,6 +759,9 @@ typedef enum
 
 	// Packing-specific errors
 	BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_UNPACK  = (-100),
+	BLIS_PACK_SCHEMA_NOT_SUPPORTED_FOR_OPERAND = (-101),
+	BLIS_INVALID_PACK_FILE                     = (-102),
+	BLIS_PACK_FILE_IO_FAILURE                  = (-103),
 
 	// Memory allocator errors
 	BLIS_INVALID_PACKBUF                       = (-110),
@@ -731,7 +771,10 @@ typedef enum
 	// Object-related errors
 	BLIS_EXPECTED_OBJECT_ALIAS                 = (-120),
 
-	BLIS_ERROR_CODE_MAX                        = (-130)
+	// Threading-related errors
+	BLIS_INVALID_NUM_THREADS                   = (-130),
+
+	BLIS_ERROR_CODE_MAX                        = (-140)
 } err_t;
 
 #endif
@@ -104,6 +104,9 @@ extern "C" {
 #include "bli_machval.h"
 #include "bli_version.h"
 #include "bli_getopt.h"
+#include "bli_threading.h"
+#include "bli_cpuid.h"
+#include "bli_arch.h"
 
 // Control tree definitions.
 #include "bli_cntl.h"
@@ -0,0 +1,104 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+#include "bli_kernels_vec.h"
+
+// Real-domain packm kernels written with vector extensions. When each
+// column of the mr x k panel is contiguous (inca == 1, eg: packing A when
+// A is column-stored), the column is copied and scaled by kappa a vector
+// at a time, with any elements beyond the last whole vector handled one
+// at a time. Any other storage is handed to the reference kernel. (Since
+// the domain is real, conja has no effect.)
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname, vtype, vtypeu, mr, refkern ) \
+\
+void PASTEMAC(ch,varname)( \
+                           conj_t  conja, \
+                           dim_t   n, \
+                           void*   beta, \
+                           void*   a, inc_t inca, inc_t lda, \
+                           void*   p,             inc_t ldp  \
+                         ) \
+{ \
+	const dim_t     v         = PASTEMAC(ch,vec_len); \
+	const dim_t     mr_vec    = ( mr / PASTEMAC(ch,vec_len) ) * \
+	                            PASTEMAC(ch,vec_len); \
+\
+	ctype* restrict beta_cast = beta; \
+	ctype* restrict alpha1    = a; \
+	ctype* restrict pi1       = p; \
+	ctype           kappa     = *beta_cast; \
+	dim_t           i; \
+\
+	if ( inca != 1 ) \
+	{ \
+		refkern( conja, n, beta, a, inca, lda, p, ldp ); \
+		return; \
+	} \
+\
+	for ( ; n != 0; --n ) \
+	{ \
+		for ( i = 0; i < mr_vec; i += v ) \
+			*( vtypeu* )( pi1 + i ) = *( vtypeu* )( alpha1 + i ) * kappa; \
+\
+		for ( ; i < mr; ++i ) \
+			PASTEMAC3(ch,ch,ch,scal2s)( kappa, *(alpha1 + i), *(pi1 + i) ); \
+\
+		alpha1 += lda; \
+		pi1    += ldp; \
+	} \
+}
+
+GENTFUNC( float,  s, packm_opt_2xk_vec,  bli_svec_t, bli_svecu_t,  2, BLIS_SPACKM_2XK_KERNEL_REF )
+GENTFUNC( double, d, packm_opt_2xk_vec,  bli_dvec_t, bli_dvecu_t,  2, BLIS_DPACKM_2XK_KERNEL_REF )
+
+GENTFUNC( float,  s, packm_opt_4xk_vec,  bli_svec_t, bli_svecu_t,  4, BLIS_SPACKM_4XK_KERNEL_REF )
+GENTFUNC( double, d, packm_opt_4xk_vec,  bli_dvec_t, bli_dvecu_t,  4, BLIS_DPACKM_4XK_KERNEL_REF )
+
+GENTFUNC( float,  s, packm_opt_6xk_vec,  bli_svec_t, bli_svecu_t,  6, BLIS_SPACKM_6XK_KERNEL_REF )
+GENTFUNC( double, d, packm_opt_6xk_vec,  bli_dvec_t, bli_dvecu_t,  6, BLIS_DPACKM_6XK_KERNEL_REF )
+
+GENTFUNC( float,  s, packm_opt_8xk_vec,  bli_svec_t, bli_svecu_t,  8, BLIS_SPACKM_8XK_KERNEL_REF )
+GENTFUNC( double, d, packm_opt_8xk_vec,  bli_dvec_t, bli_dvecu_t,  8, BLIS_DPACKM_8XK_KERNEL_REF )
+
+GENTFUNC( float,  s, packm_opt_12xk_vec, bli_svec_t, bli_svecu_t, 12, BLIS_SPACKM_12XK_KERNEL_REF )
+GENTFUNC( double, d, packm_opt_12xk_vec, bli_dvec_t, bli_dvecu_t, 12, BLIS_DPACKM_12XK_KERNEL_REF )
+
+GENTFUNC( float,  s, packm_opt_16xk_vec, bli_svec_t, bli_svecu_t, 16, BLIS_SPACKM_16XK_KERNEL_REF )
+GENTFUNC( double, d, packm_opt_16xk_vec, bli_dvec_t, bli_dvecu_t, 16, BLIS_DPACKM_16XK_KERNEL_REF )
+
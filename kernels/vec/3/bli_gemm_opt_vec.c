@@ -0,0 +1,140 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+#include "bli_kernels_vec.h"
+
+// Real-domain gemm micro-kernels written with vector extensions. The
+// MR x NR block of AB is accumulated in (MR/v) x NR vectors, where v is the
+// vector length, by broadcasting each element of the current row of B
+// against the MR elements of the current column of A. MR and NR are taken
+// from the configuration; MR must be a multiple of the vector length.
+
+#if BLIS_DEFAULT_MR_S % BLIS_VEC_LEN_S != 0
+  #error "MR for single precision must be a multiple of BLIS_VEC_LEN_S."
+#endif
+#if BLIS_DEFAULT_MR_D % BLIS_VEC_LEN_D != 0
+  #error "MR for double precision must be a multiple of BLIS_VEC_LEN_D."
+#endif
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname, vtype, vtypeu ) \
+\
+void PASTEMAC(ch,varname)( \
+                           dim_t           k, \
+                           ctype* restrict alpha, \
+                           ctype* restrict a, \
+                           ctype* restrict b, \
+                           ctype* restrict beta, \
+                           ctype* restrict c, inc_t rs_c, inc_t cs_c, \
+                           auxinfo_t*      data  \
+                         ) \
+{ \
+	const dim_t     m     = PASTEMAC(ch,mr); \
+	const dim_t     n     = PASTEMAC(ch,nr); \
+	const dim_t     m_v   = PASTEMAC(ch,mr) / PASTEMAC(ch,vec_len); \
+\
+	const inc_t     cs_a  = PASTEMAC(ch,packmr); \
+\
+	const inc_t     rs_b  = PASTEMAC(ch,packnr); \
+\
+	const inc_t     rs_ab = 1; \
+	const inc_t     cs_ab = PASTEMAC(ch,mr); \
+\
+	dim_t           l, j, i; \
+\
+	vtype           abv[ PASTEMAC(ch,nr) ] \
+	                   [ PASTEMAC(ch,mr) / PASTEMAC(ch,vec_len) ]; \
+	vtype           av[ PASTEMAC(ch,mr) / PASTEMAC(ch,vec_len) ]; \
+	ctype           ab[ PASTEMAC(ch,mr) * \
+	                    PASTEMAC(ch,nr) ] \
+	                    __attribute__(( aligned( BLIS_VEC_SIZE ) )); \
+	ctype           bj; \
+\
+\
+	/* Initialize the accumulator vectors to zero. (The loops over MR
+	   and NR have constant trip counts, so the compiler fully unrolls
+	   them and keeps the accumulators in registers.) */ \
+	for ( j = 0; j < n; ++j ) \
+		for ( i = 0; i < m_v; ++i ) \
+			abv[ j ][ i ] = ( vtype ){ 0 }; \
+\
+	/* Perform a series of k rank-1 updates into abv. */ \
+	for ( l = 0; l < k; ++l ) \
+	{ \
+		for ( i = 0; i < m_v; ++i ) \
+			av[ i ] = *( vtypeu* )( a + i*PASTEMAC(ch,vec_len) ); \
+\
+		for ( j = 0; j < n; ++j ) \
+		{ \
+			bj = *(b + j); \
+\
+			for ( i = 0; i < m_v; ++i ) \
+				abv[ j ][ i ] += av[ i ] * bj; \
+		} \
+\
+		a += cs_a; \
+		b += rs_b; \
+	} \
+\
+	/* Scale the accumulators by alpha and store them to ab. */ \
+	for ( j = 0; j < n; ++j ) \
+		for ( i = 0; i < m_v; ++i ) \
+			*( vtype* )( ab + j*cs_ab + i*PASTEMAC(ch,vec_len) ) = \
+			    abv[ j ][ i ] * *alpha; \
+\
+	/* If beta is zero, overwrite c with the scaled result in ab. Otherwise,
+	   scale by beta and then add the scaled result in ab. */ \
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		PASTEMAC(ch,copys_mxn)( m, \
+		                        n, \
+		                        ab, rs_ab, cs_ab, \
+		                        c,  rs_c,  cs_c ); \
+	} \
+	else \
+	{ \
+		PASTEMAC(ch,xpbys_mxn)( m, \
+		                        n, \
+		                        ab, rs_ab, cs_ab, \
+		                        beta, \
+		                        c,  rs_c,  cs_c ); \
+	} \
+}
+
+GENTFUNC( float,  s, gemm_opt_vec, bli_svec_t, bli_svecu_t )
+GENTFUNC( double, d, gemm_opt_vec, bli_dvec_t, bli_dvecu_t )
+
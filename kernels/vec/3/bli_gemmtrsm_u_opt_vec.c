@@ -0,0 +1,99 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Real-domain gemmtrsm micro-kernels built from the vector-extension gemm
+// and trsm micro-kernels. These are bound directly (rather than through
+// the GEMM_UKERNEL and TRSM_U_UKERNEL macros, as in the reference
+// gemmtrsm micro-kernel) so that the pair is always used together.
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname, gemmukr, trsmukr ) \
+\
+void PASTEMAC(ch,gemmukr)( \
+                           dim_t           k, \
+                           ctype* restrict alpha, \
+                           ctype* restrict a, \
+                           ctype* restrict b, \
+                           ctype* restrict beta, \
+                           ctype* restrict c, inc_t rs_c, inc_t cs_c, \
+                           auxinfo_t*      data  \
+                         ); \
+\
+void PASTEMAC(ch,trsmukr)( \
+                           ctype* restrict a, \
+                           ctype* restrict b, \
+                           ctype* restrict c, inc_t rs_c, inc_t cs_c, \
+                           auxinfo_t*      data  \
+                         ); \
+\
+void PASTEMAC(ch,varname)( \
+                           dim_t           k, \
+                           ctype* restrict alpha, \
+                           ctype* restrict a12, \
+                           ctype* restrict a11, \
+                           ctype* restrict b21, \
+                           ctype* restrict b11, \
+                           ctype* restrict c11, inc_t rs_c, inc_t cs_c, \
+                           auxinfo_t*      data  \
+                         ) \
+{ \
+	const inc_t     rs_b      = PASTEMAC(ch,packnr); \
+	const inc_t     cs_b      = 1; \
+\
+	ctype* restrict minus_one = PASTEMAC(ch,m1); \
+\
+	/* b11 = alpha * b11 - a12 * b21; */ \
+	PASTEMAC(ch,gemmukr)( k, \
+	                      minus_one, \
+	                      a12, \
+	                      b21, \
+	                      alpha, \
+	                      b11, rs_b, cs_b, \
+	                      data ); \
+\
+	/* b11 = inv(a11) * b11;
+	   c11 = b11; */ \
+	PASTEMAC(ch,trsmukr)( a11, \
+	                      b11, \
+	                      c11, rs_c, cs_c, \
+	                      data ); \
+}
+
+GENTFUNC( float,  s, gemmtrsm_u_opt_vec, gemm_opt_vec, trsm_u_opt_vec )
+GENTFUNC( double, d, gemmtrsm_u_opt_vec, gemm_opt_vec, trsm_u_opt_vec )
+
@@ -0,0 +1,76 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_KERNELS_VEC_H
+#define BLIS_KERNELS_VEC_H
+
+// The kernels in kernels/vec are written with the vector extensions of
+// GCC and Clang (the vector_size attribute) rather than with intrinsics or
+// assembly, so they compile to SIMD code on any target those compilers
+// support.
+
+// The size, in bytes, of the vectors used by the kernels. By default this
+// is the SIMD alignment of the configuration. A configuration may define a
+// larger size; the compiler splits vectors wider than the hardware's.
+
+#ifndef BLIS_VEC_SIZE
+#define BLIS_VEC_SIZE        BLIS_SIMD_ALIGN_SIZE
+#endif
+
+// The number of elements in each vector.
+
+#define BLIS_VEC_LEN_S       ( BLIS_VEC_SIZE / 4 )
+#define BLIS_VEC_LEN_D       ( BLIS_VEC_SIZE / 8 )
+
+#define bli_svec_len         BLIS_VEC_LEN_S
+#define bli_dvec_len         BLIS_VEC_LEN_D
+
+// Vector types. The "u" types are for loading and storing vectors at
+// addresses that are only aligned to the element type, such as within
+// packed micro-panels whose leading dimension is not a multiple of the
+// vector length.
+
+typedef float  bli_svec_t  __attribute__(( vector_size( BLIS_VEC_SIZE ) ));
+typedef double bli_dvec_t  __attribute__(( vector_size( BLIS_VEC_SIZE ) ));
+
+typedef float  bli_svecu_t __attribute__(( vector_size( BLIS_VEC_SIZE ),
+                                           aligned( sizeof( float ) ),
+                                           may_alias ));
+typedef double bli_dvecu_t __attribute__(( vector_size( BLIS_VEC_SIZE ),
+                                           aligned( sizeof( double ) ),
+                                           may_alias ));
+
+#endif
+
@@ -0,0 +1,231 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// AVX axpyv kernels. Contiguous vectors are processed four ymm registers
+// per iteration after a short scalar prologue that brings y to a 32-byte
+// boundary; the remaining elements are handled with scalar code. Vectors
+// with non-unit stride are passed to the reference kernel.
+
+#undef  AXPYV_OPT_REAL
+#define AXPYV_OPT_REAL( ctype, ch, vtype, sfx ) \
+\
+void PASTEMAC(ch,axpyv_opt_avx) \
+     ( \
+       conj_t           conjx, \
+       dim_t            n, \
+       ctype*  restrict alpha, \
+       ctype*  restrict x, inc_t incx, \
+       ctype*  restrict y, inc_t incy  \
+     ) \
+{ \
+	const dim_t n_elem_per_reg = sizeof( vtype ) / sizeof( ctype ); \
+	const dim_t n_iter_unroll  = 4; \
+	const dim_t n_elem_per_it  = n_elem_per_reg * n_iter_unroll; \
+	ctype       alpha1c        = *alpha; \
+	vtype       alphav; \
+	vtype       y0v, y1v, y2v, y3v; \
+	dim_t       n_pre, n_run, i; \
+\
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	/* If alpha is zero, return. */ \
+	if ( PASTEMAC(ch,eq0)( alpha1c ) ) return; \
+\
+	if ( incx != 1 || incy != 1 ) \
+	{ \
+		PASTEMAC3(ch,ch,ch,axpyv_ref)( conjx, n, alpha, \
+		                               x, incx, y, incy ); \
+		return; \
+	} \
+\
+	n_pre = ( uintptr_t )y % 32; \
+	if ( n_pre != 0 ) n_pre = ( 32 - n_pre ) / sizeof( ctype ); \
+	n_pre = bli_min( n_pre, n ); \
+\
+	for ( i = 0; i < n_pre; ++i ) \
+		y[ i ] += alpha1c * x[ i ]; \
+\
+	x += n_pre; \
+	y += n_pre; \
+	n -= n_pre; \
+	n_run = n / n_elem_per_it; \
+\
+	alphav = _mm256_set1_ ## sfx( alpha1c ); \
+\
+	for ( i = 0; i < n_run; ++i ) \
+	{ \
+		y0v = _mm256_loadu_ ## sfx( y + 0*n_elem_per_reg ); \
+		y1v = _mm256_loadu_ ## sfx( y + 1*n_elem_per_reg ); \
+		y2v = _mm256_loadu_ ## sfx( y + 2*n_elem_per_reg ); \
+		y3v = _mm256_loadu_ ## sfx( y + 3*n_elem_per_reg ); \
+\
+		y0v = _mm256_add_ ## sfx( y0v, _mm256_mul_ ## sfx( alphav, _mm256_loadu_ ## sfx( x + 0*n_elem_per_reg ) ) ); \
+		y1v = _mm256_add_ ## sfx( y1v, _mm256_mul_ ## sfx( alphav, _mm256_loadu_ ## sfx( x + 1*n_elem_per_reg ) ) ); \
+		y2v = _mm256_add_ ## sfx( y2v, _mm256_mul_ ## sfx( alphav, _mm256_loadu_ ## sfx( x + 2*n_elem_per_reg ) ) ); \
+		y3v = _mm256_add_ ## sfx( y3v, _mm256_mul_ ## sfx( alphav, _mm256_loadu_ ## sfx( x + 3*n_elem_per_reg ) ) ); \
+\
+		_mm256_storeu_ ## sfx( y + 0*n_elem_per_reg, y0v ); \
+		_mm256_storeu_ ## sfx( y + 1*n_elem_per_reg, y1v ); \
+		_mm256_storeu_ ## sfx( y + 2*n_elem_per_reg, y2v ); \
+		_mm256_storeu_ ## sfx( y + 3*n_elem_per_reg, y3v ); \
+\
+		x += n_elem_per_it; \
+		y += n_elem_per_it; \
+	} \
+\
+	for ( i = 0; i < n % n_elem_per_it; ++i ) \
+		y[ i ] += alpha1c * x[ i ]; \
+}
+
+AXPYV_OPT_REAL( float,  s, __m256,  ps )
+AXPYV_OPT_REAL( double, d, __m256d, pd )
+
+
+// For complex types, each ymm register holds interleaved (real, imag)
+// pairs. The product alpha * x is formed as addsub( ar * x, ai * x' ),
+// where x' is x with the real and imaginary parts of each element swapped.
+// Conjugation of x is applied beforehand by flipping the sign bits of the
+// imaginary parts.
+
+#undef  AXPYV_OPT_CMPLX
+#define AXPYV_OPT_CMPLX( ctype, ctype_r, ch, vtype, sfx, swap, imag_sign ) \
+\
+void PASTEMAC(ch,axpyv_opt_avx) \
+     ( \
+       conj_t           conjx, \
+       dim_t            n, \
+       ctype*  restrict alpha, \
+       ctype*  restrict x, inc_t incx, \
+       ctype*  restrict y, inc_t incy  \
+     ) \
+{ \
+	const dim_t n_elem_per_reg = sizeof( vtype ) / sizeof( ctype ); \
+	const dim_t n_iter_unroll  = 4; \
+	const dim_t n_elem_per_it  = n_elem_per_reg * n_iter_unroll; \
+	ctype       alpha1c        = *alpha; \
+	ctype_r*    xr; \
+	ctype_r*    yr; \
+	vtype       arv, aiv, conjv; \
+	vtype       x0v, x1v, x2v, x3v; \
+	dim_t       n_pre, n_run, i; \
+\
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	/* If alpha is zero, return. */ \
+	if ( PASTEMAC(ch,eq0)( alpha1c ) ) return; \
+\
+	if ( incx != 1 || incy != 1 ) \
+	{ \
+		PASTEMAC3(ch,ch,ch,axpyv_ref)( conjx, n, alpha, \
+		                               x, incx, y, incy ); \
+		return; \
+	} \
+\
+	n_pre = ( uintptr_t )y % 32; \
+	if ( n_pre != 0 ) n_pre = ( 32 - n_pre ) / sizeof( ctype ); \
+	n_pre = bli_min( n_pre, n ); \
+\
+	if ( bli_is_conj( conjx ) ) \
+	{ \
+		for ( i = 0; i < n_pre; ++i ) \
+			PASTEMAC3(ch,ch,ch,axpyjs)( alpha1c, x[ i ], y[ i ] ); \
+	} \
+	else \
+	{ \
+		for ( i = 0; i < n_pre; ++i ) \
+			PASTEMAC3(ch,ch,ch,axpys)( alpha1c, x[ i ], y[ i ] ); \
+	} \
+\
+	x += n_pre; \
+	y += n_pre; \
+	n -= n_pre; \
+	n_run = n / n_elem_per_it; \
+\
+	xr = ( ctype_r* )x; \
+	yr = ( ctype_r* )y; \
+\
+	arv   = _mm256_set1_ ## sfx( PASTEMAC(ch,real)( alpha1c ) ); \
+	aiv   = _mm256_set1_ ## sfx( PASTEMAC(ch,imag)( alpha1c ) ); \
+	conjv = _mm256_setzero_ ## sfx(); \
+	if ( bli_is_conj( conjx ) ) \
+		conjv = imag_sign; \
+\
+	for ( i = 0; i < n_run; ++i ) \
+	{ \
+		x0v = _mm256_xor_ ## sfx( conjv, _mm256_loadu_ ## sfx( xr + 0*2*n_elem_per_reg ) ); \
+		x1v = _mm256_xor_ ## sfx( conjv, _mm256_loadu_ ## sfx( xr + 1*2*n_elem_per_reg ) ); \
+		x2v = _mm256_xor_ ## sfx( conjv, _mm256_loadu_ ## sfx( xr + 2*2*n_elem_per_reg ) ); \
+		x3v = _mm256_xor_ ## sfx( conjv, _mm256_loadu_ ## sfx( xr + 3*2*n_elem_per_reg ) ); \
+\
+		x0v = _mm256_addsub_ ## sfx( _mm256_mul_ ## sfx( arv, x0v ), _mm256_mul_ ## sfx( aiv, swap( x0v ) ) ); \
+		x1v = _mm256_addsub_ ## sfx( _mm256_mul_ ## sfx( arv, x1v ), _mm256_mul_ ## sfx( aiv, swap( x1v ) ) ); \
+		x2v = _mm256_addsub_ ## sfx( _mm256_mul_ ## sfx( arv, x2v ), _mm256_mul_ ## sfx( aiv, swap( x2v ) ) ); \
+		x3v = _mm256_addsub_ ## sfx( _mm256_mul_ ## sfx( arv, x3v ), _mm256_mul_ ## sfx( aiv, swap( x3v ) ) ); \
+\
+		_mm256_storeu_ ## sfx( yr + 0*2*n_elem_per_reg, _mm256_add_ ## sfx( x0v, _mm256_loadu_ ## sfx( yr + 0*2*n_elem_per_reg ) ) ); \
+		_mm256_storeu_ ## sfx( yr + 1*2*n_elem_per_reg, _mm256_add_ ## sfx( x1v, _mm256_loadu_ ## sfx( yr + 1*2*n_elem_per_reg ) ) ); \
+		_mm256_storeu_ ## sfx( yr + 2*2*n_elem_per_reg, _mm256_add_ ## sfx( x2v, _mm256_loadu_ ## sfx( yr + 2*2*n_elem_per_reg ) ) ); \
+		_mm256_storeu_ ## sfx( yr + 3*2*n_elem_per_reg, _mm256_add_ ## sfx( x3v, _mm256_loadu_ ## sfx( yr + 3*2*n_elem_per_reg ) ) ); \
+\
+		xr += 2*n_elem_per_it; \
+		yr += 2*n_elem_per_it; \
+	} \
+\
+	x = ( ctype* )xr; \
+	y = ( ctype* )yr; \
+\
+	if ( bli_is_conj( conjx ) ) \
+	{ \
+		for ( i = 0; i < n % n_elem_per_it; ++i ) \
+			PASTEMAC3(ch,ch,ch,axpyjs)( alpha1c, x[ i ], y[ i ] ); \
+	} \
+	else \
+	{ \
+		for ( i = 0; i < n % n_elem_per_it; ++i ) \
+			PASTEMAC3(ch,ch,ch,axpys)( alpha1c, x[ i ], y[ i ] ); \
+	} \
+}
+
+#define AXPYV_SWAP_PS( v ) _mm256_permute_ps( v, 0xB1 )
+#define AXPYV_SWAP_PD( v ) _mm256_permute_pd( v, 0x5 )
+
+AXPYV_OPT_CMPLX( scomplex, float,  c, __m256,  ps, AXPYV_SWAP_PS,
+                 _mm256_set_ps( -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f ) )
+AXPYV_OPT_CMPLX( dcomplex, double, z, __m256d, pd, AXPYV_SWAP_PD,
+                 _mm256_set_pd( -0.0, 0.0, -0.0, 0.0 ) )
+
@@ -0,0 +1,133 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// AVX copyv kernels. Contiguous vectors are copied four ymm registers per
+// iteration after a short scalar prologue that brings y to a 32-byte
+// boundary. Complex vectors are treated as real vectors of twice the
+// length, with conjugation applied by flipping the sign bits of the
+// imaginary parts. Vectors with non-unit stride are passed to the
+// reference kernel.
+
+#undef  COPYV_OPT
+#define COPYV_OPT( ctype, ctype_r, ch, vtype, sfx, imag_sign ) \
+\
+void PASTEMAC(ch,copyv_opt_avx) \
+     ( \
+       conj_t           conjx, \
+       dim_t            n, \
+       ctype*  restrict x, inc_t incx, \
+       ctype*  restrict y, inc_t incy  \
+     ) \
+{ \
+	const dim_t n_elem_per_reg = sizeof( vtype ) / sizeof( ctype ); \
+	const dim_t n_real_per_reg = sizeof( vtype ) / sizeof( ctype_r ); \
+	const dim_t n_iter_unroll  = 4; \
+	const dim_t n_elem_per_it  = n_elem_per_reg * n_iter_unroll; \
+	ctype_r*    xr; \
+	ctype_r*    yr; \
+	vtype       conjv; \
+	dim_t       n_pre, n_run, i; \
+\
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	if ( incx != 1 || incy != 1 ) \
+	{ \
+		PASTEMAC2(ch,ch,copyv_ref)( conjx, n, x, incx, y, incy ); \
+		return; \
+	} \
+\
+	n_pre = ( uintptr_t )y % 32; \
+	if ( n_pre != 0 ) n_pre = ( 32 - n_pre ) / sizeof( ctype ); \
+	n_pre = bli_min( n_pre, n ); \
+\
+	if ( bli_is_conj( conjx ) ) \
+	{ \
+		for ( i = 0; i < n_pre; ++i ) \
+			PASTEMAC2(ch,ch,copyjs)( x[ i ], y[ i ] ); \
+	} \
+	else \
+	{ \
+		for ( i = 0; i < n_pre; ++i ) \
+			PASTEMAC2(ch,ch,copys)( x[ i ], y[ i ] ); \
+	} \
+\
+	x += n_pre; \
+	y += n_pre; \
+	n -= n_pre; \
+	n_run = n / n_elem_per_it; \
+\
+	xr = ( ctype_r* )x; \
+	yr = ( ctype_r* )y; \
+\
+	conjv = _mm256_setzero_ ## sfx(); \
+	if ( bli_is_conj( conjx ) ) \
+		conjv = imag_sign; \
+\
+	for ( i = 0; i < n_run; ++i ) \
+	{ \
+		_mm256_storeu_ ## sfx( yr + 0*n_real_per_reg, _mm256_xor_ ## sfx( conjv, _mm256_loadu_ ## sfx( xr + 0*n_real_per_reg ) ) ); \
+		_mm256_storeu_ ## sfx( yr + 1*n_real_per_reg, _mm256_xor_ ## sfx( conjv, _mm256_loadu_ ## sfx( xr + 1*n_real_per_reg ) ) ); \
+		_mm256_storeu_ ## sfx( yr + 2*n_real_per_reg, _mm256_xor_ ## sfx( conjv, _mm256_loadu_ ## sfx( xr + 2*n_real_per_reg ) ) ); \
+		_mm256_storeu_ ## sfx( yr + 3*n_real_per_reg, _mm256_xor_ ## sfx( conjv, _mm256_loadu_ ## sfx( xr + 3*n_real_per_reg ) ) ); \
+\
+		xr += n_iter_unroll * n_real_per_reg; \
+		yr += n_iter_unroll * n_real_per_reg; \
+	} \
+\
+	x = ( ctype* )xr; \
+	y = ( ctype* )yr; \
+\
+	if ( bli_is_conj( conjx ) ) \
+	{ \
+		for ( i = 0; i < n % n_elem_per_it; ++i ) \
+			PASTEMAC2(ch,ch,copyjs)( x[ i ], y[ i ] ); \
+	} \
+	else \
+	{ \
+		for ( i = 0; i < n % n_elem_per_it; ++i ) \
+			PASTEMAC2(ch,ch,copys)( x[ i ], y[ i ] ); \
+	} \
+}
+
+COPYV_OPT( float,    float,  s, __m256,  ps, _mm256_setzero_ps() )
+COPYV_OPT( double,   double, d, __m256d, pd, _mm256_setzero_pd() )
+COPYV_OPT( scomplex, float,  c, __m256,  ps,
+           _mm256_set_ps( -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f ) )
+COPYV_OPT( dcomplex, double, z, __m256d, pd,
+           _mm256_set_pd( -0.0, 0.0, -0.0, 0.0 ) )
+
@@ -0,0 +1,233 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// AVX dotv kernels. Contiguous vectors are reduced into four independent
+// ymm accumulators per iteration, which are summed horizontally at the
+// end. Vectors with non-unit stride are passed to the reference kernel.
+// Since x and y are both only read, no alignment prologue is used.
+
+#undef  DOTV_OPT_REAL
+#define DOTV_OPT_REAL( ctype, ch, vtype, sfx ) \
+\
+void PASTEMAC(ch,dotv_opt_avx) \
+     ( \
+       conj_t           conjx, \
+       conj_t           conjy, \
+       dim_t            n, \
+       ctype*  restrict x, inc_t incx, \
+       ctype*  restrict y, inc_t incy, \
+       ctype*  restrict rho  \
+     ) \
+{ \
+	const dim_t n_elem_per_reg = sizeof( vtype ) / sizeof( ctype ); \
+	const dim_t n_iter_unroll  = 4; \
+	const dim_t n_elem_per_it  = n_elem_per_reg * n_iter_unroll; \
+	ctype       rho_v[ sizeof( vtype ) / sizeof( ctype ) ] \
+	                  __attribute__((aligned(32))); \
+	ctype       rho1c; \
+	vtype       rho0v, rho1v, rho2v, rho3v; \
+	dim_t       n_run, i; \
+\
+	if ( incx != 1 || incy != 1 ) \
+	{ \
+		PASTEMAC3(ch,ch,ch,dotv_ref)( conjx, conjy, n, \
+		                              x, incx, y, incy, rho ); \
+		return; \
+	} \
+\
+	n_run = n / n_elem_per_it; \
+\
+	rho0v = _mm256_setzero_ ## sfx(); \
+	rho1v = _mm256_setzero_ ## sfx(); \
+	rho2v = _mm256_setzero_ ## sfx(); \
+	rho3v = _mm256_setzero_ ## sfx(); \
+\
+	for ( i = 0; i < n_run; ++i ) \
+	{ \
+		rho0v = _mm256_add_ ## sfx( rho0v, _mm256_mul_ ## sfx( _mm256_loadu_ ## sfx( x + 0*n_elem_per_reg ), \
+		                                                       _mm256_loadu_ ## sfx( y + 0*n_elem_per_reg ) ) ); \
+		rho1v = _mm256_add_ ## sfx( rho1v, _mm256_mul_ ## sfx( _mm256_loadu_ ## sfx( x + 1*n_elem_per_reg ), \
+		                                                       _mm256_loadu_ ## sfx( y + 1*n_elem_per_reg ) ) ); \
+		rho2v = _mm256_add_ ## sfx( rho2v, _mm256_mul_ ## sfx( _mm256_loadu_ ## sfx( x + 2*n_elem_per_reg ), \
+		                                                       _mm256_loadu_ ## sfx( y + 2*n_elem_per_reg ) ) ); \
+		rho3v = _mm256_add_ ## sfx( rho3v, _mm256_mul_ ## sfx( _mm256_loadu_ ## sfx( x + 3*n_elem_per_reg ), \
+		                                                       _mm256_loadu_ ## sfx( y + 3*n_elem_per_reg ) ) ); \
+\
+		x += n_elem_per_it; \
+		y += n_elem_per_it; \
+	} \
+\
+	rho0v = _mm256_add_ ## sfx( _mm256_add_ ## sfx( rho0v, rho1v ), \
+	                            _mm256_add_ ## sfx( rho2v, rho3v ) ); \
+	_mm256_store_ ## sfx( rho_v, rho0v ); \
+\
+	rho1c = 0; \
+	for ( i = 0; i < n_elem_per_reg; ++i ) \
+		rho1c += rho_v[ i ]; \
+\
+	for ( i = 0; i < n % n_elem_per_it; ++i ) \
+		rho1c += x[ i ] * y[ i ]; \
+\
+	*rho = rho1c; \
+}
+
+DOTV_OPT_REAL( float,  s, __m256,  ps )
+DOTV_OPT_REAL( double, d, __m256d, pd )
+
+
+// For complex types, two sets of accumulators are kept: one with the
+// elementwise products of x and y, and one with the elementwise products
+// of x and y', where y' is y with the real and imaginary parts of each
+// element swapped. The real and imaginary parts of the dot product are
+// then sums and differences of the even and odd lanes of these
+// accumulators, with the signs depending only on whether x is conjugated.
+// As in the reference kernel, conjugation of y is handled by toggling the
+// conjugation of x and conjugating the result.
+
+#undef  DOTV_OPT_CMPLX
+#define DOTV_OPT_CMPLX( ctype, ctype_r, ch, vtype, sfx, swap ) \
+\
+void PASTEMAC(ch,dotv_opt_avx) \
+     ( \
+       conj_t           conjx, \
+       conj_t           conjy, \
+       dim_t            n, \
+       ctype*  restrict x, inc_t incx, \
+       ctype*  restrict y, inc_t incy, \
+       ctype*  restrict rho  \
+     ) \
+{ \
+	const dim_t n_elem_per_reg = sizeof( vtype ) / sizeof( ctype ); \
+	const dim_t n_real_per_reg = sizeof( vtype ) / sizeof( ctype_r ); \
+	const dim_t n_iter_unroll  = 2; \
+	const dim_t n_elem_per_it  = n_elem_per_reg * n_iter_unroll; \
+	ctype_r     rr_v[ sizeof( vtype ) / sizeof( ctype_r ) ] \
+	                  __attribute__((aligned(32))); \
+	ctype_r     ri_v[ sizeof( vtype ) / sizeof( ctype_r ) ] \
+	                  __attribute__((aligned(32))); \
+	ctype_r*    xr; \
+	ctype_r*    yr; \
+	ctype_r     rr_even, rr_odd, ri_even, ri_odd; \
+	ctype       rho1c; \
+	conj_t      conjx_use; \
+	vtype       x0v, x1v, y0v, y1v; \
+	vtype       rr0v, rr1v, ri0v, ri1v; \
+	dim_t       n_run, i; \
+\
+	if ( incx != 1 || incy != 1 ) \
+	{ \
+		PASTEMAC3(ch,ch,ch,dotv_ref)( conjx, conjy, n, \
+		                              x, incx, y, incy, rho ); \
+		return; \
+	} \
+\
+	conjx_use = conjx; \
+	if ( bli_is_conj( conjy ) ) \
+		bli_toggle_conj( conjx_use ); \
+\
+	n_run = n / n_elem_per_it; \
+\
+	xr = ( ctype_r* )x; \
+	yr = ( ctype_r* )y; \
+\
+	rr0v = _mm256_setzero_ ## sfx(); \
+	rr1v = _mm256_setzero_ ## sfx(); \
+	ri0v = _mm256_setzero_ ## sfx(); \
+	ri1v = _mm256_setzero_ ## sfx(); \
+\
+	for ( i = 0; i < n_run; ++i ) \
+	{ \
+		x0v = _mm256_loadu_ ## sfx( xr + 0*n_real_per_reg ); \
+		y0v = _mm256_loadu_ ## sfx( yr + 0*n_real_per_reg ); \
+		x1v = _mm256_loadu_ ## sfx( xr + 1*n_real_per_reg ); \
+		y1v = _mm256_loadu_ ## sfx( yr + 1*n_real_per_reg ); \
+\
+		rr0v = _mm256_add_ ## sfx( rr0v, _mm256_mul_ ## sfx( x0v, y0v ) ); \
+		ri0v = _mm256_add_ ## sfx( ri0v, _mm256_mul_ ## sfx( x0v, swap( y0v ) ) ); \
+		rr1v = _mm256_add_ ## sfx( rr1v, _mm256_mul_ ## sfx( x1v, y1v ) ); \
+		ri1v = _mm256_add_ ## sfx( ri1v, _mm256_mul_ ## sfx( x1v, swap( y1v ) ) ); \
+\
+		xr += n_iter_unroll * n_real_per_reg; \
+		yr += n_iter_unroll * n_real_per_reg; \
+	} \
+\
+	_mm256_store_ ## sfx( rr_v, _mm256_add_ ## sfx( rr0v, rr1v ) ); \
+	_mm256_store_ ## sfx( ri_v, _mm256_add_ ## sfx( ri0v, ri1v ) ); \
+\
+	rr_even = rr_odd = ri_even = ri_odd = 0; \
+	for ( i = 0; i < n_real_per_reg; i += 2 ) \
+	{ \
+		rr_even += rr_v[ i ]; rr_odd += rr_v[ i + 1 ]; \
+		ri_even += ri_v[ i ]; ri_odd += ri_v[ i + 1 ]; \
+	} \
+\
+	if ( bli_is_conj( conjx_use ) ) \
+	{ \
+		PASTEMAC(ch,sets)( rr_even + rr_odd, ri_even - ri_odd, rho1c ); \
+	} \
+	else \
+	{ \
+		PASTEMAC(ch,sets)( rr_even - rr_odd, ri_even + ri_odd, rho1c ); \
+	} \
+\
+	x = ( ctype* )xr; \
+	y = ( ctype* )yr; \
+\
+	if ( bli_is_conj( conjx_use ) ) \
+	{ \
+		for ( i = 0; i < n % n_elem_per_it; ++i ) \
+			PASTEMAC3(ch,ch,ch,dotjs)( x[ i ], y[ i ], rho1c ); \
+	} \
+	else \
+	{ \
+		for ( i = 0; i < n % n_elem_per_it; ++i ) \
+			PASTEMAC3(ch,ch,ch,dots)( x[ i ], y[ i ], rho1c ); \
+	} \
+\
+	if ( bli_is_conj( conjy ) ) \
+		PASTEMAC(ch,conjs)( rho1c ); \
+\
+	*rho = rho1c; \
+}
+
+#define DOTV_SWAP_PS( v ) _mm256_permute_ps( v, 0xB1 )
+#define DOTV_SWAP_PD( v ) _mm256_permute_pd( v, 0x5 )
+
+DOTV_OPT_CMPLX( scomplex, float,  c, __m256,  ps, DOTV_SWAP_PS )
+DOTV_OPT_CMPLX( dcomplex, double, z, __m256d, pd, DOTV_SWAP_PD )
+
@@ -0,0 +1,204 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// AVX scalv kernels. Contiguous vectors are scaled four ymm registers per
+// iteration after a short scalar prologue that brings x to a 32-byte
+// boundary. Vectors with non-unit stride are passed to the reference
+// kernel. As in the reference kernel, a beta of one returns immediately
+// and a beta of zero is handled by setv.
+
+#undef  SCALV_OPT_REAL
+#define SCALV_OPT_REAL( ctype, ch, vtype, sfx ) \
+\
+void PASTEMAC(ch,scalv_opt_avx) \
+     ( \
+       conj_t           conjbeta, \
+       dim_t            n, \
+       ctype*  restrict beta, \
+       ctype*  restrict x, inc_t incx  \
+     ) \
+{ \
+	const dim_t n_elem_per_reg = sizeof( vtype ) / sizeof( ctype ); \
+	const dim_t n_iter_unroll  = 4; \
+	const dim_t n_elem_per_it  = n_elem_per_reg * n_iter_unroll; \
+	ctype       beta1c         = *beta; \
+	vtype       betav; \
+	dim_t       n_pre, n_run, i; \
+\
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	/* If beta is one, return. */ \
+	if ( PASTEMAC(ch,eq1)( beta1c ) ) return; \
+\
+	/* If beta is zero, use setv. */ \
+	if ( PASTEMAC(ch,eq0)( beta1c ) ) \
+	{ \
+		PASTEMAC2(ch,ch,SETV_KERNEL)( n, PASTEMAC(ch,0), x, incx ); \
+		return; \
+	} \
+\
+	if ( incx != 1 ) \
+	{ \
+		PASTEMAC2(ch,ch,scalv_ref)( conjbeta, n, beta, x, incx ); \
+		return; \
+	} \
+\
+	n_pre = ( uintptr_t )x % 32; \
+	if ( n_pre != 0 ) n_pre = ( 32 - n_pre ) / sizeof( ctype ); \
+	n_pre = bli_min( n_pre, n ); \
+\
+	for ( i = 0; i < n_pre; ++i ) \
+		x[ i ] *= beta1c; \
+\
+	x += n_pre; \
+	n -= n_pre; \
+	n_run = n / n_elem_per_it; \
+\
+	betav = _mm256_set1_ ## sfx( beta1c ); \
+\
+	for ( i = 0; i < n_run; ++i ) \
+	{ \
+		_mm256_storeu_ ## sfx( x + 0*n_elem_per_reg, _mm256_mul_ ## sfx( betav, _mm256_loadu_ ## sfx( x + 0*n_elem_per_reg ) ) ); \
+		_mm256_storeu_ ## sfx( x + 1*n_elem_per_reg, _mm256_mul_ ## sfx( betav, _mm256_loadu_ ## sfx( x + 1*n_elem_per_reg ) ) ); \
+		_mm256_storeu_ ## sfx( x + 2*n_elem_per_reg, _mm256_mul_ ## sfx( betav, _mm256_loadu_ ## sfx( x + 2*n_elem_per_reg ) ) ); \
+		_mm256_storeu_ ## sfx( x + 3*n_elem_per_reg, _mm256_mul_ ## sfx( betav, _mm256_loadu_ ## sfx( x + 3*n_elem_per_reg ) ) ); \
+\
+		x += n_elem_per_it; \
+	} \
+\
+	for ( i = 0; i < n % n_elem_per_it; ++i ) \
+		x[ i ] *= beta1c; \
+}
+
+SCALV_OPT_REAL( float,  s, __m256,  ps )
+SCALV_OPT_REAL( double, d, __m256d, pd )
+
+
+// For complex types, the product beta * x is formed as
+// addsub( br * x, bi * x' ), where x' is x with the real and imaginary
+// parts of each element swapped.
+
+#undef  SCALV_OPT_CMPLX
+#define SCALV_OPT_CMPLX( ctype, ctype_r, ch, vtype, sfx, swap ) \
+\
+void PASTEMAC(ch,scalv_opt_avx) \
+     ( \
+       conj_t           conjbeta, \
+       dim_t            n, \
+       ctype*  restrict beta, \
+       ctype*  restrict x, inc_t incx  \
+     ) \
+{ \
+	const dim_t n_elem_per_reg = sizeof( vtype ) / sizeof( ctype ); \
+	const dim_t n_real_per_reg = sizeof( vtype ) / sizeof( ctype_r ); \
+	const dim_t n_iter_unroll  = 4; \
+	const dim_t n_elem_per_it  = n_elem_per_reg * n_iter_unroll; \
+	ctype       beta1c; \
+	ctype_r*    xr; \
+	vtype       brv, biv; \
+	vtype       x0v, x1v, x2v, x3v; \
+	dim_t       n_pre, n_run, i; \
+\
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	/* If beta is one, return. */ \
+	if ( PASTEMAC(ch,eq1)( *beta ) ) return; \
+\
+	/* If beta is zero, use setv. */ \
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		PASTEMAC2(ch,ch,SETV_KERNEL)( n, PASTEMAC(ch,0), x, incx ); \
+		return; \
+	} \
+\
+	if ( incx != 1 ) \
+	{ \
+		PASTEMAC2(ch,ch,scalv_ref)( conjbeta, n, beta, x, incx ); \
+		return; \
+	} \
+\
+	PASTEMAC(ch,copycjs)( conjbeta, *beta, beta1c ); \
+\
+	n_pre = ( uintptr_t )x % 32; \
+	if ( n_pre != 0 ) n_pre = ( 32 - n_pre ) / sizeof( ctype ); \
+	n_pre = bli_min( n_pre, n ); \
+\
+	for ( i = 0; i < n_pre; ++i ) \
+		PASTEMAC2(ch,ch,scals)( beta1c, x[ i ] ); \
+\
+	x += n_pre; \
+	n -= n_pre; \
+	n_run = n / n_elem_per_it; \
+\
+	xr = ( ctype_r* )x; \
+\
+	brv = _mm256_set1_ ## sfx( PASTEMAC(ch,real)( beta1c ) ); \
+	biv = _mm256_set1_ ## sfx( PASTEMAC(ch,imag)( beta1c ) ); \
+\
+	for ( i = 0; i < n_run; ++i ) \
+	{ \
+		x0v = _mm256_loadu_ ## sfx( xr + 0*n_real_per_reg ); \
+		x1v = _mm256_loadu_ ## sfx( xr + 1*n_real_per_reg ); \
+		x2v = _mm256_loadu_ ## sfx( xr + 2*n_real_per_reg ); \
+		x3v = _mm256_loadu_ ## sfx( xr + 3*n_real_per_reg ); \
+\
+		x0v = _mm256_addsub_ ## sfx( _mm256_mul_ ## sfx( brv, x0v ), _mm256_mul_ ## sfx( biv, swap( x0v ) ) ); \
+		x1v = _mm256_addsub_ ## sfx( _mm256_mul_ ## sfx( brv, x1v ), _mm256_mul_ ## sfx( biv, swap( x1v ) ) ); \
+		x2v = _mm256_addsub_ ## sfx( _mm256_mul_ ## sfx( brv, x2v ), _mm256_mul_ ## sfx( biv, swap( x2v ) ) ); \
+		x3v = _mm256_addsub_ ## sfx( _mm256_mul_ ## sfx( brv, x3v ), _mm256_mul_ ## sfx( biv, swap( x3v ) ) ); \
+\
+		_mm256_storeu_ ## sfx( xr + 0*n_real_per_reg, x0v ); \
+		_mm256_storeu_ ## sfx( xr + 1*n_real_per_reg, x1v ); \
+		_mm256_storeu_ ## sfx( xr + 2*n_real_per_reg, x2v ); \
+		_mm256_storeu_ ## sfx( xr + 3*n_real_per_reg, x3v ); \
+\
+		xr += n_iter_unroll * n_real_per_reg; \
+	} \
+\
+	x = ( ctype* )xr; \
+\
+	for ( i = 0; i < n % n_elem_per_it; ++i ) \
+		PASTEMAC2(ch,ch,scals)( beta1c, x[ i ] ); \
+}
+
+#define SCALV_SWAP_PS( v ) _mm256_permute_ps( v, 0xB1 )
+#define SCALV_SWAP_PD( v ) _mm256_permute_pd( v, 0x5 )
+
+SCALV_OPT_CMPLX( scomplex, float,  c, __m256,  ps, SCALV_SWAP_PS )
+SCALV_OPT_CMPLX( dcomplex, double, z, __m256d, pd, SCALV_SWAP_PD )
+
@@ -0,0 +1,111 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// AVX axpy2v kernels for real domain. Both updates are applied to z in a
+// single pass, in the same order as two consecutive axpyv calls:
+//
+//   z := ( z + alpha1 * x ) + alpha2 * y
+//
+// Vectors with non-unit stride are passed to the reference kernel.
+
+#undef  AXPY2V_OPT_REAL
+#define AXPY2V_OPT_REAL( ctype, ch, vtype, sfx ) \
+\
+void PASTEMAC(ch,axpy2v_opt_avx) \
+     ( \
+       conj_t           conjx, \
+       conj_t           conjy, \
+       dim_t            n, \
+       ctype*  restrict alpha1, \
+       ctype*  restrict alpha2, \
+       ctype*  restrict x, inc_t incx, \
+       ctype*  restrict y, inc_t incy, \
+       ctype*  restrict z, inc_t incz  \
+     ) \
+{ \
+	const dim_t n_elem_per_reg = sizeof( vtype ) / sizeof( ctype ); \
+	const dim_t n_iter_unroll  = 2; \
+	const dim_t n_elem_per_it  = n_elem_per_reg * n_iter_unroll; \
+	ctype       alpha1c        = *alpha1; \
+	ctype       alpha2c        = *alpha2; \
+	vtype       alpha1v, alpha2v; \
+	vtype       z0v, z1v; \
+	dim_t       n_run, i; \
+\
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	if ( incx != 1 || incy != 1 || incz != 1 ) \
+	{ \
+		PASTEMAC3(ch,ch,ch,axpy2v_ref)( conjx, conjy, n, alpha1, alpha2, \
+		                                x, incx, y, incy, z, incz ); \
+		return; \
+	} \
+\
+	n_run = n / n_elem_per_it; \
+\
+	alpha1v = _mm256_set1_ ## sfx( alpha1c ); \
+	alpha2v = _mm256_set1_ ## sfx( alpha2c ); \
+\
+	for ( i = 0; i < n_run; ++i ) \
+	{ \
+		z0v = _mm256_loadu_ ## sfx( z + 0*n_elem_per_reg ); \
+		z1v = _mm256_loadu_ ## sfx( z + 1*n_elem_per_reg ); \
+\
+		z0v = _mm256_add_ ## sfx( z0v, _mm256_mul_ ## sfx( alpha1v, _mm256_loadu_ ## sfx( x + 0*n_elem_per_reg ) ) ); \
+		z1v = _mm256_add_ ## sfx( z1v, _mm256_mul_ ## sfx( alpha1v, _mm256_loadu_ ## sfx( x + 1*n_elem_per_reg ) ) ); \
+		z0v = _mm256_add_ ## sfx( z0v, _mm256_mul_ ## sfx( alpha2v, _mm256_loadu_ ## sfx( y + 0*n_elem_per_reg ) ) ); \
+		z1v = _mm256_add_ ## sfx( z1v, _mm256_mul_ ## sfx( alpha2v, _mm256_loadu_ ## sfx( y + 1*n_elem_per_reg ) ) ); \
+\
+		_mm256_storeu_ ## sfx( z + 0*n_elem_per_reg, z0v ); \
+		_mm256_storeu_ ## sfx( z + 1*n_elem_per_reg, z1v ); \
+\
+		x += n_elem_per_it; \
+		y += n_elem_per_it; \
+		z += n_elem_per_it; \
+	} \
+\
+	for ( i = 0; i < n % n_elem_per_it; ++i ) \
+	{ \
+		z[ i ] += alpha1c * x[ i ]; \
+		z[ i ] += alpha2c * y[ i ]; \
+	} \
+}
+
+AXPY2V_OPT_REAL( float,  s, __m256,  ps )
+AXPY2V_OPT_REAL( double, d, __m256d, pd )
+
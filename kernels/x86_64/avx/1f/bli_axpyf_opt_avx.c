@@ -0,0 +1,146 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// AVX axpyf kernels for real domain with a fusing factor of eight:
+//
+//   y := y + alpha * A * x
+//
+// where A is m x 8. Each element of y is loaded and stored once, and the
+// eight column updates are applied to it in column order, as successive
+// axpyv calls would. Operands whose column (inca) or y stride is not unit,
+// and panels narrower than the fusing factor, are passed to the reference
+// kernel.
+
+// Apply the update for one column of A to two registers' worth of y.
+#define AXPYF_OPT_COL( sfx, y0v, y1v, chiv, aj ) \
+\
+	y0v = _mm256_add_ ## sfx( y0v, _mm256_mul_ ## sfx( chiv, _mm256_loadu_ ## sfx( aj + 0*n_elem_per_reg ) ) ); \
+	y1v = _mm256_add_ ## sfx( y1v, _mm256_mul_ ## sfx( chiv, _mm256_loadu_ ## sfx( aj + 1*n_elem_per_reg ) ) );
+
+#undef  AXPYF_OPT_REAL
+#define AXPYF_OPT_REAL( ctype, ch, vtype, sfx ) \
+\
+void PASTEMAC(ch,axpyf_opt_avx) \
+     ( \
+       conj_t           conja, \
+       conj_t           conjx, \
+       dim_t            m, \
+       dim_t            b_n, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t inca, inc_t lda, \
+       ctype*  restrict x, inc_t incx, \
+       ctype*  restrict y, inc_t incy  \
+     ) \
+{ \
+	const dim_t n_elem_per_reg = sizeof( vtype ) / sizeof( ctype ); \
+	const dim_t n_iter_unroll  = 2; \
+	const dim_t n_elem_per_it  = n_elem_per_reg * n_iter_unroll; \
+	const dim_t fuse_fac       = 8; \
+	ctype*      a0             = a + 0*lda; \
+	ctype*      a1             = a + 1*lda; \
+	ctype*      a2             = a + 2*lda; \
+	ctype*      a3             = a + 3*lda; \
+	ctype*      a4             = a + 4*lda; \
+	ctype*      a5             = a + 5*lda; \
+	ctype*      a6             = a + 6*lda; \
+	ctype*      a7             = a + 7*lda; \
+	ctype       chi0, chi1, chi2, chi3, chi4, chi5, chi6, chi7; \
+	vtype       chi0v, chi1v, chi2v, chi3v, chi4v, chi5v, chi6v, chi7v; \
+	vtype       y0v, y1v; \
+	dim_t       m_run, i; \
+\
+	if ( bli_zero_dim1( m ) ) return; \
+\
+	if ( b_n != fuse_fac || inca != 1 || incy != 1 ) \
+	{ \
+		PASTEMAC3(ch,ch,ch,axpyf_ref)( conja, conjx, m, b_n, alpha, \
+		                               a, inca, lda, x, incx, y, incy ); \
+		return; \
+	} \
+\
+	chi0 = *alpha * x[ 0*incx ]; chi0v = _mm256_set1_ ## sfx( chi0 ); \
+	chi1 = *alpha * x[ 1*incx ]; chi1v = _mm256_set1_ ## sfx( chi1 ); \
+	chi2 = *alpha * x[ 2*incx ]; chi2v = _mm256_set1_ ## sfx( chi2 ); \
+	chi3 = *alpha * x[ 3*incx ]; chi3v = _mm256_set1_ ## sfx( chi3 ); \
+	chi4 = *alpha * x[ 4*incx ]; chi4v = _mm256_set1_ ## sfx( chi4 ); \
+	chi5 = *alpha * x[ 5*incx ]; chi5v = _mm256_set1_ ## sfx( chi5 ); \
+	chi6 = *alpha * x[ 6*incx ]; chi6v = _mm256_set1_ ## sfx( chi6 ); \
+	chi7 = *alpha * x[ 7*incx ]; chi7v = _mm256_set1_ ## sfx( chi7 ); \
+\
+	m_run = m / n_elem_per_it; \
+\
+	for ( i = 0; i < m_run; ++i ) \
+	{ \
+		y0v = _mm256_loadu_ ## sfx( y + 0*n_elem_per_reg ); \
+		y1v = _mm256_loadu_ ## sfx( y + 1*n_elem_per_reg ); \
+\
+		AXPYF_OPT_COL( sfx, y0v, y1v, chi0v, a0 ) \
+		AXPYF_OPT_COL( sfx, y0v, y1v, chi1v, a1 ) \
+		AXPYF_OPT_COL( sfx, y0v, y1v, chi2v, a2 ) \
+		AXPYF_OPT_COL( sfx, y0v, y1v, chi3v, a3 ) \
+		AXPYF_OPT_COL( sfx, y0v, y1v, chi4v, a4 ) \
+		AXPYF_OPT_COL( sfx, y0v, y1v, chi5v, a5 ) \
+		AXPYF_OPT_COL( sfx, y0v, y1v, chi6v, a6 ) \
+		AXPYF_OPT_COL( sfx, y0v, y1v, chi7v, a7 ) \
+\
+		_mm256_storeu_ ## sfx( y + 0*n_elem_per_reg, y0v ); \
+		_mm256_storeu_ ## sfx( y + 1*n_elem_per_reg, y1v ); \
+\
+		a0 += n_elem_per_it; a1 += n_elem_per_it; \
+		a2 += n_elem_per_it; a3 += n_elem_per_it; \
+		a4 += n_elem_per_it; a5 += n_elem_per_it; \
+		a6 += n_elem_per_it; a7 += n_elem_per_it; \
+		y  += n_elem_per_it; \
+	} \
+\
+	for ( i = 0; i < m % n_elem_per_it; ++i ) \
+	{ \
+		y[ i ] += chi0 * a0[ i ]; \
+		y[ i ] += chi1 * a1[ i ]; \
+		y[ i ] += chi2 * a2[ i ]; \
+		y[ i ] += chi3 * a3[ i ]; \
+		y[ i ] += chi4 * a4[ i ]; \
+		y[ i ] += chi5 * a5[ i ]; \
+		y[ i ] += chi6 * a6[ i ]; \
+		y[ i ] += chi7 * a7[ i ]; \
+	} \
+}
+
+AXPYF_OPT_REAL( float,  s, __m256,  ps )
+AXPYF_OPT_REAL( double, d, __m256d, pd )
+
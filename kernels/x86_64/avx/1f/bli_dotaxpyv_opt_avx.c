@@ -0,0 +1,134 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// AVX dotaxpyv kernels for real domain. x is read once and used both for
+// the dot product with y and for the update of z. The dot product is
+// reduced with the same accumulator layout as the AVX dotv kernel, so
+// rho is identical to the result of dotv for the same operands. Vectors
+// with non-unit stride are passed to the reference kernel.
+
+#undef  DOTAXPYV_OPT_REAL
+#define DOTAXPYV_OPT_REAL( ctype, ch, vtype, sfx ) \
+\
+void PASTEMAC(ch,dotaxpyv_opt_avx) \
+     ( \
+       conj_t           conjxt, \
+       conj_t           conjx, \
+       conj_t           conjy, \
+       dim_t            m, \
+       ctype*  restrict alpha, \
+       ctype*  restrict x, inc_t incx, \
+       ctype*  restrict y, inc_t incy, \
+       ctype*  restrict rho, \
+       ctype*  restrict z, inc_t incz  \
+     ) \
+{ \
+	const dim_t n_elem_per_reg = sizeof( vtype ) / sizeof( ctype ); \
+	const dim_t n_iter_unroll  = 4; \
+	const dim_t n_elem_per_it  = n_elem_per_reg * n_iter_unroll; \
+	ctype       rho_v[ sizeof( vtype ) / sizeof( ctype ) ] \
+	                  __attribute__((aligned(32))); \
+	ctype       alpha1c        = *alpha; \
+	ctype       rho1c; \
+	vtype       alphav; \
+	vtype       x0v, x1v, x2v, x3v; \
+	vtype       rho0v, rho1v, rho2v, rho3v; \
+	dim_t       m_run, i; \
+\
+	if ( incx != 1 || incy != 1 || incz != 1 ) \
+	{ \
+		PASTEMAC3(ch,ch,ch,dotaxpyv_ref)( conjxt, conjx, conjy, m, alpha, \
+		                                  x, incx, y, incy, rho, z, incz ); \
+		return; \
+	} \
+\
+	m_run = m / n_elem_per_it; \
+\
+	alphav = _mm256_set1_ ## sfx( alpha1c ); \
+\
+	rho0v = _mm256_setzero_ ## sfx(); \
+	rho1v = _mm256_setzero_ ## sfx(); \
+	rho2v = _mm256_setzero_ ## sfx(); \
+	rho3v = _mm256_setzero_ ## sfx(); \
+\
+	for ( i = 0; i < m_run; ++i ) \
+	{ \
+		x0v = _mm256_loadu_ ## sfx( x + 0*n_elem_per_reg ); \
+		x1v = _mm256_loadu_ ## sfx( x + 1*n_elem_per_reg ); \
+		x2v = _mm256_loadu_ ## sfx( x + 2*n_elem_per_reg ); \
+		x3v = _mm256_loadu_ ## sfx( x + 3*n_elem_per_reg ); \
+\
+		rho0v = _mm256_add_ ## sfx( rho0v, _mm256_mul_ ## sfx( x0v, _mm256_loadu_ ## sfx( y + 0*n_elem_per_reg ) ) ); \
+		rho1v = _mm256_add_ ## sfx( rho1v, _mm256_mul_ ## sfx( x1v, _mm256_loadu_ ## sfx( y + 1*n_elem_per_reg ) ) ); \
+		rho2v = _mm256_add_ ## sfx( rho2v, _mm256_mul_ ## sfx( x2v, _mm256_loadu_ ## sfx( y + 2*n_elem_per_reg ) ) ); \
+		rho3v = _mm256_add_ ## sfx( rho3v, _mm256_mul_ ## sfx( x3v, _mm256_loadu_ ## sfx( y + 3*n_elem_per_reg ) ) ); \
+\
+		_mm256_storeu_ ## sfx( z + 0*n_elem_per_reg, _mm256_add_ ## sfx( _mm256_loadu_ ## sfx( z + 0*n_elem_per_reg ), \
+		                                                                 _mm256_mul_ ## sfx( alphav, x0v ) ) ); \
+		_mm256_storeu_ ## sfx( z + 1*n_elem_per_reg, _mm256_add_ ## sfx( _mm256_loadu_ ## sfx( z + 1*n_elem_per_reg ), \
+		                                                                 _mm256_mul_ ## sfx( alphav, x1v ) ) ); \
+		_mm256_storeu_ ## sfx( z + 2*n_elem_per_reg, _mm256_add_ ## sfx( _mm256_loadu_ ## sfx( z + 2*n_elem_per_reg ), \
+		                                                                 _mm256_mul_ ## sfx( alphav, x2v ) ) ); \
+		_mm256_storeu_ ## sfx( z + 3*n_elem_per_reg, _mm256_add_ ## sfx( _mm256_loadu_ ## sfx( z + 3*n_elem_per_reg ), \
+		                                                                 _mm256_mul_ ## sfx( alphav, x3v ) ) ); \
+\
+		x += n_elem_per_it; \
+		y += n_elem_per_it; \
+		z += n_elem_per_it; \
+	} \
+\
+	rho0v = _mm256_add_ ## sfx( _mm256_add_ ## sfx( rho0v, rho1v ), \
+	                            _mm256_add_ ## sfx( rho2v, rho3v ) ); \
+	_mm256_store_ ## sfx( rho_v, rho0v ); \
+\
+	rho1c = 0; \
+	for ( i = 0; i < n_elem_per_reg; ++i ) \
+		rho1c += rho_v[ i ]; \
+\
+	for ( i = 0; i < m % n_elem_per_it; ++i ) \
+	{ \
+		rho1c  += x[ i ] * y[ i ]; \
+		z[ i ] += alpha1c * x[ i ]; \
+	} \
+\
+	*rho = rho1c; \
+}
+
+DOTAXPYV_OPT_REAL( float,  s, __m256,  ps )
+DOTAXPYV_OPT_REAL( double, d, __m256d, pd )
+
@@ -0,0 +1,176 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// AVX dotxaxpyf kernels for real domain with a fusing factor of eight:
+//
+//   y := beta * y + alpha * A^T w
+//   z :=        z + alpha * A   x
+//
+// where A is m x 8. Each column segment of A is loaded once and used for
+// both the dot product with w and the update of z, so A is streamed from
+// memory only once. As in the AVX dotxf kernel, each column is reduced in
+// the same order as the AVX dotv kernel reduces a vector. Operands whose
+// column (inca), w, or z stride is not unit, and panels narrower than the
+// fusing factor, are passed to the reference kernel.
+
+#undef  DOTXAXPYF_OPT_REAL
+#define DOTXAXPYF_OPT_REAL( ctype, ch, vtype, sfx ) \
+\
+void PASTEMAC(ch,dotxaxpyf_opt_avx) \
+     ( \
+       conj_t           conjat, \
+       conj_t           conja, \
+       conj_t           conjw, \
+       conj_t           conjx, \
+       dim_t            m, \
+       dim_t            b_n, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t inca, inc_t lda, \
+       ctype*  restrict w, inc_t incw, \
+       ctype*  restrict x, inc_t incx, \
+       ctype*  restrict beta, \
+       ctype*  restrict y, inc_t incy, \
+       ctype*  restrict z, inc_t incz  \
+     ) \
+{ \
+	const dim_t n_elem_per_reg = sizeof( vtype ) / sizeof( ctype ); \
+	const dim_t n_iter_unroll  = 4; \
+	const dim_t n_elem_per_it  = n_elem_per_reg * n_iter_unroll; \
+	const dim_t fuse_fac       = 8; \
+	ctype       rho_v[ sizeof( vtype ) / sizeof( ctype ) ] \
+	                  __attribute__((aligned(32))); \
+	ctype       rho[ 8 ]; \
+	ctype       chi[ 8 ]; \
+	ctype*      aj[ 8 ]; \
+	vtype       rhov[ 8 ][ 4 ]; \
+	vtype       chiv[ 8 ]; \
+	vtype       wv[ 4 ], zv[ 4 ]; \
+	vtype       av; \
+	dim_t       m_run, i, j, k; \
+\
+	if ( b_n != fuse_fac || inca != 1 || incw != 1 || incz != 1 || \
+	     bli_zero_dim1( m ) ) \
+	{ \
+		PASTEMAC3(ch,ch,ch,dotxaxpyf_ref_var2)( conjat, conja, conjw, conjx, \
+		                                        m, b_n, alpha, \
+		                                        a, inca, lda, \
+		                                        w, incw, x, incx, \
+		                                        beta, y, incy, z, incz ); \
+		return; \
+	} \
+\
+	for ( j = 0; j < fuse_fac; ++j ) \
+	{ \
+		aj[ j ]   = a + j*lda; \
+		chi[ j ]  = *alpha * x[ j*incx ]; \
+		chiv[ j ] = _mm256_set1_ ## sfx( chi[ j ] ); \
+\
+		for ( k = 0; k < n_iter_unroll; ++k ) \
+			rhov[ j ][ k ] = _mm256_setzero_ ## sfx(); \
+	} \
+\
+	m_run = m / n_elem_per_it; \
+\
+	for ( i = 0; i < m_run; ++i ) \
+	{ \
+		for ( k = 0; k < n_iter_unroll; ++k ) \
+		{ \
+			wv[ k ] = _mm256_loadu_ ## sfx( w + k*n_elem_per_reg ); \
+			zv[ k ] = _mm256_loadu_ ## sfx( z + k*n_elem_per_reg ); \
+		} \
+\
+		/* Update z with the columns in order, as a sequence of axpyv
+		   calls would. */ \
+		for ( j = 0; j < fuse_fac; ++j ) \
+		{ \
+			for ( k = 0; k < n_iter_unroll; ++k ) \
+			{ \
+				av             = _mm256_loadu_ ## sfx( aj[ j ] + k*n_elem_per_reg ); \
+				rhov[ j ][ k ] = _mm256_add_ ## sfx( rhov[ j ][ k ], _mm256_mul_ ## sfx( av, wv[ k ] ) ); \
+				zv[ k ]        = _mm256_add_ ## sfx( zv[ k ], _mm256_mul_ ## sfx( chiv[ j ], av ) ); \
+			} \
+\
+			aj[ j ] += n_elem_per_it; \
+		} \
+\
+		for ( k = 0; k < n_iter_unroll; ++k ) \
+			_mm256_storeu_ ## sfx( z + k*n_elem_per_reg, zv[ k ] ); \
+\
+		w += n_elem_per_it; \
+		z += n_elem_per_it; \
+	} \
+\
+	for ( j = 0; j < fuse_fac; ++j ) \
+	{ \
+		rhov[ j ][ 0 ] = _mm256_add_ ## sfx( _mm256_add_ ## sfx( rhov[ j ][ 0 ], rhov[ j ][ 1 ] ), \
+		                                     _mm256_add_ ## sfx( rhov[ j ][ 2 ], rhov[ j ][ 3 ] ) ); \
+		_mm256_store_ ## sfx( rho_v, rhov[ j ][ 0 ] ); \
+\
+		rho[ j ] = 0; \
+		for ( i = 0; i < n_elem_per_reg; ++i ) \
+			rho[ j ] += rho_v[ i ]; \
+	} \
+\
+	for ( i = 0; i < m % n_elem_per_it; ++i ) \
+	{ \
+		for ( j = 0; j < fuse_fac; ++j ) \
+		{ \
+			rho[ j ] += aj[ j ][ i ] * w[ i ]; \
+			z[ i ]   += chi[ j ] * aj[ j ][ i ]; \
+		} \
+	} \
+\
+	/* If beta is zero, clear y. Otherwise, scale by beta. */ \
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		for ( j = 0; j < fuse_fac; ++j ) \
+			y[ j*incy ] = 0; \
+	} \
+	else \
+	{ \
+		for ( j = 0; j < fuse_fac; ++j ) \
+			y[ j*incy ] *= *beta; \
+	} \
+\
+	for ( j = 0; j < fuse_fac; ++j ) \
+		y[ j*incy ] += *alpha * rho[ j ]; \
+}
+
+DOTXAXPYF_OPT_REAL( float,  s, __m256,  ps )
+DOTXAXPYF_OPT_REAL( double, d, __m256d, pd )
+
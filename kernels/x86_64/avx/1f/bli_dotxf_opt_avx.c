@@ -0,0 +1,150 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// AVX dotxf kernels for real domain with a fusing factor of eight:
+//
+//   y := beta * y + alpha * A^T x
+//
+// where A is m x 8. Each element of x is loaded once and multiplied
+// against all eight columns. Each column is reduced exactly as the AVX
+// dotv kernel reduces a vector (four ymm accumulators per column, one per
+// unrolled iteration, summed pairwise and then horizontally, followed by
+// the scalar edge case), so each element of y matches the corresponding
+// dotxv to the last bit. Operands whose column (inca) or x stride is not
+// unit, and panels narrower than the fusing factor, are passed to the
+// reference kernel.
+
+#undef  DOTXF_OPT_REAL
+#define DOTXF_OPT_REAL( ctype, ch, vtype, sfx ) \
+\
+void PASTEMAC(ch,dotxf_opt_avx) \
+     ( \
+       conj_t           conjat, \
+       conj_t           conjx, \
+       dim_t            m, \
+       dim_t            b_n, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t inca, inc_t lda, \
+       ctype*  restrict x, inc_t incx, \
+       ctype*  restrict beta, \
+       ctype*  restrict y, inc_t incy  \
+     ) \
+{ \
+	const dim_t n_elem_per_reg = sizeof( vtype ) / sizeof( ctype ); \
+	const dim_t n_iter_unroll  = 4; \
+	const dim_t n_elem_per_it  = n_elem_per_reg * n_iter_unroll; \
+	const dim_t fuse_fac       = 8; \
+	ctype       rho_v[ sizeof( vtype ) / sizeof( ctype ) ] \
+	                  __attribute__((aligned(32))); \
+	ctype       rho[ 8 ]; \
+	ctype*      aj[ 8 ]; \
+	vtype       rhov[ 8 ][ 4 ]; \
+	vtype       xv[ 4 ]; \
+	dim_t       m_run, i, j, k; \
+\
+	if ( b_n != fuse_fac || inca != 1 || incx != 1 || bli_zero_dim1( m ) ) \
+	{ \
+		PASTEMAC3(ch,ch,ch,dotxf_ref)( conjat, conjx, m, b_n, alpha, \
+		                               a, inca, lda, x, incx, beta, y, incy ); \
+		return; \
+	} \
+\
+	for ( j = 0; j < fuse_fac; ++j ) \
+	{ \
+		aj[ j ] = a + j*lda; \
+\
+		for ( k = 0; k < n_iter_unroll; ++k ) \
+			rhov[ j ][ k ] = _mm256_setzero_ ## sfx(); \
+	} \
+\
+	m_run = m / n_elem_per_it; \
+\
+	for ( i = 0; i < m_run; ++i ) \
+	{ \
+		for ( k = 0; k < n_iter_unroll; ++k ) \
+			xv[ k ] = _mm256_loadu_ ## sfx( x + k*n_elem_per_reg ); \
+\
+		for ( j = 0; j < fuse_fac; ++j ) \
+		{ \
+			for ( k = 0; k < n_iter_unroll; ++k ) \
+				rhov[ j ][ k ] = _mm256_add_ ## sfx( rhov[ j ][ k ], \
+				                 _mm256_mul_ ## sfx( _mm256_loadu_ ## sfx( aj[ j ] + k*n_elem_per_reg ), \
+				                                     xv[ k ] ) ); \
+\
+			aj[ j ] += n_elem_per_it; \
+		} \
+\
+		x += n_elem_per_it; \
+	} \
+\
+	for ( j = 0; j < fuse_fac; ++j ) \
+	{ \
+		rhov[ j ][ 0 ] = _mm256_add_ ## sfx( _mm256_add_ ## sfx( rhov[ j ][ 0 ], rhov[ j ][ 1 ] ), \
+		                                     _mm256_add_ ## sfx( rhov[ j ][ 2 ], rhov[ j ][ 3 ] ) ); \
+		_mm256_store_ ## sfx( rho_v, rhov[ j ][ 0 ] ); \
+\
+		rho[ j ] = 0; \
+		for ( i = 0; i < n_elem_per_reg; ++i ) \
+			rho[ j ] += rho_v[ i ]; \
+	} \
+\
+	for ( i = 0; i < m % n_elem_per_it; ++i ) \
+	{ \
+		for ( j = 0; j < fuse_fac; ++j ) \
+			rho[ j ] += aj[ j ][ i ] * x[ i ]; \
+	} \
+\
+	/* If beta is zero, clear y. Otherwise, scale by beta. */ \
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		for ( j = 0; j < fuse_fac; ++j ) \
+			y[ j*incy ] = 0; \
+	} \
+	else \
+	{ \
+		for ( j = 0; j < fuse_fac; ++j ) \
+			y[ j*incy ] *= *beta; \
+	} \
+\
+	for ( j = 0; j < fuse_fac; ++j ) \
+		y[ j*incy ] += *alpha * rho[ j ]; \
+}
+
+DOTXF_OPT_REAL( float,  s, __m256,  ps )
+DOTXF_OPT_REAL( double, d, __m256d, pd )
+
@@ -0,0 +1,162 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// These kernels pack an mr x k panel of a scomplex matrix with AVX,
+// applying the requested conjugation and the (complex) scalar kappa.
+// Conjugation flips the sign bit of each imaginary part, and scaling by
+// kappa is done with vaddsubps, so neither requires scalar code. When
+// inca == 1, each column of the panel is processed four elements (one ymm
+// register) at a time; otherwise pairs of elements are gathered into an
+// xmm register with 64-bit loads.
+
+// Multiply each complex element of x by the complex scalar whose real
+// and imaginary parts are broadcast in kr and ki.
+#define CPACKM_SCALE_YMM( x, kr, ki ) \
+	x = _mm256_addsub_ps( _mm256_mul_ps( x, kr ), \
+	                      _mm256_mul_ps( _mm256_permute_ps( x, 0xB1 ), ki ) );
+
+#define CPACKM_SCALE_XMM( x, kr, ki ) \
+	x = _mm_addsub_ps( _mm_mul_ps( x, kr ), \
+	                   _mm_mul_ps( _mm_permute_ps( x, 0xB1 ), ki ) );
+
+static inline void bli_cpackm_opt_unit
+     (
+       conj_t             conja,
+       dim_t              mr,
+       dim_t              n,
+       scomplex* restrict kappa,
+       scomplex* restrict a, inc_t lda,
+       scomplex* restrict p, inc_t ldp
+     )
+{
+	__m256  vkr   = _mm256_broadcast_ss( ( float* )kappa + 0 );
+	__m256  vki   = _mm256_broadcast_ss( ( float* )kappa + 1 );
+	__m128  xkr   = _mm256_castps256_ps128( vkr );
+	__m128  xki   = _mm256_castps256_ps128( vki );
+	__m256  vconj = _mm256_setzero_ps();
+	__m128  xconj;
+	__m256  v;
+	__m128  x;
+	bool_t  kappa_is_one = bli_ceq1( *kappa );
+	dim_t   i;
+
+	if ( bli_is_conj( conja ) )
+		vconj = _mm256_set_ps( -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f );
+	xconj = _mm256_castps256_ps128( vconj );
+
+	for ( ; n != 0; --n )
+	{
+		for ( i = 0; i + 4 <= mr; i += 4 )
+		{
+			v = _mm256_xor_ps( vconj, _mm256_loadu_ps( ( float* )( a + i ) ) );
+			if ( !kappa_is_one ) { CPACKM_SCALE_YMM( v, vkr, vki ); }
+			_mm256_storeu_ps( ( float* )( p + i ), v );
+		}
+		if ( i < mr )
+		{
+			x = _mm_xor_ps( xconj, _mm_loadu_ps( ( float* )( a + i ) ) );
+			if ( !kappa_is_one ) { CPACKM_SCALE_XMM( x, xkr, xki ); }
+			_mm_storeu_ps( ( float* )( p + i ), x );
+		}
+
+		a += lda;
+		p += ldp;
+	}
+}
+
+static inline void bli_cpackm_opt_gen
+     (
+       conj_t             conja,
+       dim_t              mr,
+       dim_t              n,
+       scomplex* restrict kappa,
+       scomplex* restrict a, inc_t inca, inc_t lda,
+       scomplex* restrict p,             inc_t ldp
+     )
+{
+	__m128  xkr   = _mm_set1_ps( bli_creal( *kappa ) );
+	__m128  xki   = _mm_set1_ps( bli_cimag( *kappa ) );
+	__m128  xconj = _mm_setzero_ps();
+	__m128  x;
+	bool_t  kappa_is_one = bli_ceq1( *kappa );
+	dim_t   i;
+
+	if ( bli_is_conj( conja ) )
+		xconj = _mm_set_ps( -0.0f, 0.0f, -0.0f, 0.0f );
+
+	for ( ; n != 0; --n )
+	{
+		for ( i = 0; i < mr; i += 2 )
+		{
+			x = _mm_loadl_pi( xconj, ( __m64* )( a + (i+0)*inca ) );
+			x = _mm_loadh_pi( x,     ( __m64* )( a + (i+1)*inca ) );
+			x = _mm_xor_ps( xconj, x );
+			if ( !kappa_is_one ) { CPACKM_SCALE_XMM( x, xkr, xki ); }
+			_mm_storeu_ps( ( float* )( p + i ), x );
+		}
+
+		a += lda;
+		p += ldp;
+	}
+}
+
+
+#undef  CPACKM_OPT_MRXK
+#define CPACKM_OPT_MRXK( mr ) \
+\
+void bli_cpackm_opt_ ## mr ## xk( \
+                                  conj_t  conja, \
+                                  dim_t   n, \
+                                  void*   beta, \
+                                  void*   a, inc_t inca, inc_t lda, \
+                                  void*   p,             inc_t ldp  \
+                                ) \
+{ \
+	if ( inca == 1 ) \
+		bli_cpackm_opt_unit( conja, mr, n, beta, a, lda, p, ldp ); \
+	else \
+		bli_cpackm_opt_gen( conja, mr, n, beta, a, inca, lda, p, ldp ); \
+}
+
+CPACKM_OPT_MRXK( 2 )
+CPACKM_OPT_MRXK( 4 )
+CPACKM_OPT_MRXK( 6 )
+CPACKM_OPT_MRXK( 8 )
+CPACKM_OPT_MRXK( 12 )
+CPACKM_OPT_MRXK( 16 )
+
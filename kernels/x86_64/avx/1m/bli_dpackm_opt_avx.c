@@ -0,0 +1,163 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// These kernels pack an mr x k panel of a real double-precision matrix
+// with AVX. Two storage cases are vectorized:
+//
+// - inca == 1: each column of the panel is contiguous (eg: packing A
+//   when A is column-stored), so it is copied (and scaled by kappa)
+//   four or two elements at a time.
+// - lda == 1: each row of the panel is contiguous (eg: packing B when B
+//   is column-stored), so 4x4 blocks are loaded by rows, transposed in
+//   registers and stored by columns.
+//
+// Any other stride combination is handed to the reference kernel.
+
+static inline void bli_dpackm_opt_unit
+     (
+       dim_t            mr,
+       dim_t            n,
+       double* restrict kappa,
+       double* restrict a, inc_t lda,
+       double* restrict p, inc_t ldp
+     )
+{
+	__m256d vkappa = _mm256_broadcast_sd( kappa );
+	__m128d xkappa = _mm256_castpd256_pd128( vkappa );
+	dim_t   i;
+
+	for ( ; n != 0; --n )
+	{
+		for ( i = 0; i + 4 <= mr; i += 4 )
+			_mm256_storeu_pd( p + i, _mm256_mul_pd( vkappa,
+			                         _mm256_loadu_pd( a + i ) ) );
+		if ( i < mr )
+			_mm_storeu_pd( p + i, _mm_mul_pd( xkappa, _mm_loadu_pd( a + i ) ) );
+
+		a += lda;
+		p += ldp;
+	}
+}
+
+static inline void bli_dpackm_opt_trans
+     (
+       dim_t            mr,
+       dim_t            n,
+       double* restrict kappa,
+       double* restrict a, inc_t inca,
+       double* restrict p, inc_t ldp
+     )
+{
+	__m256d vkappa = _mm256_broadcast_sd( kappa );
+	__m256d r0, r1, r2, r3;
+	__m256d t0, t1, t2, t3;
+	dim_t   i, j;
+
+	// Pack four columns of the panel at a time.
+	for ( j = 0; j + 4 <= n; j += 4 )
+	{
+		double* restrict aj = a + j;
+		double* restrict pj = p + j*ldp;
+
+		for ( i = 0; i + 4 <= mr; i += 4 )
+		{
+			r0 = _mm256_mul_pd( vkappa, _mm256_loadu_pd( aj + (i+0)*inca ) );
+			r1 = _mm256_mul_pd( vkappa, _mm256_loadu_pd( aj + (i+1)*inca ) );
+			r2 = _mm256_mul_pd( vkappa, _mm256_loadu_pd( aj + (i+2)*inca ) );
+			r3 = _mm256_mul_pd( vkappa, _mm256_loadu_pd( aj + (i+3)*inca ) );
+
+			t0 = _mm256_unpacklo_pd( r0, r1 );
+			t1 = _mm256_unpackhi_pd( r0, r1 );
+			t2 = _mm256_unpacklo_pd( r2, r3 );
+			t3 = _mm256_unpackhi_pd( r2, r3 );
+
+			_mm256_storeu_pd( pj + 0*ldp + i, _mm256_permute2f128_pd( t0, t2, 0x20 ) );
+			_mm256_storeu_pd( pj + 1*ldp + i, _mm256_permute2f128_pd( t1, t3, 0x20 ) );
+			_mm256_storeu_pd( pj + 2*ldp + i, _mm256_permute2f128_pd( t0, t2, 0x31 ) );
+			_mm256_storeu_pd( pj + 3*ldp + i, _mm256_permute2f128_pd( t1, t3, 0x31 ) );
+		}
+		if ( i < mr )
+		{
+			r0 = _mm256_mul_pd( vkappa, _mm256_loadu_pd( aj + (i+0)*inca ) );
+			r1 = _mm256_mul_pd( vkappa, _mm256_loadu_pd( aj + (i+1)*inca ) );
+
+			t0 = _mm256_unpacklo_pd( r0, r1 );
+			t1 = _mm256_unpackhi_pd( r0, r1 );
+
+			_mm_storeu_pd( pj + 0*ldp + i, _mm256_castpd256_pd128( t0 ) );
+			_mm_storeu_pd( pj + 1*ldp + i, _mm256_castpd256_pd128( t1 ) );
+			_mm_storeu_pd( pj + 2*ldp + i, _mm256_extractf128_pd( t0, 1 ) );
+			_mm_storeu_pd( pj + 3*ldp + i, _mm256_extractf128_pd( t1, 1 ) );
+		}
+	}
+
+	// Pack any remaining columns one element at a time.
+	for ( ; j < n; ++j )
+	{
+		for ( i = 0; i < mr; ++i )
+			bli_dscal2s( *kappa, *(a + i*inca + j), *(p + j*ldp + i) );
+	}
+}
+
+
+#undef  DPACKM_OPT_MRXK
+#define DPACKM_OPT_MRXK( mr ) \
+\
+void bli_dpackm_opt_ ## mr ## xk( \
+                                  conj_t  conja, \
+                                  dim_t   n, \
+                                  void*   beta, \
+                                  void*   a, inc_t inca, inc_t lda, \
+                                  void*   p,             inc_t ldp  \
+                                ) \
+{ \
+	if      ( inca == 1 ) \
+		bli_dpackm_opt_unit( mr, n, beta, a, lda, p, ldp ); \
+	else if ( lda == 1 ) \
+		bli_dpackm_opt_trans( mr, n, beta, a, inca, p, ldp ); \
+	else \
+		BLIS_DPACKM_ ## mr ## XK_KERNEL_REF( conja, n, beta, a, inca, lda, p, ldp ); \
+}
+
+DPACKM_OPT_MRXK( 2 )
+DPACKM_OPT_MRXK( 4 )
+DPACKM_OPT_MRXK( 6 )
+DPACKM_OPT_MRXK( 8 )
+DPACKM_OPT_MRXK( 12 )
+DPACKM_OPT_MRXK( 16 )
+
@@ -0,0 +1,166 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// These kernels pack an mr x k panel of a real single-precision matrix
+// with AVX. Two storage cases are vectorized:
+//
+// - inca == 1: each column of the panel is contiguous, so it is copied
+//   (and scaled by kappa) eight, four or two elements at a time.
+// - lda == 1: each row of the panel is contiguous, so 4x4 blocks are
+//   loaded by rows, transposed in registers and stored by columns.
+//
+// Any other stride combination is handed to the reference kernel.
+
+static inline void bli_spackm_opt_unit
+     (
+       dim_t           mr,
+       dim_t           n,
+       float* restrict kappa,
+       float* restrict a, inc_t lda,
+       float* restrict p, inc_t ldp
+     )
+{
+	__m256 vkappa = _mm256_broadcast_ss( kappa );
+	__m128 xkappa = _mm256_castps256_ps128( vkappa );
+	__m128 x;
+	dim_t  i;
+
+	for ( ; n != 0; --n )
+	{
+		for ( i = 0; i + 8 <= mr; i += 8 )
+			_mm256_storeu_ps( p + i, _mm256_mul_ps( vkappa,
+			                         _mm256_loadu_ps( a + i ) ) );
+		if ( i + 4 <= mr )
+		{
+			_mm_storeu_ps( p + i, _mm_mul_ps( xkappa, _mm_loadu_ps( a + i ) ) );
+			i += 4;
+		}
+		if ( i < mr )
+		{
+			x = _mm_loadl_pi( xkappa, ( __m64* )( a + i ) );
+			_mm_storel_pi( ( __m64* )( p + i ), _mm_mul_ps( xkappa, x ) );
+		}
+
+		a += lda;
+		p += ldp;
+	}
+}
+
+static inline void bli_spackm_opt_trans
+     (
+       dim_t           mr,
+       dim_t           n,
+       float* restrict kappa,
+       float* restrict a, inc_t inca,
+       float* restrict p, inc_t ldp
+     )
+{
+	__m128 xkappa = _mm_set1_ps( *kappa );
+	__m128 r0, r1, r2, r3;
+	dim_t  i, j;
+
+	// Pack four columns of the panel at a time.
+	for ( j = 0; j + 4 <= n; j += 4 )
+	{
+		float* restrict aj = a + j;
+		float* restrict pj = p + j*ldp;
+
+		for ( i = 0; i + 4 <= mr; i += 4 )
+		{
+			r0 = _mm_mul_ps( xkappa, _mm_loadu_ps( aj + (i+0)*inca ) );
+			r1 = _mm_mul_ps( xkappa, _mm_loadu_ps( aj + (i+1)*inca ) );
+			r2 = _mm_mul_ps( xkappa, _mm_loadu_ps( aj + (i+2)*inca ) );
+			r3 = _mm_mul_ps( xkappa, _mm_loadu_ps( aj + (i+3)*inca ) );
+
+			_MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+			_mm_storeu_ps( pj + 0*ldp + i, r0 );
+			_mm_storeu_ps( pj + 1*ldp + i, r1 );
+			_mm_storeu_ps( pj + 2*ldp + i, r2 );
+			_mm_storeu_ps( pj + 3*ldp + i, r3 );
+		}
+		if ( i < mr )
+		{
+			r0 = _mm_mul_ps( xkappa, _mm_loadu_ps( aj + (i+0)*inca ) );
+			r1 = _mm_mul_ps( xkappa, _mm_loadu_ps( aj + (i+1)*inca ) );
+
+			r2 = _mm_unpacklo_ps( r0, r1 );
+			r3 = _mm_unpackhi_ps( r0, r1 );
+
+			_mm_storel_pi( ( __m64* )( pj + 0*ldp + i ), r2 );
+			_mm_storeh_pi( ( __m64* )( pj + 1*ldp + i ), r2 );
+			_mm_storel_pi( ( __m64* )( pj + 2*ldp + i ), r3 );
+			_mm_storeh_pi( ( __m64* )( pj + 3*ldp + i ), r3 );
+		}
+	}
+
+	// Pack any remaining columns one element at a time.
+	for ( ; j < n; ++j )
+	{
+		for ( i = 0; i < mr; ++i )
+			bli_sscal2s( *kappa, *(a + i*inca + j), *(p + j*ldp + i) );
+	}
+}
+
+
+#undef  SPACKM_OPT_MRXK
+#define SPACKM_OPT_MRXK( mr ) \
+\
+void bli_spackm_opt_ ## mr ## xk( \
+                                  conj_t  conja, \
+                                  dim_t   n, \
+                                  void*   beta, \
+                                  void*   a, inc_t inca, inc_t lda, \
+                                  void*   p,             inc_t ldp  \
+                                ) \
+{ \
+	if      ( inca == 1 ) \
+		bli_spackm_opt_unit( mr, n, beta, a, lda, p, ldp ); \
+	else if ( lda == 1 ) \
+		bli_spackm_opt_trans( mr, n, beta, a, inca, p, ldp ); \
+	else \
+		BLIS_SPACKM_ ## mr ## XK_KERNEL_REF( conja, n, beta, a, inca, lda, p, ldp ); \
+}
+
+SPACKM_OPT_MRXK( 2 )
+SPACKM_OPT_MRXK( 4 )
+SPACKM_OPT_MRXK( 6 )
+SPACKM_OPT_MRXK( 8 )
+SPACKM_OPT_MRXK( 12 )
+SPACKM_OPT_MRXK( 16 )
+
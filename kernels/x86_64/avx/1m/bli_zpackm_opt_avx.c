@@ -0,0 +1,149 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// These kernels pack an mr x k panel of a dcomplex matrix with AVX,
+// applying the requested conjugation and the (complex) scalar kappa.
+// Conjugation flips the sign bit of each imaginary part, and scaling by
+// kappa is done with vaddsubpd, so neither requires scalar code. When
+// inca == 1, each column of the panel is processed two elements (one ymm
+// register) at a time; otherwise each element is moved with an xmm
+// register.
+
+// Multiply each complex element of x by the complex scalar whose real
+// and imaginary parts are broadcast in kr and ki.
+#define ZPACKM_SCALE_YMM( x, kr, ki ) \
+	x = _mm256_addsub_pd( _mm256_mul_pd( x, kr ), \
+	                      _mm256_mul_pd( _mm256_permute_pd( x, 0x5 ), ki ) );
+
+#define ZPACKM_SCALE_XMM( x, kr, ki ) \
+	x = _mm_addsub_pd( _mm_mul_pd( x, kr ), \
+	                   _mm_mul_pd( _mm_permute_pd( x, 0x1 ), ki ) );
+
+static inline void bli_zpackm_opt_unit
+     (
+       conj_t             conja,
+       dim_t              mr,
+       dim_t              n,
+       dcomplex* restrict kappa,
+       dcomplex* restrict a, inc_t lda,
+       dcomplex* restrict p, inc_t ldp
+     )
+{
+	__m256d vkr   = _mm256_broadcast_sd( ( double* )kappa + 0 );
+	__m256d vki   = _mm256_broadcast_sd( ( double* )kappa + 1 );
+	__m256d vconj = _mm256_setzero_pd();
+	__m256d x;
+	bool_t  kappa_is_one = bli_zeq1( *kappa );
+	dim_t   i;
+
+	if ( bli_is_conj( conja ) )
+		vconj = _mm256_set_pd( -0.0, 0.0, -0.0, 0.0 );
+
+	for ( ; n != 0; --n )
+	{
+		for ( i = 0; i < mr; i += 2 )
+		{
+			x = _mm256_xor_pd( vconj, _mm256_loadu_pd( ( double* )( a + i ) ) );
+			if ( !kappa_is_one ) { ZPACKM_SCALE_YMM( x, vkr, vki ); }
+			_mm256_storeu_pd( ( double* )( p + i ), x );
+		}
+
+		a += lda;
+		p += ldp;
+	}
+}
+
+static inline void bli_zpackm_opt_gen
+     (
+       conj_t             conja,
+       dim_t              mr,
+       dim_t              n,
+       dcomplex* restrict kappa,
+       dcomplex* restrict a, inc_t inca, inc_t lda,
+       dcomplex* restrict p,             inc_t ldp
+     )
+{
+	__m128d xkr   = _mm_loaddup_pd( ( double* )kappa + 0 );
+	__m128d xki   = _mm_loaddup_pd( ( double* )kappa + 1 );
+	__m128d xconj = _mm_setzero_pd();
+	__m128d x;
+	bool_t  kappa_is_one = bli_zeq1( *kappa );
+	dim_t   i;
+
+	if ( bli_is_conj( conja ) )
+		xconj = _mm_set_pd( -0.0, 0.0 );
+
+	for ( ; n != 0; --n )
+	{
+		for ( i = 0; i < mr; ++i )
+		{
+			x = _mm_xor_pd( xconj, _mm_loadu_pd( ( double* )( a + i*inca ) ) );
+			if ( !kappa_is_one ) { ZPACKM_SCALE_XMM( x, xkr, xki ); }
+			_mm_storeu_pd( ( double* )( p + i ), x );
+		}
+
+		a += lda;
+		p += ldp;
+	}
+}
+
+
+#undef  ZPACKM_OPT_MRXK
+#define ZPACKM_OPT_MRXK( mr ) \
+\
+void bli_zpackm_opt_ ## mr ## xk( \
+                                  conj_t  conja, \
+                                  dim_t   n, \
+                                  void*   beta, \
+                                  void*   a, inc_t inca, inc_t lda, \
+                                  void*   p,             inc_t ldp  \
+                                ) \
+{ \
+	if ( inca == 1 ) \
+		bli_zpackm_opt_unit( conja, mr, n, beta, a, lda, p, ldp ); \
+	else \
+		bli_zpackm_opt_gen( conja, mr, n, beta, a, inca, lda, p, ldp ); \
+}
+
+ZPACKM_OPT_MRXK( 2 )
+ZPACKM_OPT_MRXK( 4 )
+ZPACKM_OPT_MRXK( 6 )
+ZPACKM_OPT_MRXK( 8 )
+ZPACKM_OPT_MRXK( 12 )
+ZPACKM_OPT_MRXK( 16 )
+
@@ -0,0 +1,210 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h> 
+
+
+// This micro-kernel computes an 8x2 block of C in interleaved complex
+// storage with AVX (no FMA). Each ymm register holds four scomplex
+// elements. For each column j of the micro-tile, the products of a
+// column of A with the real and imaginary parts of b(j) are accumulated
+// separately (four registers per column). Only at the end are the
+// imaginary-part products swapped within each complex pair and merged
+// with vaddsubpd, so the k loop contains no shuffles at all.
+
+// Perform one rank-1 update of the accumulators, then advance a and b.
+#define CGEMM_8X2_RANK1( a, b ) \
+{ \
+	va0 = _mm256_load_ps( a + 0 ); \
+	va4 = _mm256_load_ps( a + 8 ); \
+\
+	vb = _mm256_broadcast_ss( b + 0 ); \
+	vr00 = _mm256_add_ps( vr00, _mm256_mul_ps( va0, vb ) ); \
+	vr40 = _mm256_add_ps( vr40, _mm256_mul_ps( va4, vb ) ); \
+	vb = _mm256_broadcast_ss( b + 1 ); \
+	vi00 = _mm256_add_ps( vi00, _mm256_mul_ps( va0, vb ) ); \
+	vi40 = _mm256_add_ps( vi40, _mm256_mul_ps( va4, vb ) ); \
+	vb = _mm256_broadcast_ss( b + 2 ); \
+	vr01 = _mm256_add_ps( vr01, _mm256_mul_ps( va0, vb ) ); \
+	vr41 = _mm256_add_ps( vr41, _mm256_mul_ps( va4, vb ) ); \
+	vb = _mm256_broadcast_ss( b + 3 ); \
+	vi01 = _mm256_add_ps( vi01, _mm256_mul_ps( va0, vb ) ); \
+	vi41 = _mm256_add_ps( vi41, _mm256_mul_ps( va4, vb ) ); \
+\
+	a += 2 * 8; \
+	b += 2 * 2; \
+}
+
+// Combine the real-part and imaginary-part products into complex
+// products: ( ar*br - ai*bi, ai*br + ar*bi ).
+#define CGEMM_8X2_COMBINE( vr, vi ) \
+	vr = _mm256_addsub_ps( vr, _mm256_permute_ps( vi, 0xB1 ) );
+
+// Multiply each complex element of x by the complex scalar whose real
+// and imaginary parts are broadcast in vsr and vsi.
+#define CGEMM_8X2_SCALE( x, vsr, vsi ) \
+	x = _mm256_addsub_ps( _mm256_mul_ps( x, vsr ), \
+	                      _mm256_mul_ps( _mm256_permute_ps( x, 0xB1 ), vsi ) );
+
+// Update one column of C (rs_c == 1) with the corresponding products.
+#define CGEMM_8X2_UPDATE_COL( cj, vab0, vab4 ) \
+{ \
+	if ( !beta_is_zero ) \
+	{ \
+		vc0 = _mm256_loadu_ps( ( float* )( cj ) + 0 ); \
+		vc4 = _mm256_loadu_ps( ( float* )( cj ) + 8 ); \
+		CGEMM_8X2_SCALE( vc0, vbetar, vbetai ); \
+		CGEMM_8X2_SCALE( vc4, vbetar, vbetai ); \
+		vab0 = _mm256_add_ps( vab0, vc0 ); \
+		vab4 = _mm256_add_ps( vab4, vc4 ); \
+	} \
+	_mm256_storeu_ps( ( float* )( cj ) + 0, vab0 ); \
+	_mm256_storeu_ps( ( float* )( cj ) + 8, vab4 ); \
+}
+
+
+void bli_cgemm_opt_8x2_avx1(
+                        dim_t              k,
+                        scomplex* restrict alpha,
+                        scomplex* restrict a,
+                        scomplex* restrict b,
+                        scomplex* restrict beta,
+                        scomplex* restrict c, inc_t rs_c, inc_t cs_c,
+                        auxinfo_t*         data
+                      )
+{
+	scomplex* a_next = bli_auxinfo_next_a( data );
+	scomplex* b_next = bli_auxinfo_next_b( data );
+
+	float*   ap     = ( float* )a;
+	float*   bp     = ( float* )b;
+
+	dim_t     k_iter = k / 4;
+	dim_t     k_left = k % 4;
+
+	bool_t    beta_is_zero = bli_ceq0( *beta );
+
+	__m256   vr00, vr40, vi00, vi40;
+	__m256   vr01, vr41, vi01, vi41;
+	__m256   va0, va4, vb;
+	__m256   vc0, vc4;
+	__m256   valphar, valphai;
+	__m256   vbetar, vbetai;
+
+	dim_t     i, j;
+
+
+	vr00 = vr40 = vi00 = vi40 = _mm256_setzero_ps();
+	vr01 = vr41 = vi01 = vi41 = _mm256_setzero_ps();
+
+	// Prefetch the micro-tile of C, which is updated at the end.
+	for ( j = 0; j < 2; ++j )
+	{
+		_mm_prefetch( ( char* )( c + j*cs_c + 0*rs_c ), _MM_HINT_T0 );
+		_mm_prefetch( ( char* )( c + j*cs_c + 7*rs_c ), _MM_HINT_T0 );
+	}
+
+	for ( i = 0; i < k_iter; ++i )
+	{
+		// Prefetch the micro-panel of A a few iterations ahead. (The
+		// micro-panel of B is reused across calls and stays in the L1.)
+		_mm_prefetch( ( char* )( ap + 128 ), _MM_HINT_T0 );
+		_mm_prefetch( ( char* )( ap + 144 ), _MM_HINT_T0 );
+		_mm_prefetch( ( char* )( ap + 160 ), _MM_HINT_T0 );
+		_mm_prefetch( ( char* )( ap + 176 ), _MM_HINT_T0 );
+
+		CGEMM_8X2_RANK1( ap, bp );
+		CGEMM_8X2_RANK1( ap, bp );
+		CGEMM_8X2_RANK1( ap, bp );
+		CGEMM_8X2_RANK1( ap, bp );
+	}
+
+	// Prefetch the beginnings of the next micro-panels of A and B into
+	// the L2 while the remaining iterations and the update of C execute.
+	_mm_prefetch( ( char* )( a_next + 0 ), _MM_HINT_T1 );
+	_mm_prefetch( ( char* )( a_next + 8 ), _MM_HINT_T1 );
+	_mm_prefetch( ( char* )( b_next + 0 ), _MM_HINT_T1 );
+	_mm_prefetch( ( char* )( b_next + 8 ), _MM_HINT_T1 );
+
+	for ( i = 0; i < k_left; ++i )
+	{
+		CGEMM_8X2_RANK1( ap, bp );
+	}
+
+	CGEMM_8X2_COMBINE( vr00, vi00 );
+	CGEMM_8X2_COMBINE( vr40, vi40 );
+	CGEMM_8X2_COMBINE( vr01, vi01 );
+	CGEMM_8X2_COMBINE( vr41, vi41 );
+
+	// Scale the products by alpha.
+	valphar = _mm256_broadcast_ss( ( float* )alpha + 0 );
+	valphai = _mm256_broadcast_ss( ( float* )alpha + 1 );
+
+	CGEMM_8X2_SCALE( vr00, valphar, valphai );
+	CGEMM_8X2_SCALE( vr40, valphar, valphai );
+	CGEMM_8X2_SCALE( vr01, valphar, valphai );
+	CGEMM_8X2_SCALE( vr41, valphar, valphai );
+
+	vbetar = _mm256_broadcast_ss( ( float* )beta + 0 );
+	vbetai = _mm256_broadcast_ss( ( float* )beta + 1 );
+
+	if ( rs_c == 1 )
+	{
+		// C is column-stored: update it a column at a time.
+		CGEMM_8X2_UPDATE_COL( ( c + 0*cs_c ), vr00, vr40 );
+		CGEMM_8X2_UPDATE_COL( ( c + 1*cs_c ), vr01, vr41 );
+	}
+	else
+	{
+		// C has general stride: store the scaled products to a temporary
+		// buffer and then update C an element at a time.
+		scomplex ab[ 8 * 2 ] __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+
+		_mm256_store_ps( ( float* )( ab + 0*8 + 0 ), vr00 );
+		_mm256_store_ps( ( float* )( ab + 0*8 + 4 ), vr40 );
+		_mm256_store_ps( ( float* )( ab + 1*8 + 0 ), vr01 );
+		_mm256_store_ps( ( float* )( ab + 1*8 + 4 ), vr41 );
+
+		if ( beta_is_zero )
+		{
+			bli_ccopys_mxn( 8, 2, ab, 1, 8, c, rs_c, cs_c );
+		}
+		else
+		{
+			bli_cxpbys_mxn( 8, 2, ab, 1, 8, beta, c, rs_c, cs_c );
+		}
+	}
+}
+
@@ -0,0 +1,179 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// Edge micro-kernel for bli_dgemm_opt_8x4_ref_u4_nodupl_avx1(). It computes
+// the full 8x4 product in registers (the packed micro-panels are always
+// zero-padded to MR and NR) but updates only the leading m x n part of C.
+// When C is column-stored, the columns are updated with masked loads and
+// stores; otherwise the result is written out element by element.
+
+static const int64_t mask_table[ 8 ] __attribute__((aligned(32))) =
+{
+	-1, -1, -1, -1, 0, 0, 0, 0
+};
+
+void bli_dgemm_edge_opt_8x4_avx1(
+                        dim_t              m,
+                        dim_t              n,
+                        dim_t              k,
+                        double*   restrict alpha,
+                        double*   restrict a,
+                        double*   restrict b,
+                        double*   restrict beta,
+                        double*   restrict c, inc_t rs_c, inc_t cs_c,
+                        auxinfo_t*         data
+                      )
+{
+	double  ab[ 8 * 4 ] __attribute__((aligned(32)));
+
+	__m256d va0_3, va4_7;
+	__m256d vb;
+	__m256d vc0_3_0, vc0_3_1, vc0_3_2, vc0_3_3;
+	__m256d vc4_7_0, vc4_7_1, vc4_7_2, vc4_7_3;
+	__m256d valpha, vbeta;
+	__m256i vmask0_3, vmask4_7;
+
+	dim_t   i, j;
+
+	vc0_3_0 = _mm256_setzero_pd();
+	vc0_3_1 = _mm256_setzero_pd();
+	vc0_3_2 = _mm256_setzero_pd();
+	vc0_3_3 = _mm256_setzero_pd();
+	vc4_7_0 = _mm256_setzero_pd();
+	vc4_7_1 = _mm256_setzero_pd();
+	vc4_7_2 = _mm256_setzero_pd();
+	vc4_7_3 = _mm256_setzero_pd();
+
+	for ( i = 0; i < k; ++i )
+	{
+		va0_3 = _mm256_load_pd( a );
+		va4_7 = _mm256_load_pd( a + 4 );
+
+		vb      = _mm256_broadcast_sd( b + 0 );
+		vc0_3_0 = _mm256_add_pd( vc0_3_0, _mm256_mul_pd( va0_3, vb ) );
+		vc4_7_0 = _mm256_add_pd( vc4_7_0, _mm256_mul_pd( va4_7, vb ) );
+
+		vb      = _mm256_broadcast_sd( b + 1 );
+		vc0_3_1 = _mm256_add_pd( vc0_3_1, _mm256_mul_pd( va0_3, vb ) );
+		vc4_7_1 = _mm256_add_pd( vc4_7_1, _mm256_mul_pd( va4_7, vb ) );
+
+		vb      = _mm256_broadcast_sd( b + 2 );
+		vc0_3_2 = _mm256_add_pd( vc0_3_2, _mm256_mul_pd( va0_3, vb ) );
+		vc4_7_2 = _mm256_add_pd( vc4_7_2, _mm256_mul_pd( va4_7, vb ) );
+
+		vb      = _mm256_broadcast_sd( b + 3 );
+		vc0_3_3 = _mm256_add_pd( vc0_3_3, _mm256_mul_pd( va0_3, vb ) );
+		vc4_7_3 = _mm256_add_pd( vc4_7_3, _mm256_mul_pd( va4_7, vb ) );
+
+		a += 8;
+		b += 4;
+	}
+
+	// Scale the product by alpha.
+	valpha  = _mm256_broadcast_sd( alpha );
+
+	vc0_3_0 = _mm256_mul_pd( valpha, vc0_3_0 );
+	vc0_3_1 = _mm256_mul_pd( valpha, vc0_3_1 );
+	vc0_3_2 = _mm256_mul_pd( valpha, vc0_3_2 );
+	vc0_3_3 = _mm256_mul_pd( valpha, vc0_3_3 );
+	vc4_7_0 = _mm256_mul_pd( valpha, vc4_7_0 );
+	vc4_7_1 = _mm256_mul_pd( valpha, vc4_7_1 );
+	vc4_7_2 = _mm256_mul_pd( valpha, vc4_7_2 );
+	vc4_7_3 = _mm256_mul_pd( valpha, vc4_7_3 );
+
+	if ( rs_c == 1 )
+	{
+		__m256d vcol0_3[ 4 ] = { vc0_3_0, vc0_3_1, vc0_3_2, vc0_3_3 };
+		__m256d vcol4_7[ 4 ] = { vc4_7_0, vc4_7_1, vc4_7_2, vc4_7_3 };
+
+		// Build masks that select the first m rows of each column.
+		vmask0_3 = _mm256_loadu_si256( ( __m256i* )
+		                               ( mask_table + 4 - bli_min( m, 4 ) ) );
+		vmask4_7 = _mm256_loadu_si256( ( __m256i* )
+		                               ( mask_table + 4 - bli_max( m - 4, 0 ) ) );
+
+		vbeta = _mm256_broadcast_sd( beta );
+
+		for ( j = 0; j < n; ++j )
+		{
+			double* restrict cj = c + j*cs_c;
+			__m256d          vt0_3 = vcol0_3[ j ];
+			__m256d          vt4_7 = vcol4_7[ j ];
+
+			// If beta is zero, overwrite C; otherwise, scale by beta.
+			if ( *beta != 0.0 )
+			{
+				vt0_3 = _mm256_add_pd( vt0_3,
+				          _mm256_mul_pd( vbeta,
+				            _mm256_maskload_pd( cj,     vmask0_3 ) ) );
+				vt4_7 = _mm256_add_pd( vt4_7,
+				          _mm256_mul_pd( vbeta,
+				            _mm256_maskload_pd( cj + 4, vmask4_7 ) ) );
+			}
+
+			_mm256_maskstore_pd( cj,     vmask0_3, vt0_3 );
+			_mm256_maskstore_pd( cj + 4, vmask4_7, vt4_7 );
+		}
+	}
+	else
+	{
+		_mm256_store_pd( ab +  0, vc0_3_0 );
+		_mm256_store_pd( ab +  4, vc4_7_0 );
+		_mm256_store_pd( ab +  8, vc0_3_1 );
+		_mm256_store_pd( ab + 12, vc4_7_1 );
+		_mm256_store_pd( ab + 16, vc0_3_2 );
+		_mm256_store_pd( ab + 20, vc4_7_2 );
+		_mm256_store_pd( ab + 24, vc0_3_3 );
+		_mm256_store_pd( ab + 28, vc4_7_3 );
+
+		if ( *beta == 0.0 )
+		{
+			for ( j = 0; j < n; ++j )
+			for ( i = 0; i < m; ++i )
+				c[ i*rs_c + j*cs_c ] = ab[ i + j*8 ];
+		}
+		else
+		{
+			for ( j = 0; j < n; ++j )
+			for ( i = 0; i < m; ++i )
+				c[ i*rs_c + j*cs_c ] = *beta * c[ i*rs_c + j*cs_c ] +
+				                       ab[ i + j*8 ];
+		}
+	}
+}
+
@@ -37,28 +37,6 @@
 
 
 
-void bli_sgemm_opt_8x4_ref_u4_nodupl_avx1(
-                        dim_t              k,
-                        float*    restrict alpha,
-                        float*    restrict a,
-                        float*    restrict b,
-                        float*    restrict beta,
-                        float*    restrict c, inc_t rs_c, inc_t cs_c,
-                        auxinfo_t*         data
-                      )
-{
-	/* Just call the reference implementation. */
-	BLIS_SGEMM_UKERNEL_REF( k,
-	                   alpha,
-	                   a,
-	                   b,
-	                   beta,
-	                   c, rs_c, cs_c,
-	                   data );
-}
-
-
-
 void bli_dgemm_opt_8x4_ref_u4_nodupl_avx1(
                         dim_t              k,
                         double*   restrict alpha,
@@ -0,0 +1,217 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h> 
+
+
+// This micro-kernel fuses the gemm update
+//
+//   b11 = alpha * b11 - a12 * b21
+//
+// with the triangular solve of bli_dtrsm_u_opt_8x4_avx1(). The gemm part
+// accumulates the 8x4 product by rows, one ymm register per row of b11
+// (a row of b21 is loaded and multiplied by broadcasts of a column of a12),
+// which is the layout the solve needs. So b11 never leaves the registers
+// between the two stages.
+
+// Perform one rank-1 update of the row accumulators, then advance a and b.
+#define DGEMMTRSM_8X4_RANK1( a, b ) \
+{ \
+	vb = _mm256_loadu_pd( b ); \
+\
+	vacc0 = _mm256_add_pd( vacc0, _mm256_mul_pd( _mm256_broadcast_sd( a + 0 ), vb ) ); \
+	vacc1 = _mm256_add_pd( vacc1, _mm256_mul_pd( _mm256_broadcast_sd( a + 1 ), vb ) ); \
+	vacc2 = _mm256_add_pd( vacc2, _mm256_mul_pd( _mm256_broadcast_sd( a + 2 ), vb ) ); \
+	vacc3 = _mm256_add_pd( vacc3, _mm256_mul_pd( _mm256_broadcast_sd( a + 3 ), vb ) ); \
+	vacc4 = _mm256_add_pd( vacc4, _mm256_mul_pd( _mm256_broadcast_sd( a + 4 ), vb ) ); \
+	vacc5 = _mm256_add_pd( vacc5, _mm256_mul_pd( _mm256_broadcast_sd( a + 5 ), vb ) ); \
+	vacc6 = _mm256_add_pd( vacc6, _mm256_mul_pd( _mm256_broadcast_sd( a + 6 ), vb ) ); \
+	vacc7 = _mm256_add_pd( vacc7, _mm256_mul_pd( _mm256_broadcast_sd( a + 7 ), vb ) ); \
+\
+	a += 8; \
+	b += 4; \
+}
+
+// Subtract alpha(i,l) * b(l,:) from b(i,:).
+#define DTRSM_8X4_UPDATE( vbi, vbl, i, l ) \
+	vbi = _mm256_sub_pd( vbi, _mm256_mul_pd( _mm256_broadcast_sd( a11 + (i) + (l)*cs_a ), vbl ) );
+
+// Scale b(i,:) by the inverse of alpha(i,i), which packm stores in place
+// of alpha(i,i) so that no division is needed here.
+#define DTRSM_8X4_SCALE( vbi, i ) \
+	vbi = _mm256_mul_pd( vbi, _mm256_broadcast_sd( a11 + (i) + (i)*cs_a ) );
+
+
+void bli_dgemmtrsm_u_opt_8x4_avx1(
+                              dim_t              k,
+                              double* restrict   alpha,
+                              double* restrict   a12,
+                              double* restrict   a11,
+                              double* restrict   b21,
+                              double* restrict   b11,
+                              double* restrict   c11, inc_t rs_c, inc_t cs_c,
+                              auxinfo_t*         data
+                            )
+{
+	const inc_t cs_a = 8;
+	const inc_t rs_b = 4;
+
+	double*     a      = a12;
+	double*     b      = b21;
+
+	dim_t       k_iter = k / 4;
+	dim_t       k_left = k % 4;
+
+	__m256d     vacc0, vacc1, vacc2, vacc3, vacc4, vacc5, vacc6, vacc7;
+	__m256d     vb0, vb1, vb2, vb3, vb4, vb5, vb6, vb7;
+	__m256d     vb, valpha;
+	dim_t       i, j;
+
+
+	vacc0 = vacc1 = vacc2 = vacc3 = _mm256_setzero_pd();
+	vacc4 = vacc5 = vacc6 = vacc7 = _mm256_setzero_pd();
+
+	// Accumulate a12 * b21.
+	for ( i = 0; i < k_iter; ++i )
+	{
+		_mm_prefetch( ( char* )( a + 64 ), _MM_HINT_T0 );
+		_mm_prefetch( ( char* )( a + 72 ), _MM_HINT_T0 );
+
+		DGEMMTRSM_8X4_RANK1( a, b );
+		DGEMMTRSM_8X4_RANK1( a, b );
+		DGEMMTRSM_8X4_RANK1( a, b );
+		DGEMMTRSM_8X4_RANK1( a, b );
+	}
+
+	for ( i = 0; i < k_left; ++i )
+	{
+		DGEMMTRSM_8X4_RANK1( a, b );
+	}
+
+	// b11 = alpha * b11 - a12 * b21;
+	valpha = _mm256_broadcast_sd( alpha );
+
+	vb0 = _mm256_sub_pd( _mm256_mul_pd( valpha, _mm256_loadu_pd( b11 + 0*rs_b ) ), vacc0 );
+	vb1 = _mm256_sub_pd( _mm256_mul_pd( valpha, _mm256_loadu_pd( b11 + 1*rs_b ) ), vacc1 );
+	vb2 = _mm256_sub_pd( _mm256_mul_pd( valpha, _mm256_loadu_pd( b11 + 2*rs_b ) ), vacc2 );
+	vb3 = _mm256_sub_pd( _mm256_mul_pd( valpha, _mm256_loadu_pd( b11 + 3*rs_b ) ), vacc3 );
+	vb4 = _mm256_sub_pd( _mm256_mul_pd( valpha, _mm256_loadu_pd( b11 + 4*rs_b ) ), vacc4 );
+	vb5 = _mm256_sub_pd( _mm256_mul_pd( valpha, _mm256_loadu_pd( b11 + 5*rs_b ) ), vacc5 );
+	vb6 = _mm256_sub_pd( _mm256_mul_pd( valpha, _mm256_loadu_pd( b11 + 6*rs_b ) ), vacc6 );
+	vb7 = _mm256_sub_pd( _mm256_mul_pd( valpha, _mm256_loadu_pd( b11 + 7*rs_b ) ), vacc7 );
+
+	// b11 = inv(a11) * b11, one row at a time.
+
+	// Row 7.
+	DTRSM_8X4_SCALE( vb7, 7 );
+
+	// Row 6.
+	DTRSM_8X4_UPDATE( vb6, vb7, 6, 7 );
+	DTRSM_8X4_SCALE( vb6, 6 );
+
+	// Row 5.
+	DTRSM_8X4_UPDATE( vb5, vb6, 5, 6 );
+	DTRSM_8X4_UPDATE( vb5, vb7, 5, 7 );
+	DTRSM_8X4_SCALE( vb5, 5 );
+
+	// Row 4.
+	DTRSM_8X4_UPDATE( vb4, vb5, 4, 5 );
+	DTRSM_8X4_UPDATE( vb4, vb6, 4, 6 );
+	DTRSM_8X4_UPDATE( vb4, vb7, 4, 7 );
+	DTRSM_8X4_SCALE( vb4, 4 );
+
+	// Row 3.
+	DTRSM_8X4_UPDATE( vb3, vb4, 3, 4 );
+	DTRSM_8X4_UPDATE( vb3, vb5, 3, 5 );
+	DTRSM_8X4_UPDATE( vb3, vb6, 3, 6 );
+	DTRSM_8X4_UPDATE( vb3, vb7, 3, 7 );
+	DTRSM_8X4_SCALE( vb3, 3 );
+
+	// Row 2.
+	DTRSM_8X4_UPDATE( vb2, vb3, 2, 3 );
+	DTRSM_8X4_UPDATE( vb2, vb4, 2, 4 );
+	DTRSM_8X4_UPDATE( vb2, vb5, 2, 5 );
+	DTRSM_8X4_UPDATE( vb2, vb6, 2, 6 );
+	DTRSM_8X4_UPDATE( vb2, vb7, 2, 7 );
+	DTRSM_8X4_SCALE( vb2, 2 );
+
+	// Row 1.
+	DTRSM_8X4_UPDATE( vb1, vb2, 1, 2 );
+	DTRSM_8X4_UPDATE( vb1, vb3, 1, 3 );
+	DTRSM_8X4_UPDATE( vb1, vb4, 1, 4 );
+	DTRSM_8X4_UPDATE( vb1, vb5, 1, 5 );
+	DTRSM_8X4_UPDATE( vb1, vb6, 1, 6 );
+	DTRSM_8X4_UPDATE( vb1, vb7, 1, 7 );
+	DTRSM_8X4_SCALE( vb1, 1 );
+
+	// Row 0.
+	DTRSM_8X4_UPDATE( vb0, vb1, 0, 1 );
+	DTRSM_8X4_UPDATE( vb0, vb2, 0, 2 );
+	DTRSM_8X4_UPDATE( vb0, vb3, 0, 3 );
+	DTRSM_8X4_UPDATE( vb0, vb4, 0, 4 );
+	DTRSM_8X4_UPDATE( vb0, vb5, 0, 5 );
+	DTRSM_8X4_UPDATE( vb0, vb6, 0, 6 );
+	DTRSM_8X4_UPDATE( vb0, vb7, 0, 7 );
+	DTRSM_8X4_SCALE( vb0, 0 );
+
+	// Store the solution back to b11, and then copy it to c11.
+	_mm256_storeu_pd( b11 + 0*rs_b, vb0 );
+	_mm256_storeu_pd( b11 + 1*rs_b, vb1 );
+	_mm256_storeu_pd( b11 + 2*rs_b, vb2 );
+	_mm256_storeu_pd( b11 + 3*rs_b, vb3 );
+	_mm256_storeu_pd( b11 + 4*rs_b, vb4 );
+	_mm256_storeu_pd( b11 + 5*rs_b, vb5 );
+	_mm256_storeu_pd( b11 + 6*rs_b, vb6 );
+	_mm256_storeu_pd( b11 + 7*rs_b, vb7 );
+
+	if ( cs_c == 1 )
+	{
+		_mm256_storeu_pd( c11 + 0*rs_c, vb0 );
+		_mm256_storeu_pd( c11 + 1*rs_c, vb1 );
+		_mm256_storeu_pd( c11 + 2*rs_c, vb2 );
+		_mm256_storeu_pd( c11 + 3*rs_c, vb3 );
+		_mm256_storeu_pd( c11 + 4*rs_c, vb4 );
+		_mm256_storeu_pd( c11 + 5*rs_c, vb5 );
+		_mm256_storeu_pd( c11 + 6*rs_c, vb6 );
+		_mm256_storeu_pd( c11 + 7*rs_c, vb7 );
+	}
+	else
+	{
+		for ( j = 0; j < 4; ++j )
+		for ( i = 0; i < 8; ++i )
+			c11[ i*rs_c + j*cs_c ] = b11[ i*rs_b + j ];
+	}
+}
+
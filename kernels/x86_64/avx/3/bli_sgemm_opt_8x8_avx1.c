@@ -0,0 +1,191 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h> 
+
+
+// This micro-kernel computes an 8x8 block of C with AVX (no FMA). Each
+// column of the 8x8 product is held in one ymm register. Each iteration
+// of the k loop loads one column of the micro-panel of A into a single
+// ymm register and broadcasts each of the eight elements of one row of
+// the micro-panel of B in turn, issuing eight multiplies and eight adds.
+// This keeps both the multiply and add pipes busy every cycle without
+// the shuffles that the 8x4 dgemm kernel needs.
+
+// Perform one rank-1 update of the 8x8 accumulators, then advance a and b.
+#define SGEMM_8X8_RANK1( a, b ) \
+{ \
+	va = _mm256_load_ps( a ); \
+\
+	vb = _mm256_broadcast_ss( b + 0 ); \
+	vc0 = _mm256_add_ps( vc0, _mm256_mul_ps( va, vb ) ); \
+	vb = _mm256_broadcast_ss( b + 1 ); \
+	vc1 = _mm256_add_ps( vc1, _mm256_mul_ps( va, vb ) ); \
+	vb = _mm256_broadcast_ss( b + 2 ); \
+	vc2 = _mm256_add_ps( vc2, _mm256_mul_ps( va, vb ) ); \
+	vb = _mm256_broadcast_ss( b + 3 ); \
+	vc3 = _mm256_add_ps( vc3, _mm256_mul_ps( va, vb ) ); \
+	vb = _mm256_broadcast_ss( b + 4 ); \
+	vc4 = _mm256_add_ps( vc4, _mm256_mul_ps( va, vb ) ); \
+	vb = _mm256_broadcast_ss( b + 5 ); \
+	vc5 = _mm256_add_ps( vc5, _mm256_mul_ps( va, vb ) ); \
+	vb = _mm256_broadcast_ss( b + 6 ); \
+	vc6 = _mm256_add_ps( vc6, _mm256_mul_ps( va, vb ) ); \
+	vb = _mm256_broadcast_ss( b + 7 ); \
+	vc7 = _mm256_add_ps( vc7, _mm256_mul_ps( va, vb ) ); \
+\
+	a += 8; \
+	b += 8; \
+}
+
+// Update one column of C (rs_c == 1) with the corresponding accumulator.
+#define SGEMM_8X8_UPDATE_COL( cj, vab ) \
+{ \
+	vab = _mm256_mul_ps( valpha, vab ); \
+\
+	if ( beta_is_zero ) \
+		_mm256_storeu_ps( cj, vab ); \
+	else \
+		_mm256_storeu_ps( cj, _mm256_add_ps( vab, \
+		                      _mm256_mul_ps( vbeta, _mm256_loadu_ps( cj ) ) ) ); \
+}
+
+
+void bli_sgemm_opt_8x8_avx1(
+                        dim_t              k,
+                        float*    restrict alpha,
+                        float*    restrict a,
+                        float*    restrict b,
+                        float*    restrict beta,
+                        float*    restrict c, inc_t rs_c, inc_t cs_c,
+                        auxinfo_t*         data
+                      )
+{
+	float*   a_next = bli_auxinfo_next_a( data );
+	float*   b_next = bli_auxinfo_next_b( data );
+
+	dim_t    k_iter = k / 4;
+	dim_t    k_left = k % 4;
+
+	bool_t   beta_is_zero = bli_seq0( *beta );
+
+	__m256   vc0, vc1, vc2, vc3, vc4, vc5, vc6, vc7;
+	__m256   va, vb;
+	__m256   valpha, vbeta;
+
+	dim_t    i, j;
+
+
+	vc0 = vc1 = vc2 = vc3 = _mm256_setzero_ps();
+	vc4 = vc5 = vc6 = vc7 = _mm256_setzero_ps();
+
+	// Prefetch the micro-tile of C, which is updated at the end.
+	for ( j = 0; j < 8; ++j )
+	{
+		_mm_prefetch( ( char* )( c + j*cs_c + 0*rs_c ), _MM_HINT_T0 );
+		_mm_prefetch( ( char* )( c + j*cs_c + 7*rs_c ), _MM_HINT_T0 );
+	}
+
+	for ( i = 0; i < k_iter; ++i )
+	{
+		// Prefetch the micro-panel of A a few iterations ahead. (The
+		// micro-panel of B is reused across calls and stays in the L1.)
+		_mm_prefetch( ( char* )( a + 64 ), _MM_HINT_T0 );
+		_mm_prefetch( ( char* )( a + 80 ), _MM_HINT_T0 );
+
+		SGEMM_8X8_RANK1( a, b );
+		SGEMM_8X8_RANK1( a, b );
+		SGEMM_8X8_RANK1( a, b );
+		SGEMM_8X8_RANK1( a, b );
+	}
+
+	// Prefetch the beginnings of the next micro-panels of A and B into
+	// the L2 while the remaining iterations and the update of C execute.
+	_mm_prefetch( ( char* )( a_next +  0 ), _MM_HINT_T1 );
+	_mm_prefetch( ( char* )( a_next + 16 ), _MM_HINT_T1 );
+	_mm_prefetch( ( char* )( b_next +  0 ), _MM_HINT_T1 );
+	_mm_prefetch( ( char* )( b_next + 16 ), _MM_HINT_T1 );
+
+	for ( i = 0; i < k_left; ++i )
+	{
+		SGEMM_8X8_RANK1( a, b );
+	}
+
+	valpha = _mm256_broadcast_ss( alpha );
+	vbeta  = _mm256_broadcast_ss( beta );
+
+	if ( rs_c == 1 )
+	{
+		// C is column-stored: update it a column at a time.
+		SGEMM_8X8_UPDATE_COL( ( c + 0*cs_c ), vc0 );
+		SGEMM_8X8_UPDATE_COL( ( c + 1*cs_c ), vc1 );
+		SGEMM_8X8_UPDATE_COL( ( c + 2*cs_c ), vc2 );
+		SGEMM_8X8_UPDATE_COL( ( c + 3*cs_c ), vc3 );
+		SGEMM_8X8_UPDATE_COL( ( c + 4*cs_c ), vc4 );
+		SGEMM_8X8_UPDATE_COL( ( c + 5*cs_c ), vc5 );
+		SGEMM_8X8_UPDATE_COL( ( c + 6*cs_c ), vc6 );
+		SGEMM_8X8_UPDATE_COL( ( c + 7*cs_c ), vc7 );
+	}
+	else
+	{
+		// C has general stride: store the product to a temporary buffer
+		// and then update C an element at a time.
+		float ab[ 8 * 8 ] __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+
+		_mm256_store_ps( ab + 0*8, vc0 );
+		_mm256_store_ps( ab + 1*8, vc1 );
+		_mm256_store_ps( ab + 2*8, vc2 );
+		_mm256_store_ps( ab + 3*8, vc3 );
+		_mm256_store_ps( ab + 4*8, vc4 );
+		_mm256_store_ps( ab + 5*8, vc5 );
+		_mm256_store_ps( ab + 6*8, vc6 );
+		_mm256_store_ps( ab + 7*8, vc7 );
+
+		if ( beta_is_zero )
+		{
+			for ( j = 0; j < 8; ++j )
+			for ( i = 0; i < 8; ++i )
+				c[ i*rs_c + j*cs_c ] = (*alpha) * ab[ i + j*8 ];
+		}
+		else
+		{
+			for ( j = 0; j < 8; ++j )
+			for ( i = 0; i < 8; ++i )
+				c[ i*rs_c + j*cs_c ] = (*beta) * c[ i*rs_c + j*cs_c ] +
+				                       (*alpha) * ab[ i + j*8 ];
+		}
+	}
+}
+
@@ -0,0 +1,210 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h> 
+
+
+// This micro-kernel computes a 4x2 block of C in interleaved complex
+// storage with AVX (no FMA). Each ymm register holds two dcomplex
+// elements. For each column j of the micro-tile, the products of a
+// column of A with the real and imaginary parts of b(j) are accumulated
+// separately (four registers per column). Only at the end are the
+// imaginary-part products swapped within each complex pair and merged
+// with vaddsubpd, so the k loop contains no shuffles at all.
+
+// Perform one rank-1 update of the accumulators, then advance a and b.
+#define ZGEMM_4X2_RANK1( a, b ) \
+{ \
+	va0 = _mm256_load_pd( a + 0 ); \
+	va2 = _mm256_load_pd( a + 4 ); \
+\
+	vb = _mm256_broadcast_sd( b + 0 ); \
+	vr00 = _mm256_add_pd( vr00, _mm256_mul_pd( va0, vb ) ); \
+	vr20 = _mm256_add_pd( vr20, _mm256_mul_pd( va2, vb ) ); \
+	vb = _mm256_broadcast_sd( b + 1 ); \
+	vi00 = _mm256_add_pd( vi00, _mm256_mul_pd( va0, vb ) ); \
+	vi20 = _mm256_add_pd( vi20, _mm256_mul_pd( va2, vb ) ); \
+	vb = _mm256_broadcast_sd( b + 2 ); \
+	vr01 = _mm256_add_pd( vr01, _mm256_mul_pd( va0, vb ) ); \
+	vr21 = _mm256_add_pd( vr21, _mm256_mul_pd( va2, vb ) ); \
+	vb = _mm256_broadcast_sd( b + 3 ); \
+	vi01 = _mm256_add_pd( vi01, _mm256_mul_pd( va0, vb ) ); \
+	vi21 = _mm256_add_pd( vi21, _mm256_mul_pd( va2, vb ) ); \
+\
+	a += 2 * 4; \
+	b += 2 * 2; \
+}
+
+// Combine the real-part and imaginary-part products into complex
+// products: ( ar*br - ai*bi, ai*br + ar*bi ).
+#define ZGEMM_4X2_COMBINE( vr, vi ) \
+	vr = _mm256_addsub_pd( vr, _mm256_permute_pd( vi, 0x5 ) );
+
+// Multiply each complex element of x by the complex scalar whose real
+// and imaginary parts are broadcast in vsr and vsi.
+#define ZGEMM_4X2_SCALE( x, vsr, vsi ) \
+	x = _mm256_addsub_pd( _mm256_mul_pd( x, vsr ), \
+	                      _mm256_mul_pd( _mm256_permute_pd( x, 0x5 ), vsi ) );
+
+// Update one column of C (rs_c == 1) with the corresponding products.
+#define ZGEMM_4X2_UPDATE_COL( cj, vab0, vab2 ) \
+{ \
+	if ( !beta_is_zero ) \
+	{ \
+		vc0 = _mm256_loadu_pd( ( double* )( cj ) + 0 ); \
+		vc2 = _mm256_loadu_pd( ( double* )( cj ) + 4 ); \
+		ZGEMM_4X2_SCALE( vc0, vbetar, vbetai ); \
+		ZGEMM_4X2_SCALE( vc2, vbetar, vbetai ); \
+		vab0 = _mm256_add_pd( vab0, vc0 ); \
+		vab2 = _mm256_add_pd( vab2, vc2 ); \
+	} \
+	_mm256_storeu_pd( ( double* )( cj ) + 0, vab0 ); \
+	_mm256_storeu_pd( ( double* )( cj ) + 4, vab2 ); \
+}
+
+
+void bli_zgemm_opt_4x2_avx1(
+                        dim_t              k,
+                        dcomplex* restrict alpha,
+                        dcomplex* restrict a,
+                        dcomplex* restrict b,
+                        dcomplex* restrict beta,
+                        dcomplex* restrict c, inc_t rs_c, inc_t cs_c,
+                        auxinfo_t*         data
+                      )
+{
+	dcomplex* a_next = bli_auxinfo_next_a( data );
+	dcomplex* b_next = bli_auxinfo_next_b( data );
+
+	double*   ap     = ( double* )a;
+	double*   bp     = ( double* )b;
+
+	dim_t     k_iter = k / 4;
+	dim_t     k_left = k % 4;
+
+	bool_t    beta_is_zero = bli_zeq0( *beta );
+
+	__m256d   vr00, vr20, vi00, vi20;
+	__m256d   vr01, vr21, vi01, vi21;
+	__m256d   va0, va2, vb;
+	__m256d   vc0, vc2;
+	__m256d   valphar, valphai;
+	__m256d   vbetar, vbetai;
+
+	dim_t     i, j;
+
+
+	vr00 = vr20 = vi00 = vi20 = _mm256_setzero_pd();
+	vr01 = vr21 = vi01 = vi21 = _mm256_setzero_pd();
+
+	// Prefetch the micro-tile of C, which is updated at the end.
+	for ( j = 0; j < 2; ++j )
+	{
+		_mm_prefetch( ( char* )( c + j*cs_c + 0*rs_c ), _MM_HINT_T0 );
+		_mm_prefetch( ( char* )( c + j*cs_c + 3*rs_c ), _MM_HINT_T0 );
+	}
+
+	for ( i = 0; i < k_iter; ++i )
+	{
+		// Prefetch the micro-panel of A a few iterations ahead. (The
+		// micro-panel of B is reused across calls and stays in the L1.)
+		_mm_prefetch( ( char* )( ap + 64 ), _MM_HINT_T0 );
+		_mm_prefetch( ( char* )( ap + 72 ), _MM_HINT_T0 );
+		_mm_prefetch( ( char* )( ap + 80 ), _MM_HINT_T0 );
+		_mm_prefetch( ( char* )( ap + 88 ), _MM_HINT_T0 );
+
+		ZGEMM_4X2_RANK1( ap, bp );
+		ZGEMM_4X2_RANK1( ap, bp );
+		ZGEMM_4X2_RANK1( ap, bp );
+		ZGEMM_4X2_RANK1( ap, bp );
+	}
+
+	// Prefetch the beginnings of the next micro-panels of A and B into
+	// the L2 while the remaining iterations and the update of C execute.
+	_mm_prefetch( ( char* )( a_next + 0 ), _MM_HINT_T1 );
+	_mm_prefetch( ( char* )( a_next + 4 ), _MM_HINT_T1 );
+	_mm_prefetch( ( char* )( b_next + 0 ), _MM_HINT_T1 );
+	_mm_prefetch( ( char* )( b_next + 4 ), _MM_HINT_T1 );
+
+	for ( i = 0; i < k_left; ++i )
+	{
+		ZGEMM_4X2_RANK1( ap, bp );
+	}
+
+	ZGEMM_4X2_COMBINE( vr00, vi00 );
+	ZGEMM_4X2_COMBINE( vr20, vi20 );
+	ZGEMM_4X2_COMBINE( vr01, vi01 );
+	ZGEMM_4X2_COMBINE( vr21, vi21 );
+
+	// Scale the products by alpha.
+	valphar = _mm256_broadcast_sd( ( double* )alpha + 0 );
+	valphai = _mm256_broadcast_sd( ( double* )alpha + 1 );
+
+	ZGEMM_4X2_SCALE( vr00, valphar, valphai );
+	ZGEMM_4X2_SCALE( vr20, valphar, valphai );
+	ZGEMM_4X2_SCALE( vr01, valphar, valphai );
+	ZGEMM_4X2_SCALE( vr21, valphar, valphai );
+
+	vbetar = _mm256_broadcast_sd( ( double* )beta + 0 );
+	vbetai = _mm256_broadcast_sd( ( double* )beta + 1 );
+
+	if ( rs_c == 1 )
+	{
+		// C is column-stored: update it a column at a time.
+		ZGEMM_4X2_UPDATE_COL( ( c + 0*cs_c ), vr00, vr20 );
+		ZGEMM_4X2_UPDATE_COL( ( c + 1*cs_c ), vr01, vr21 );
+	}
+	else
+	{
+		// C has general stride: store the scaled products to a temporary
+		// buffer and then update C an element at a time.
+		dcomplex ab[ 4 * 2 ] __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+
+		_mm256_store_pd( ( double* )( ab + 0*4 + 0 ), vr00 );
+		_mm256_store_pd( ( double* )( ab + 0*4 + 2 ), vr20 );
+		_mm256_store_pd( ( double* )( ab + 1*4 + 0 ), vr01 );
+		_mm256_store_pd( ( double* )( ab + 1*4 + 2 ), vr21 );
+
+		if ( beta_is_zero )
+		{
+			bli_zcopys_mxn( 4, 2, ab, 1, 4, c, rs_c, cs_c );
+		}
+		else
+		{
+			bli_zxpbys_mxn( 4, 2, ab, 1, 4, beta, c, rs_c, cs_c );
+		}
+	}
+}
+
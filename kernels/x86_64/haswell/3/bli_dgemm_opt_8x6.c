@@ -0,0 +1,238 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// This micro-kernel computes an 8x6 block of C with AVX2/FMA. The 8x6
+// product is accumulated in twelve ymm registers (two per column of C).
+// Each iteration of the k loop loads one column of the micro-panel of A
+// into ymm12-ymm13 and broadcasts the six elements of one row of the
+// micro-panel of B, alternating between ymm14 and ymm15, for twelve fused
+// multiply-adds. The k loop is written in inline assembly so that the
+// accumulators never leave the registers; the (comparatively cheap)
+// scaling by alpha and beta and the update of C are written in C.
+
+// Perform the u-th rank-1 update of an unrolled iteration of the k loop.
+#define DGEMM_8X6_RANK1( u ) \
+	"vmovupd       8*(" #u "*8+0)(%%rax), %%ymm12     \n\t" \
+	"vmovupd       8*(" #u "*8+4)(%%rax), %%ymm13     \n\t" \
+	"vbroadcastsd  8*(" #u "*6+0)(%%rbx), %%ymm14     \n\t" \
+	"vbroadcastsd  8*(" #u "*6+1)(%%rbx), %%ymm15     \n\t" \
+	"vfmadd231pd   %%ymm12, %%ymm14, %%ymm0         \n\t" \
+	"vfmadd231pd   %%ymm13, %%ymm14, %%ymm1         \n\t" \
+	"vbroadcastsd  8*(" #u "*6+2)(%%rbx), %%ymm14     \n\t" \
+	"vfmadd231pd   %%ymm12, %%ymm15, %%ymm2         \n\t" \
+	"vfmadd231pd   %%ymm13, %%ymm15, %%ymm3         \n\t" \
+	"vbroadcastsd  8*(" #u "*6+3)(%%rbx), %%ymm15     \n\t" \
+	"vfmadd231pd   %%ymm12, %%ymm14, %%ymm4         \n\t" \
+	"vfmadd231pd   %%ymm13, %%ymm14, %%ymm5         \n\t" \
+	"vbroadcastsd  8*(" #u "*6+4)(%%rbx), %%ymm14     \n\t" \
+	"vfmadd231pd   %%ymm12, %%ymm15, %%ymm6         \n\t" \
+	"vfmadd231pd   %%ymm13, %%ymm15, %%ymm7         \n\t" \
+	"vbroadcastsd  8*(" #u "*6+5)(%%rbx), %%ymm15     \n\t" \
+	"vfmadd231pd   %%ymm12, %%ymm14, %%ymm8         \n\t" \
+	"vfmadd231pd   %%ymm13, %%ymm14, %%ymm9         \n\t" \
+	"vfmadd231pd   %%ymm12, %%ymm15, %%ymm10        \n\t" \
+	"vfmadd231pd   %%ymm13, %%ymm15, %%ymm11        \n\t"
+
+
+void bli_dgemm_opt_8x6(
+                        dim_t              k,
+                        double*   restrict alpha,
+                        double*   restrict a,
+                        double*   restrict b,
+                        double*   restrict beta,
+                        double*   restrict c, inc_t rs_c, inc_t cs_c,
+                        auxinfo_t*         data
+                      )
+{
+	double*   a_next = bli_auxinfo_next_a( data );
+	double*   b_next = bli_auxinfo_next_b( data );
+
+	uint64_t  k_iter = k / 4;
+	uint64_t  k_left = k % 4;
+
+	double    ab[ 8 * 6 ] __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE)));
+	double*   abp    = ab;
+
+	__m256d   alphav, betav;
+	__m256d   ab0, ab4;
+	dim_t     i, j;
+
+
+	// Prefetch the micro-tile of C, which is updated at the end.
+	for ( j = 0; j < 6; ++j )
+	{
+		_mm_prefetch( ( char* )( c + j*cs_c + 0*rs_c ), _MM_HINT_T0 );
+		_mm_prefetch( ( char* )( c + j*cs_c + 7*rs_c ), _MM_HINT_T0 );
+	}
+
+	__asm__ volatile
+	(
+	"vxorpd        %%ymm0,  %%ymm0,  %%ymm0         \n\t"
+	"vxorpd        %%ymm1,  %%ymm1,  %%ymm1         \n\t"
+	"vxorpd        %%ymm2,  %%ymm2,  %%ymm2         \n\t"
+	"vxorpd        %%ymm3,  %%ymm3,  %%ymm3         \n\t"
+	"vxorpd        %%ymm4,  %%ymm4,  %%ymm4         \n\t"
+	"vxorpd        %%ymm5,  %%ymm5,  %%ymm5         \n\t"
+	"vxorpd        %%ymm6,  %%ymm6,  %%ymm6         \n\t"
+	"vxorpd        %%ymm7,  %%ymm7,  %%ymm7         \n\t"
+	"vxorpd        %%ymm8,  %%ymm8,  %%ymm8         \n\t"
+	"vxorpd        %%ymm9,  %%ymm9,  %%ymm9         \n\t"
+	"vxorpd        %%ymm10, %%ymm10, %%ymm10        \n\t"
+	"vxorpd        %%ymm11, %%ymm11, %%ymm11        \n\t"
+	"                                               \n\t"
+	"movq          %[a], %%rax                      \n\t"
+	"movq          %[b], %%rbx                      \n\t"
+	"                                               \n\t"
+	"movq          %[k_iter], %%rsi                 \n\t" // Unrolled iterations.
+	"testq         %%rsi, %%rsi                     \n\t"
+	"je            2f                               \n\t"
+	"                                               \n\t"
+	"1:                                             \n\t"
+	"prefetcht0    8*64(%%rax)                      \n\t" // Prefetch A two
+	"prefetcht0    8*72(%%rax)                      \n\t" // iterations ahead.
+	"prefetcht0    8*80(%%rax)                      \n\t"
+	"prefetcht0    8*88(%%rax)                      \n\t"
+	"                                               \n\t"
+	DGEMM_8X6_RANK1( 0 )
+	DGEMM_8X6_RANK1( 1 )
+	DGEMM_8X6_RANK1( 2 )
+	DGEMM_8X6_RANK1( 3 )
+	"                                               \n\t"
+	"addq          $8*4*8, %%rax                    \n\t"
+	"addq          $8*4*6, %%rbx                    \n\t"
+	"decq          %%rsi                            \n\t"
+	"jne           1b                               \n\t"
+	"                                               \n\t"
+	"2:                                             \n\t"
+	"movq          %[a_next], %%rcx                 \n\t" // Prefetch the next
+	"movq          %[b_next], %%rdx                 \n\t" // micro-panels of A
+	"prefetcht1    0*64(%%rcx)                      \n\t" // and B into the L2.
+	"prefetcht1    1*64(%%rcx)                      \n\t"
+	"prefetcht1    0*64(%%rdx)                      \n\t"
+	"prefetcht1    1*64(%%rdx)                      \n\t"
+	"                                               \n\t"
+	"movq          %[k_left], %%rsi                 \n\t" // Leftover iterations.
+	"testq         %%rsi, %%rsi                     \n\t"
+	"je            4f                               \n\t"
+	"                                               \n\t"
+	"3:                                             \n\t"
+	DGEMM_8X6_RANK1( 0 )
+	"                                               \n\t"
+	"addq          $8*8, %%rax                      \n\t"
+	"addq          $8*6, %%rbx                      \n\t"
+	"decq          %%rsi                            \n\t"
+	"jne           3b                               \n\t"
+	"                                               \n\t"
+	"4:                                             \n\t"
+	"movq          %[ab], %%rcx                     \n\t" // Store the
+	"vmovapd       %%ymm0,  0*32(%%rcx)             \n\t" // accumulators.
+	"vmovapd       %%ymm1,  1*32(%%rcx)             \n\t"
+	"vmovapd       %%ymm2,  2*32(%%rcx)             \n\t"
+	"vmovapd       %%ymm3,  3*32(%%rcx)             \n\t"
+	"vmovapd       %%ymm4,  4*32(%%rcx)             \n\t"
+	"vmovapd       %%ymm5,  5*32(%%rcx)             \n\t"
+	"vmovapd       %%ymm6,  6*32(%%rcx)             \n\t"
+	"vmovapd       %%ymm7,  7*32(%%rcx)             \n\t"
+	"vmovapd       %%ymm8,  8*32(%%rcx)             \n\t"
+	"vmovapd       %%ymm9,  9*32(%%rcx)             \n\t"
+	"vmovapd       %%ymm10, 10*32(%%rcx)            \n\t"
+	"vmovapd       %%ymm11, 11*32(%%rcx)            \n\t"
+	"vzeroupper                                     \n\t"
+
+	: // output operands (none)
+	: // input operands
+	  [k_iter] "m" (k_iter),
+	  [k_left] "m" (k_left),
+	  [a]      "m" (a),
+	  [b]      "m" (b),
+	  [a_next] "m" (a_next),
+	  [b_next] "m" (b_next),
+	  [ab]     "m" (abp)
+	: // register clobber list
+	  "rax", "rbx", "rcx", "rdx", "rsi",
+	  "xmm0", "xmm1", "xmm2", "xmm3",
+	  "xmm4", "xmm5", "xmm6", "xmm7",
+	  "xmm8", "xmm9", "xmm10", "xmm11",
+	  "xmm12", "xmm13", "xmm14", "xmm15",
+	  "memory"
+	);
+
+	alphav = _mm256_broadcast_sd( alpha );
+	betav  = _mm256_broadcast_sd( beta );
+
+	if ( rs_c == 1 )
+	{
+		// C is column-stored: update it a column at a time.
+		for ( j = 0; j < 6; ++j )
+		{
+			double* restrict cj = c + j*cs_c;
+
+			ab0 = _mm256_mul_pd( alphav, _mm256_load_pd( ab + j*8 + 0 ) );
+			ab4 = _mm256_mul_pd( alphav, _mm256_load_pd( ab + j*8 + 4 ) );
+
+			if ( bli_deq0( *beta ) )
+			{
+				_mm256_storeu_pd( cj + 0, ab0 );
+				_mm256_storeu_pd( cj + 4, ab4 );
+			}
+			else
+			{
+				_mm256_storeu_pd( cj + 0, _mm256_fmadd_pd( _mm256_loadu_pd( cj + 0 ), betav, ab0 ) );
+				_mm256_storeu_pd( cj + 4, _mm256_fmadd_pd( _mm256_loadu_pd( cj + 4 ), betav, ab4 ) );
+			}
+		}
+	}
+	else
+	{
+		// C has general stride: update it an element at a time.
+		if ( bli_deq0( *beta ) )
+		{
+			for ( j = 0; j < 6; ++j )
+			for ( i = 0; i < 8; ++i )
+				c[ i*rs_c + j*cs_c ] = (*alpha) * ab[ i + j*8 ];
+		}
+		else
+		{
+			for ( j = 0; j < 6; ++j )
+			for ( i = 0; i < 8; ++i )
+				c[ i*rs_c + j*cs_c ] = (*beta) * c[ i*rs_c + j*cs_c ] +
+				                       (*alpha) * ab[ i + j*8 ];
+		}
+	}
+}
+
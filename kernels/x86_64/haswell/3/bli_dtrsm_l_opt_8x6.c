@@ -0,0 +1,196 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include <immintrin.h>
+
+
+// This micro-kernel solves L * X = B for an 8x6 block X, where L is
+// the 8x8 lower triangular block a11 (packed by columns with an inverted
+// diagonal) and B is the 8x6 block b11 (packed by rows). Each row of b11
+// is held in a ymm register (columns 0-3) and an xmm register (columns
+// 4-5), so the forward substitution keeps all of B in registers and
+// uses fused negative multiply-adds for the updates.
+
+// Subtract alpha(i,l) * b(l,:) from b(i,:), where row i of b is held in a
+// ymm register (columns 0-3) and an xmm register (columns 4-5).
+#define DTRSM_8X6_UPDATE( i, l ) \
+{ \
+	va  = _mm256_broadcast_sd( a11 + (i) + (l)*cs_a ); \
+	vb ## i = _mm256_fnmadd_pd( va, vb ## l, vb ## i ); \
+	vx ## i = _mm_fnmadd_pd( _mm256_castpd256_pd128( va ), vx ## l, vx ## i ); \
+}
+
+// Scale b(i,:) by the inverse of alpha(i,i), which packm stores in place
+// of alpha(i,i) so that no division is needed here.
+#define DTRSM_8X6_SCALE( i ) \
+{ \
+	va  = _mm256_broadcast_sd( a11 + (i) + (i)*cs_a ); \
+	vb ## i = _mm256_mul_pd( va, vb ## i ); \
+	vx ## i = _mm_mul_pd( _mm256_castpd256_pd128( va ), vx ## i ); \
+}
+
+
+void bli_dtrsm_l_opt_8x6(
+                          double* restrict   a11,
+                          double* restrict   b11,
+                          double* restrict   c11, inc_t rs_c, inc_t cs_c,
+                          auxinfo_t*         data
+                        )
+{
+	const inc_t cs_a = 8;
+	const inc_t rs_b = 6;
+
+	__m256d     vb0, vb1, vb2, vb3, vb4, vb5, vb6, vb7;
+	__m128d     vx0, vx1, vx2, vx3, vx4, vx5, vx6, vx7;
+	__m256d     va;
+	dim_t       i, j;
+
+
+	vb0 = _mm256_loadu_pd( b11 + 0*rs_b + 0 );
+	vx0 = _mm_loadu_pd( b11 + 0*rs_b + 4 );
+	vb1 = _mm256_loadu_pd( b11 + 1*rs_b + 0 );
+	vx1 = _mm_loadu_pd( b11 + 1*rs_b + 4 );
+	vb2 = _mm256_loadu_pd( b11 + 2*rs_b + 0 );
+	vx2 = _mm_loadu_pd( b11 + 2*rs_b + 4 );
+	vb3 = _mm256_loadu_pd( b11 + 3*rs_b + 0 );
+	vx3 = _mm_loadu_pd( b11 + 3*rs_b + 4 );
+	vb4 = _mm256_loadu_pd( b11 + 4*rs_b + 0 );
+	vx4 = _mm_loadu_pd( b11 + 4*rs_b + 4 );
+	vb5 = _mm256_loadu_pd( b11 + 5*rs_b + 0 );
+	vx5 = _mm_loadu_pd( b11 + 5*rs_b + 4 );
+	vb6 = _mm256_loadu_pd( b11 + 6*rs_b + 0 );
+	vx6 = _mm_loadu_pd( b11 + 6*rs_b + 4 );
+	vb7 = _mm256_loadu_pd( b11 + 7*rs_b + 0 );
+	vx7 = _mm_loadu_pd( b11 + 7*rs_b + 4 );
+
+	// b1 = ( b1 - a10t * B0 ) / alpha11, one row at a time.
+
+	// Row 0.
+	DTRSM_8X6_SCALE( 0 );
+
+	// Row 1.
+	DTRSM_8X6_UPDATE( 1, 0 );
+	DTRSM_8X6_SCALE( 1 );
+
+	// Row 2.
+	DTRSM_8X6_UPDATE( 2, 0 );
+	DTRSM_8X6_UPDATE( 2, 1 );
+	DTRSM_8X6_SCALE( 2 );
+
+	// Row 3.
+	DTRSM_8X6_UPDATE( 3, 0 );
+	DTRSM_8X6_UPDATE( 3, 1 );
+	DTRSM_8X6_UPDATE( 3, 2 );
+	DTRSM_8X6_SCALE( 3 );
+
+	// Row 4.
+	DTRSM_8X6_UPDATE( 4, 0 );
+	DTRSM_8X6_UPDATE( 4, 1 );
+	DTRSM_8X6_UPDATE( 4, 2 );
+	DTRSM_8X6_UPDATE( 4, 3 );
+	DTRSM_8X6_SCALE( 4 );
+
+	// Row 5.
+	DTRSM_8X6_UPDATE( 5, 0 );
+	DTRSM_8X6_UPDATE( 5, 1 );
+	DTRSM_8X6_UPDATE( 5, 2 );
+	DTRSM_8X6_UPDATE( 5, 3 );
+	DTRSM_8X6_UPDATE( 5, 4 );
+	DTRSM_8X6_SCALE( 5 );
+
+	// Row 6.
+	DTRSM_8X6_UPDATE( 6, 0 );
+	DTRSM_8X6_UPDATE( 6, 1 );
+	DTRSM_8X6_UPDATE( 6, 2 );
+	DTRSM_8X6_UPDATE( 6, 3 );
+	DTRSM_8X6_UPDATE( 6, 4 );
+	DTRSM_8X6_UPDATE( 6, 5 );
+	DTRSM_8X6_SCALE( 6 );
+
+	// Row 7.
+	DTRSM_8X6_UPDATE( 7, 0 );
+	DTRSM_8X6_UPDATE( 7, 1 );
+	DTRSM_8X6_UPDATE( 7, 2 );
+	DTRSM_8X6_UPDATE( 7, 3 );
+	DTRSM_8X6_UPDATE( 7, 4 );
+	DTRSM_8X6_UPDATE( 7, 5 );
+	DTRSM_8X6_UPDATE( 7, 6 );
+	DTRSM_8X6_SCALE( 7 );
+
+	// Store the solution back to b11, and then copy it to c11.
+	_mm256_storeu_pd( b11 + 0*rs_b + 0, vb0 );
+	_mm_storeu_pd( b11 + 0*rs_b + 4, vx0 );
+	_mm256_storeu_pd( b11 + 1*rs_b + 0, vb1 );
+	_mm_storeu_pd( b11 + 1*rs_b + 4, vx1 );
+	_mm256_storeu_pd( b11 + 2*rs_b + 0, vb2 );
+	_mm_storeu_pd( b11 + 2*rs_b + 4, vx2 );
+	_mm256_storeu_pd( b11 + 3*rs_b + 0, vb3 );
+	_mm_storeu_pd( b11 + 3*rs_b + 4, vx3 );
+	_mm256_storeu_pd( b11 + 4*rs_b + 0, vb4 );
+	_mm_storeu_pd( b11 + 4*rs_b + 4, vx4 );
+	_mm256_storeu_pd( b11 + 5*rs_b + 0, vb5 );
+	_mm_storeu_pd( b11 + 5*rs_b + 4, vx5 );
+	_mm256_storeu_pd( b11 + 6*rs_b + 0, vb6 );
+	_mm_storeu_pd( b11 + 6*rs_b + 4, vx6 );
+	_mm256_storeu_pd( b11 + 7*rs_b + 0, vb7 );
+	_mm_storeu_pd( b11 + 7*rs_b + 4, vx7 );
+
+	if ( cs_c == 1 )
+	{
+		_mm256_storeu_pd( c11 + 0*rs_c + 0, vb0 );
+		_mm_storeu_pd( c11 + 0*rs_c + 4, vx0 );
+		_mm256_storeu_pd( c11 + 1*rs_c + 0, vb1 );
+		_mm_storeu_pd( c11 + 1*rs_c + 4, vx1 );
+		_mm256_storeu_pd( c11 + 2*rs_c + 0, vb2 );
+		_mm_storeu_pd( c11 + 2*rs_c + 4, vx2 );
+		_mm256_storeu_pd( c11 + 3*rs_c + 0, vb3 );
+		_mm_storeu_pd( c11 + 3*rs_c + 4, vx3 );
+		_mm256_storeu_pd( c11 + 4*rs_c + 0, vb4 );
+		_mm_storeu_pd( c11 + 4*rs_c + 4, vx4 );
+		_mm256_storeu_pd( c11 + 5*rs_c + 0, vb5 );
+		_mm_storeu_pd( c11 + 5*rs_c + 4, vx5 );
+		_mm256_storeu_pd( c11 + 6*rs_c + 0, vb6 );
+		_mm_storeu_pd( c11 + 6*rs_c + 4, vx6 );
+		_mm256_storeu_pd( c11 + 7*rs_c + 0, vb7 );
+		_mm_storeu_pd( c11 + 7*rs_c + 4, vx7 );
+	}
+	else
+	{
+		for ( j = 0; j < 6; ++j )
+		for ( i = 0; i < 8; ++i )
+			c11[ i*rs_c + j*cs_c ] = b11[ i*rs_b + j ];
+	}
+}
+
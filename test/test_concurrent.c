@@ -0,0 +1,248 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include <pthread.h>
+#include "blis.h"
+
+// This driver checks that independent application threads may call BLIS
+// concurrently. A set of problems is first solved serially to obtain
+// reference results. Then several application threads repeatedly solve
+// those same problems at the same time, each into its own output matrix,
+// and every result is compared against its reference. The input operands
+// are shared among the application threads (and are only read).
+
+#define N_APP_THREADS  8
+#define N_CALLS        500
+#define N_PROBS        16
+
+typedef enum
+{
+	OP_GEMM = 0,
+	OP_HERK,
+	OP_TRMM,
+	OP_TRSM,
+	N_OPS
+} op_t;
+
+static char* op_names[ N_OPS ] = { "gemm", "herk", "trmm", "trsm" };
+
+typedef struct
+{
+	op_t   op;
+	side_t side;
+	obj_t  alpha, beta;
+	obj_t  a, b;
+	obj_t  c_orig;
+	obj_t  c_ref;
+} prob_t;
+
+static prob_t probs[ N_PROBS ];
+
+static volatile int n_fails = 0;
+
+static void prob_run( prob_t* pr, obj_t* c )
+{
+	bli_copym( &pr->c_orig, c );
+
+	switch ( pr->op )
+	{
+		case OP_GEMM:
+		bli_gemm( &pr->alpha, &pr->a, &pr->b, &pr->beta, c );
+		break;
+
+		case OP_HERK:
+		bli_herk( &pr->alpha, &pr->a, &pr->beta, c );
+		break;
+
+		case OP_TRMM:
+		bli_trmm( pr->side, &pr->alpha, &pr->a, c );
+		break;
+
+		case OP_TRSM:
+		bli_trsm( pr->side, &pr->alpha, &pr->a, c );
+		break;
+
+		default:
+		break;
+	}
+}
+
+static void prob_create( dim_t i, prob_t* pr )
+{
+	num_t dt = ( i % 2 == 0 ? BLIS_DOUBLE : BLIS_DCOMPLEX );
+	dim_t m  = 17 + 23 * ( i % 5 );
+	dim_t n  = 29 + 19 * ( i % 4 );
+	dim_t k  = 13 + 31 * ( i % 3 );
+	dim_t mn;
+	obj_t diag;
+
+	pr->op   = ( op_t )( i % N_OPS );
+	pr->side = ( ( i / N_OPS ) % 2 == 0 ? BLIS_LEFT : BLIS_RIGHT );
+
+	bli_obj_scalar_init_detached( dt, &pr->alpha );
+	bli_obj_scalar_init_detached( dt, &pr->beta );
+	bli_setsc(  0.9, 0.0, &pr->alpha );
+	bli_setsc( -1.1, 0.0, &pr->beta );
+
+	switch ( pr->op )
+	{
+		case OP_GEMM:
+		bli_obj_create( dt, m, k, 0, 0, &pr->a );
+		bli_obj_create( dt, k, n, 0, 0, &pr->b );
+		bli_obj_create( dt, m, n, 0, 0, &pr->c_orig );
+		bli_randm( &pr->a );
+		bli_randm( &pr->b );
+		break;
+
+		case OP_HERK:
+		bli_obj_create( dt, m, k, 0, 0, &pr->a );
+		bli_obj_create( dt, m, m, 0, 0, &pr->c_orig );
+		bli_obj_set_struc( BLIS_HERMITIAN, pr->c_orig );
+		bli_obj_set_uplo( ( i / N_OPS ) % 2 == 0 ? BLIS_LOWER : BLIS_UPPER,
+		                  pr->c_orig );
+		bli_randm( &pr->a );
+		break;
+
+		case OP_TRMM:
+		case OP_TRSM:
+		mn = ( bli_is_left( pr->side ) ? m : n );
+		bli_obj_create( dt, mn, mn, 0, 0, &pr->a );
+		bli_obj_create( dt, m,  n,  0, 0, &pr->c_orig );
+		bli_obj_set_struc( BLIS_TRIANGULAR, pr->a );
+		bli_obj_set_uplo( ( i / ( 2 * N_OPS ) ) % 2 == 0 ? BLIS_LOWER : BLIS_UPPER,
+		                  pr->a );
+		bli_randm( &pr->a );
+		bli_mktrim( &pr->a );
+
+		// Make A diagonally dominant so that trsm is well-conditioned.
+		bli_obj_scalar_init_detached( dt, &diag );
+		bli_setsc( ( double )mn, 0.0, &diag );
+		bli_setd( &diag, &pr->a );
+		break;
+
+		default:
+		break;
+	}
+
+	bli_randm( &pr->c_orig );
+
+	bli_obj_create( dt, bli_obj_length( pr->c_orig ),
+	                    bli_obj_width( pr->c_orig ), 0, 0, &pr->c_ref );
+	bli_obj_set_struc( bli_obj_struc( pr->c_orig ), pr->c_ref );
+	bli_obj_set_uplo( bli_obj_uplo( pr->c_orig ), pr->c_ref );
+
+	prob_run( pr, &pr->c_ref );
+}
+
+static void prob_free( prob_t* pr )
+{
+	bli_obj_free( &pr->a );
+	if ( pr->op == OP_GEMM ) bli_obj_free( &pr->b );
+	bli_obj_free( &pr->c_orig );
+	bli_obj_free( &pr->c_ref );
+}
+
+static void* app_thread_entry( void* arg )
+{
+	dim_t   id = ( dim_t )( size_t )arg;
+	dim_t   i;
+	prob_t* pr;
+	obj_t   c;
+	obj_t   norm;
+	double  resid, junk;
+
+	for ( i = 0; i < N_CALLS; ++i )
+	{
+		// Visit the problems in a different order in each thread so that
+		// different operations overlap with one another.
+		pr = &probs[ ( id * 7 + i ) % N_PROBS ];
+
+		bli_obj_create( bli_obj_datatype( pr->c_ref ),
+		                bli_obj_length( pr->c_ref ),
+		                bli_obj_width( pr->c_ref ), 0, 0, &c );
+		bli_obj_set_struc( bli_obj_struc( pr->c_ref ), c );
+		bli_obj_set_uplo( bli_obj_uplo( pr->c_ref ), c );
+		bli_obj_scalar_init_detached( bli_obj_datatype_proj_to_real( c ), &norm );
+
+		prob_run( pr, &c );
+
+		// Compare against the reference result. Each call performs the same
+		// arithmetic in the same order, so the difference should be zero
+		// (only the stored triangle is compared for herk).
+		bli_subm( &pr->c_ref, &c );
+		bli_normfm( &c, &norm );
+		bli_getsc( &norm, &resid, &junk );
+
+		if ( resid > 1.0e-10 || resid != resid )
+		{
+			__sync_fetch_and_add( &n_fails, 1 );
+			printf( "thread %2lu call %4lu: %s residual %10.3e\n",
+			        ( unsigned long )id, ( unsigned long )i,
+			        op_names[ pr->op ], resid );
+		}
+
+		bli_obj_free( &c );
+	}
+
+	return NULL;
+}
+
+int main( int argc, char** argv )
+{
+	pthread_t threads[ N_APP_THREADS ];
+	dim_t     i;
+
+	bli_init();
+
+	// Compute the reference results serially.
+	for ( i = 0; i < N_PROBS; ++i )
+		prob_create( i, &probs[i] );
+
+	for ( i = 0; i < N_APP_THREADS; ++i )
+		pthread_create( &threads[i], NULL, app_thread_entry, ( void* )( size_t )i );
+
+	for ( i = 0; i < N_APP_THREADS; ++i )
+		pthread_join( threads[i], NULL );
+
+	printf( "%d application threads, %d calls each: %d failures\n",
+	        N_APP_THREADS, N_CALLS, n_fails );
+
+	for ( i = 0; i < N_PROBS; ++i )
+		prob_free( &probs[i] );
+
+	bli_finalize();
+
+	return ( n_fails == 0 ? 0 : 1 );
+}
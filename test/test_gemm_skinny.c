@@ -0,0 +1,198 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver compares the two gemm control trees that may be used when
+// B is skinny: the default tree, which packs B to a contiguous panel, and
+// the tree that packs only A and streams micro-panels of B from their
+// original storage (bli_gemm_ker_var5()). For each n, the performance of
+// both trees is reported, along with the crossover: the largest n up to
+// which streaming B was faster for every n tested. That value is a good
+// choice for BLIS_GEMM_STREAM_B_N_THRESH on the machine being tested.
+// The results of the two trees are also compared, and any mismatch is
+// reported and reflected in the exit status.
+
+extern gemm_t* gemm_cntl;
+extern gemm_t* gemm_cntl5;
+
+int main( int argc, char** argv )
+{
+	obj_t   a, b, c;
+	obj_t   c_save;
+	obj_t   c_packb;
+	obj_t   alpha, beta;
+	obj_t   norm;
+	dim_t   m, n, k;
+	dim_t   n_begin, n_end, n_inc;
+	dim_t   n_cross;
+	bool_t  crossed;
+	int     n_fails;
+	num_t   dt;
+	int     r, n_repeats;
+	int     i;
+
+	gemm_t  cntl_packb;
+	gemm_t* cntls[ 2 ];
+	double  gflops[ 2 ];
+
+	double  dtime;
+	double  dtime_save;
+	double  resid, junk;
+
+	bli_init();
+
+	n_repeats = 10;
+
+	m = 2000;
+	k = 2000;
+
+	n_begin = 1;
+	n_end   = 32;
+	n_inc   = 1;
+
+	dt = BLIS_DOUBLE;
+
+	// Passing a copy of the default control tree to bli_gemm_front()
+	// bypasses its selection of the streaming tree, so the copy always
+	// packs B.
+	cntl_packb = *gemm_cntl;
+
+	cntls[ 0 ] = &cntl_packb;
+	cntls[ 1 ] = gemm_cntl5;
+
+	n_cross = 0;
+	crossed = FALSE;
+	n_fails = 0;
+
+	for ( n = n_begin; n <= n_end; n += n_inc )
+	{
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_save );
+		bli_obj_create( dt, m, n, 0, 0, &c_packb );
+
+		bli_obj_scalar_init_detached( bli_obj_datatype_proj_to_real( c ), &norm );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+
+		bli_setsc(  (0.9/1.0), 0.2, &alpha );
+		bli_setsc( -(1.1/1.0), 0.3, &beta );
+
+		bli_copym( &c, &c_save );
+
+		for ( i = 0; i < 2; ++i )
+		{
+			dtime_save = 1.0e9;
+
+			for ( r = 0; r < n_repeats; ++r )
+			{
+				bli_copym( &c_save, &c );
+
+				dtime = bli_clock();
+
+				bli_gemm_front( &alpha,
+				                &a,
+				                &b,
+				                &beta,
+				                &c,
+				                cntls[ i ] );
+
+				dtime_save = bli_clock_min_diff( dtime_save, dtime );
+
+				// After the first repetition, save the result of the tree
+				// that packs B, and compare the result of the streaming
+				// tree against it. Both trees partition the k dimension
+				// the same way and use the same micro-kernel, so the
+				// difference should be zero.
+				if ( r == 0 && i == 0 )
+				{
+					bli_copym( &c, &c_packb );
+				}
+				else if ( r == 0 && i == 1 )
+				{
+					bli_subm( &c, &c_packb );
+					bli_normfm( &c_packb, &norm );
+					bli_getsc( &norm, &resid, &junk );
+
+					if ( resid > 1.0e-10 || resid != resid )
+					{
+						++n_fails;
+						printf( "%% n = %4lu: results differ, residual %10.3e\n",
+						        ( unsigned long )n, resid );
+					}
+				}
+			}
+
+			gflops[ i ] = ( 2.0 * m * k * n ) / ( dtime_save * 1.0e9 );
+
+			if ( bli_is_complex( dt ) ) gflops[ i ] *= 4.0;
+		}
+
+		if ( gflops[ 1 ] <= gflops[ 0 ] ) crossed = TRUE;
+		if ( !crossed ) n_cross = n;
+
+		printf( "data_gemm_skinny_blis" );
+		printf( "( %2lu, 1:5 ) = [ %4lu %4lu %4lu  %6.3f  %6.3f ];\n",
+		        ( unsigned long )(n - n_begin)/n_inc + 1,
+		        ( unsigned long )m,
+		        ( unsigned long )k,
+		        ( unsigned long )n, gflops[ 0 ], gflops[ 1 ] );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_save );
+		bli_obj_free( &c_packb );
+	}
+
+	printf( "%% crossover (streaming B faster for all n <= %lu)\n",
+	        ( unsigned long )n_cross );
+	printf( "%% %d mismatches\n", n_fails );
+
+	bli_finalize();
+
+	return ( n_fails == 0 ? 0 : 1 );
+}
+
@@ -0,0 +1,377 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+#include "test_libblis.h"
+
+
+// Static variables.
+static char*     op_str                    = "gemm_fast";
+static char*     o_types                   = "mmm"; // a b c
+static char*     p_types                   = "hh";  // transa transb
+static thresh_t  thresh[BLIS_NUM_FP_TYPES] = { { 1e-04, 1e-05 },   // warn, pass for s
+                                               { 1e-04, 1e-05 },   // warn, pass for c
+                                               { 1e-13, 1e-14 },   // warn, pass for d
+                                               { 1e-13, 1e-14 } }; // warn, pass for z
+
+// The storage schemes (for a, b, and c) that are tested regardless of
+// those requested in input.general, since the fast interface handles
+// row-stored, column-stored, and general-stride operands differently.
+static char*     sc_strs[]                 = { "ccc", "rrr", "ggg", "crg" };
+static dim_t     n_sc_strs                 = 4;
+
+// Local prototypes.
+void libblis_test_gemm_fast_deps( test_params_t* params,
+                                  test_op_t*     op );
+
+void libblis_test_gemm_fast_experiment( test_params_t* params,
+                                        test_op_t*     op,
+                                        iface_t        iface,
+                                        num_t          datatype,
+                                        char*          pc_str,
+                                        char*          sc_str,
+                                        unsigned int   p_cur,
+                                        double*        perf,
+                                        double*        resid );
+
+void libblis_test_gemm_fast_impl( iface_t   iface,
+                                  trans_t   transa,
+                                  trans_t   transb,
+                                  dim_t     m,
+                                  dim_t     n,
+                                  dim_t     k,
+                                  obj_t*    alpha,
+                                  obj_t*    a,
+                                  obj_t*    b,
+                                  obj_t*    beta,
+                                  obj_t*    c );
+
+void libblis_test_gemm_fast_check( obj_t*  c,
+                                   obj_t*  c_ref,
+                                   double* resid );
+
+
+
+void libblis_test_gemm_fast_deps( test_params_t* params, test_op_t* op )
+{
+	libblis_test_randv( params, &(op->ops->randv) );
+	libblis_test_randm( params, &(op->ops->randm) );
+	libblis_test_normfv( params, &(op->ops->normfv) );
+	libblis_test_subv( params, &(op->ops->subv) );
+	libblis_test_scalv( params, &(op->ops->scalv) );
+	libblis_test_copym( params, &(op->ops->copym) );
+	libblis_test_scalm( params, &(op->ops->scalm) );
+	libblis_test_gemv( params, &(op->ops->gemv) );
+	libblis_test_gemm( params, &(op->ops->gemm) );
+}
+
+
+
+void libblis_test_gemm_fast( test_params_t* params, test_op_t* op )
+{
+
+	// Return early if this test has already been done.
+	if ( op->test_done == TRUE ) return;
+
+	// Return early if operation is disabled.
+	if ( op->op_switch == DISABLE_ALL ||
+	     op->ops->l3_over == DISABLE_ALL ) return;
+
+	// Call dependencies first.
+	if ( TRUE ) libblis_test_gemm_fast_deps( params, op );
+
+	// Execute the test driver for each implementation requested.
+	if ( op->front_seq == ENABLE )
+	{
+		libblis_test_op_driver( params,
+		                        op,
+		                        BLIS_TEST_SEQ_FRONT_END,
+		                        op_str,
+		                        p_types,
+		                        o_types,
+		                        thresh,
+		                        libblis_test_gemm_fast_experiment );
+	}
+}
+
+
+
+void libblis_test_gemm_fast_experiment( test_params_t* params,
+                                        test_op_t*     op,
+                                        iface_t        iface,
+                                        num_t          datatype,
+                                        char*          pc_str,
+                                        char*          sc_str,
+                                        unsigned int   p_cur,
+                                        double*        perf,
+                                        double*        resid )
+{
+	unsigned int n_repeats = params->n_repeats;
+	unsigned int i;
+	dim_t        si;
+
+	double       time_min  = 1e9;
+	double       time;
+	double       resid_cur;
+
+	dim_t        m, n, k;
+
+	trans_t      transa;
+	trans_t      transb;
+
+	obj_t        kappa;
+	obj_t        alpha, a, b, beta, c;
+	obj_t        c_save, c_ref;
+
+
+	// Map the dimension specifier to actual dimensions.
+	m = libblis_test_get_dim_from_prob_size( op->dim_spec[0], p_cur );
+	n = libblis_test_get_dim_from_prob_size( op->dim_spec[1], p_cur );
+	k = libblis_test_get_dim_from_prob_size( op->dim_spec[2], p_cur );
+
+	// Map parameter characters to BLIS constants.
+	bli_param_map_char_to_blis_trans( pc_str[0], &transa );
+	bli_param_map_char_to_blis_trans( pc_str[1], &transb );
+
+	// Create test scalars.
+	bli_obj_scalar_init_detached( datatype, &kappa );
+	bli_obj_scalar_init_detached( datatype, &alpha );
+	bli_obj_scalar_init_detached( datatype, &beta );
+
+	// Set alpha and beta.
+	if ( bli_is_real( datatype ) )
+	{
+		bli_setsc(  1.2,  0.0, &alpha );
+		bli_setsc( -1.0,  0.0, &beta );
+	}
+	else
+	{
+		bli_setsc(  1.2,  0.8, &alpha );
+		bli_setsc( -1.0,  1.0, &beta );
+	}
+
+	*resid = 0.0;
+
+	// Test each storage scheme in turn. The performance that is reported
+	// is that of the first (column-stored) scheme.
+	for ( si = 0; si < n_sc_strs; ++si )
+	{
+		char* sc_cur = sc_strs[si];
+
+		// Create test operands (vectors and/or matrices).
+		libblis_test_mobj_create( params, datatype, transa,
+		                          sc_cur[0], m, k, &a );
+		libblis_test_mobj_create( params, datatype, transb,
+		                          sc_cur[1], k, n, &b );
+		libblis_test_mobj_create( params, datatype, BLIS_NO_TRANSPOSE,
+		                          sc_cur[2], m, n, &c );
+		libblis_test_mobj_create( params, datatype, BLIS_NO_TRANSPOSE,
+		                          sc_cur[2], m, n, &c_save );
+		libblis_test_mobj_create( params, datatype, BLIS_NO_TRANSPOSE,
+		                          sc_cur[2], m, n, &c_ref );
+
+		// Randomize A, B, and C, and save C.
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+		bli_copym( &c, &c_save );
+
+		// Normalize by k.
+		bli_setsc( 1.0/( double )k, 0.0, &kappa );
+		bli_scalm( &kappa, &a );
+		bli_scalm( &kappa, &b );
+
+		// Compute the reference result with the object-based interface.
+		// The fast interface takes transa and transb as arguments, so the
+		// parameters are removed from A and B again afterwards.
+		bli_copym( &c_save, &c_ref );
+		bli_obj_set_conjtrans( transa, a );
+		bli_obj_set_conjtrans( transb, b );
+		bli_gemm( &alpha, &a, &b, &beta, &c_ref );
+		bli_obj_set_conjtrans( BLIS_NO_TRANSPOSE, a );
+		bli_obj_set_conjtrans( BLIS_NO_TRANSPOSE, b );
+
+		// Repeat the experiment n_repeats times and record results. 
+		for ( i = 0; i < n_repeats; ++i )
+		{
+			bli_copym( &c_save, &c );
+
+			time = bli_clock();
+
+			libblis_test_gemm_fast_impl( iface, transa, transb, m, n, k,
+			                             &alpha, &a, &b, &beta, &c );
+
+			if ( si == 0 ) time_min = bli_clock_min_diff( time_min, time );
+		}
+
+		// Perform checks.
+		libblis_test_gemm_fast_check( &c, &c_ref, &resid_cur );
+
+		*resid = bli_max( *resid, resid_cur );
+
+		// Free the test objects.
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_save );
+		bli_obj_free( &c_ref );
+	}
+
+	// Estimate the performance of the best experiment repeat.
+	*perf = ( 2.0 * m * n * k ) / time_min / FLOPS_PER_UNIT_PERF;
+	if ( bli_is_complex( datatype ) ) *perf *= 4.0;
+
+	// Zero out performance and residual if output matrix is empty.
+	if ( bli_zero_dim2( m, n ) )
+	{
+		*perf  = 0.0;
+		*resid = 0.0;
+	}
+}
+
+
+
+void libblis_test_gemm_fast_impl( iface_t   iface,
+                                  trans_t   transa,
+                                  trans_t   transb,
+                                  dim_t     m,
+                                  dim_t     n,
+                                  dim_t     k,
+                                  obj_t*    alpha,
+                                  obj_t*    a,
+                                  obj_t*    b,
+                                  obj_t*    beta,
+                                  obj_t*    c )
+{
+	num_t dt     = bli_obj_datatype( *c );
+
+	void* buf_a  = bli_obj_buffer_at_off( *a );
+	inc_t rs_a   = bli_obj_row_stride( *a );
+	inc_t cs_a   = bli_obj_col_stride( *a );
+	void* buf_b  = bli_obj_buffer_at_off( *b );
+	inc_t rs_b   = bli_obj_row_stride( *b );
+	inc_t cs_b   = bli_obj_col_stride( *b );
+	void* buf_c  = bli_obj_buffer_at_off( *c );
+	inc_t rs_c   = bli_obj_row_stride( *c );
+	inc_t cs_c   = bli_obj_col_stride( *c );
+
+	void* buf_alpha = bli_obj_buffer_at_off( *alpha );
+	void* buf_beta  = bli_obj_buffer_at_off( *beta );
+
+	switch ( iface )
+	{
+		case BLIS_TEST_SEQ_FRONT_END:
+		if      ( bli_is_float( dt ) )
+			bli_sgemm_fast( transa, transb, m, n, k,
+			                buf_alpha, buf_a, rs_a, cs_a, buf_b, rs_b, cs_b,
+			                buf_beta, buf_c, rs_c, cs_c );
+		else if ( bli_is_double( dt ) )
+			bli_dgemm_fast( transa, transb, m, n, k,
+			                buf_alpha, buf_a, rs_a, cs_a, buf_b, rs_b, cs_b,
+			                buf_beta, buf_c, rs_c, cs_c );
+		else if ( bli_is_scomplex( dt ) )
+			bli_cgemm_fast( transa, transb, m, n, k,
+			                buf_alpha, buf_a, rs_a, cs_a, buf_b, rs_b, cs_b,
+			                buf_beta, buf_c, rs_c, cs_c );
+		else if ( bli_is_dcomplex( dt ) )
+			bli_zgemm_fast( transa, transb, m, n, k,
+			                buf_alpha, buf_a, rs_a, cs_a, buf_b, rs_b, cs_b,
+			                buf_beta, buf_c, rs_c, cs_c );
+		break;
+
+		default:
+		libblis_test_printf_error( "Invalid interface type.\n" );
+	}
+}
+
+
+
+void libblis_test_gemm_fast_check( obj_t*  c,
+                                   obj_t*  c_ref,
+                                   double* resid )
+{
+	num_t  dt      = bli_obj_datatype( *c );
+	num_t  dt_real = bli_obj_datatype_proj_to_real( *c );
+
+	dim_t  m       = bli_obj_length( *c );
+	dim_t  n       = bli_obj_width( *c );
+
+	obj_t  kappa, norm;
+	obj_t  t, v, z;
+
+	double junk;
+
+	//
+	// Pre-conditions:
+	// - c_ref holds the result of bli_gemm() for the same operands,
+	//   parameters, and scalars as were passed to bli_?gemm_fast().
+	//
+	// Under these conditions, we assume that the implementation for
+	//
+	//   C := beta * C_orig + alpha * transa(A) * transb(B)
+	//
+	// is functioning correctly if
+	//
+	//   normf( v - z )
+	//
+	// is negligible, where
+	//
+	//   v = C * t
+	//   z = C_ref * t
+	//
+
+	bli_obj_scalar_init_detached( dt,      &kappa );
+	bli_obj_scalar_init_detached( dt_real, &norm );
+
+	bli_obj_create( dt, n, 1, 0, 0, &t );
+	bli_obj_create( dt, m, 1, 0, 0, &v );
+	bli_obj_create( dt, m, 1, 0, 0, &z );
+
+	bli_randv( &t );
+	bli_setsc( 1.0/( double )n, 0.0, &kappa );
+	bli_scalv( &kappa, &t );
+
+	bli_gemv( &BLIS_ONE, c, &t, &BLIS_ZERO, &v );
+	bli_gemv( &BLIS_ONE, c_ref, &t, &BLIS_ZERO, &z );
+
+	bli_subv( &z, &v );
+	bli_normfv( &v, &norm );
+	bli_getsc( &norm, resid, &junk );
+
+	bli_obj_free( &t );
+	bli_obj_free( &v );
+	bli_obj_free( &z );
+}
+
@@ -0,0 +1,543 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <stddef.h>
+#include "blis.h"
+#include "test_libblis.h"
+
+
+// Static variables.
+static char*     op_str                    = "gemm_pack";
+static char*     o_types                   = "mmm"; // a b c
+static char*     p_types                   = "hh";  // transa transb
+static thresh_t  thresh[BLIS_NUM_FP_TYPES] = { { 1e-04, 1e-05 },   // warn, pass for s
+                                               { 1e-04, 1e-05 },   // warn, pass for c
+                                               { 1e-13, 1e-14 },   // warn, pass for d
+                                               { 1e-13, 1e-14 } }; // warn, pass for z
+
+// The temporary files to which packed operands are written.
+static char*     file_str_a                = "libblis_test_gemm_pack_a.tmp";
+static char*     file_str_b                = "libblis_test_gemm_pack_b.tmp";
+
+// Local prototypes.
+void libblis_test_gemm_pack_deps( test_params_t* params,
+                                  test_op_t*     op );
+
+void libblis_test_gemm_pack_experiment( test_params_t* params,
+                                        test_op_t*     op,
+                                        iface_t        iface,
+                                        num_t          datatype,
+                                        char*          pc_str,
+                                        char*          sc_str,
+                                        unsigned int   p_cur,
+                                        double*        perf,
+                                        double*        resid );
+
+void libblis_test_gemm_pack_impl( iface_t   iface,
+                                  obj_t*    alpha,
+                                  obj_t*    a,
+                                  obj_t*    b,
+                                  obj_t*    beta,
+                                  obj_t*    c );
+
+void libblis_test_gemm_pack_check( obj_t*  c,
+                                   obj_t*  c_ref,
+                                   double* resid );
+
+void libblis_test_gemm_pack_check_schema( obj_t*  ap,
+                                          obj_t*  bp,
+                                          double* resid );
+
+void libblis_test_gemm_pack_check_file( obj_t*  alpha,
+                                        obj_t*  ap,
+                                        obj_t*  bp,
+                                        obj_t*  beta,
+                                        obj_t*  c,
+                                        obj_t*  c_orig,
+                                        obj_t*  c_ref,
+                                        double* resid );
+
+bool_t libblis_test_gemm_pack_header_rejected( packfile_t* h,
+                                               siz_t       file_size );
+
+uint64_t libblis_test_gemm_pack_wrapping_ps( uint64_t data_size,
+                                             uint64_t panels_size );
+
+
+
+void libblis_test_gemm_pack_deps( test_params_t* params, test_op_t* op )
+{
+	libblis_test_randv( params, &(op->ops->randv) );
+	libblis_test_randm( params, &(op->ops->randm) );
+	libblis_test_normfv( params, &(op->ops->normfv) );
+	libblis_test_subv( params, &(op->ops->subv) );
+	libblis_test_scalv( params, &(op->ops->scalv) );
+	libblis_test_copym( params, &(op->ops->copym) );
+	libblis_test_scalm( params, &(op->ops->scalm) );
+	libblis_test_gemv( params, &(op->ops->gemv) );
+	libblis_test_gemm( params, &(op->ops->gemm) );
+}
+
+
+
+void libblis_test_gemm_pack( test_params_t* params, test_op_t* op )
+{
+
+	// Return early if this test has already been done.
+	if ( op->test_done == TRUE ) return;
+
+	// Return early if operation is disabled.
+	if ( op->op_switch == DISABLE_ALL ||
+	     op->ops->l3_over == DISABLE_ALL ) return;
+
+	// Call dependencies first.
+	if ( TRUE ) libblis_test_gemm_pack_deps( params, op );
+
+	// Execute the test driver for each implementation requested.
+	if ( op->front_seq == ENABLE )
+	{
+		libblis_test_op_driver( params,
+		                        op,
+		                        BLIS_TEST_SEQ_FRONT_END,
+		                        op_str,
+		                        p_types,
+		                        o_types,
+		                        thresh,
+		                        libblis_test_gemm_pack_experiment );
+	}
+}
+
+
+
+void libblis_test_gemm_pack_experiment( test_params_t* params,
+                                        test_op_t*     op,
+                                        iface_t        iface,
+                                        num_t          datatype,
+                                        char*          pc_str,
+                                        char*          sc_str,
+                                        unsigned int   p_cur,
+                                        double*        perf,
+                                        double*        resid )
+{
+	unsigned int n_repeats = params->n_repeats;
+	unsigned int i;
+
+	double       time_min  = 1e9;
+	double       time;
+	double       resid_cur;
+
+	dim_t        m, n, k;
+
+	trans_t      transa;
+	trans_t      transb;
+
+	obj_t        kappa;
+	obj_t        alpha, a, b, beta, c;
+	obj_t        ap, bp;
+	obj_t        c_save, c_ref;
+
+
+	// Map the dimension specifier to actual dimensions.
+	m = libblis_test_get_dim_from_prob_size( op->dim_spec[0], p_cur );
+	n = libblis_test_get_dim_from_prob_size( op->dim_spec[1], p_cur );
+	k = libblis_test_get_dim_from_prob_size( op->dim_spec[2], p_cur );
+
+	// Map parameter characters to BLIS constants.
+	bli_param_map_char_to_blis_trans( pc_str[0], &transa );
+	bli_param_map_char_to_blis_trans( pc_str[1], &transb );
+
+	// Create test scalars.
+	bli_obj_scalar_init_detached( datatype, &kappa );
+	bli_obj_scalar_init_detached( datatype, &alpha );
+	bli_obj_scalar_init_detached( datatype, &beta );
+
+	// Create test operands (vectors and/or matrices).
+	libblis_test_mobj_create( params, datatype, transa,
+	                          sc_str[0], m, k, &a );
+	libblis_test_mobj_create( params, datatype, transb,
+	                          sc_str[1], k, n, &b );
+	libblis_test_mobj_create( params, datatype, BLIS_NO_TRANSPOSE,
+	                          sc_str[2], m, n, &c );
+	libblis_test_mobj_create( params, datatype, BLIS_NO_TRANSPOSE,
+	                          sc_str[2], m, n, &c_save );
+	libblis_test_mobj_create( params, datatype, BLIS_NO_TRANSPOSE,
+	                          sc_str[2], m, n, &c_ref );
+
+	// Set alpha and beta.
+	if ( bli_obj_is_real( c ) )
+	{
+		bli_setsc(  1.2,  0.0, &alpha );
+		bli_setsc( -1.0,  0.0, &beta );
+	}
+	else
+	{
+		bli_setsc(  1.2,  0.8, &alpha );
+		bli_setsc( -1.0,  1.0, &beta );
+	}
+
+	// Randomize A, B, and C, and save C.
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+	bli_copym( &c, &c_save );
+
+	// Normalize by k.
+	bli_setsc( 1.0/( double )k, 0.0, &kappa );
+	bli_scalm( &kappa, &a );
+	bli_scalm( &kappa, &b );
+
+	// Apply the parameters.
+	bli_obj_set_conjtrans( transa, a );
+	bli_obj_set_conjtrans( transb, b );
+
+	// Compute the reference result from the unpacked operands.
+	bli_copym( &c_save, &c_ref );
+	bli_gemm( &alpha, &a, &b, &beta, &c_ref );
+
+	// Pack A and B. Packing applies transa and transb.
+	bli_gemm_pack_a( &a, &ap );
+	bli_gemm_pack_b( &b, &bp );
+
+	// Repeat the experiment n_repeats times and record results. Only the
+	// case where both operands are pre-packed is timed.
+	for ( i = 0; i < n_repeats; ++i )
+	{
+		bli_copym( &c_save, &c );
+
+		time = bli_clock();
+
+		libblis_test_gemm_pack_impl( iface, &alpha, &ap, &bp, &beta, &c );
+
+		time_min = bli_clock_min_diff( time_min, time );
+	}
+
+	// Estimate the performance of the best experiment repeat.
+	*perf = ( 2.0 * m * n * k ) / time_min / FLOPS_PER_UNIT_PERF;
+	if ( bli_obj_is_complex( c ) ) *perf *= 4.0;
+
+	// Perform checks, first with both operands pre-packed, then with only
+	// one of them pre-packed, and finally with both written to and mapped
+	// from files.
+	libblis_test_gemm_pack_check( &c, &c_ref, resid );
+
+	bli_copym( &c_save, &c );
+	libblis_test_gemm_pack_impl( iface, &alpha, &ap, &b, &beta, &c );
+	libblis_test_gemm_pack_check( &c, &c_ref, &resid_cur );
+	*resid = bli_max( *resid, resid_cur );
+
+	bli_copym( &c_save, &c );
+	libblis_test_gemm_pack_impl( iface, &alpha, &a, &bp, &beta, &c );
+	libblis_test_gemm_pack_check( &c, &c_ref, &resid_cur );
+	*resid = bli_max( *resid, resid_cur );
+
+	libblis_test_gemm_pack_check_schema( &ap, &bp, &resid_cur );
+	*resid = bli_max( *resid, resid_cur );
+
+	libblis_test_gemm_pack_check_file( &alpha, &ap, &bp, &beta,
+	                                   &c, &c_save, &c_ref, &resid_cur );
+	*resid = bli_max( *resid, resid_cur );
+
+	// Zero out performance and residual if output matrix is empty.
+	libblis_test_check_empty_problem( &c, perf, resid );
+
+	// Free the test objects.
+	bli_gemm_pack_free( &ap );
+	bli_gemm_pack_free( &bp );
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_save );
+	bli_obj_free( &c_ref );
+}
+
+
+
+void libblis_test_gemm_pack_impl( iface_t   iface,
+                                  obj_t*    alpha,
+                                  obj_t*    a,
+                                  obj_t*    b,
+                                  obj_t*    beta,
+                                  obj_t*    c )
+{
+	switch ( iface )
+	{
+		case BLIS_TEST_SEQ_FRONT_END:
+		bli_gemm( alpha, a, b, beta, c );
+		break;
+
+		default:
+		libblis_test_printf_error( "Invalid interface type.\n" );
+	}
+}
+
+
+
+void libblis_test_gemm_pack_check( obj_t*  c,
+                                   obj_t*  c_ref,
+                                   double* resid )
+{
+	num_t  dt      = bli_obj_datatype( *c );
+	num_t  dt_real = bli_obj_datatype_proj_to_real( *c );
+
+	dim_t  m       = bli_obj_length( *c );
+	dim_t  n       = bli_obj_width( *c );
+
+	obj_t  kappa, norm;
+	obj_t  t, v, z;
+
+	double junk;
+
+	//
+	// Pre-conditions:
+	// - c_ref holds the result of bli_gemm() on the unpacked operands,
+	//   with the same parameters and scalars.
+	//
+	// Under these conditions, we assume that the implementation for
+	//
+	//   C := beta * C_orig + alpha * transa(A) * transb(B)
+	//
+	// with A and/or B pre-packed is functioning correctly if
+	//
+	//   normf( v - z )
+	//
+	// is negligible, where
+	//
+	//   v = C * t
+	//   z = C_ref * t
+	//
+
+	bli_obj_scalar_init_detached( dt,      &kappa );
+	bli_obj_scalar_init_detached( dt_real, &norm );
+
+	bli_obj_create( dt, n, 1, 0, 0, &t );
+	bli_obj_create( dt, m, 1, 0, 0, &v );
+	bli_obj_create( dt, m, 1, 0, 0, &z );
+
+	bli_randv( &t );
+	bli_setsc( 1.0/( double )n, 0.0, &kappa );
+	bli_scalv( &kappa, &t );
+
+	bli_gemv( &BLIS_ONE, c, &t, &BLIS_ZERO, &v );
+	bli_gemv( &BLIS_ONE, c_ref, &t, &BLIS_ZERO, &z );
+
+	bli_subv( &z, &v );
+	bli_normfv( &v, &norm );
+	bli_getsc( &norm, resid, &junk );
+
+	bli_obj_free( &t );
+	bli_obj_free( &v );
+	bli_obj_free( &z );
+}
+
+
+
+void libblis_test_gemm_pack_check_schema( obj_t*  ap,
+                                          obj_t*  bp,
+                                          double* resid )
+{
+	obj_t  apt, bpt;
+
+	//
+	// Packing applies any transposition, so a packed operand may only be
+	// passed to gemm untransposed, and in the position it was packed for.
+	// We check that bli_gemm_check() would reject transposed aliases of
+	// ap and bp, and ap and bp in each other's positions. Since this is
+	// a pass/fail check, any operand that is wrongly accepted produces a
+	// residual of one.
+	//
+
+	*resid = 0.0;
+
+	bli_obj_alias_to( *ap, apt );
+	bli_obj_alias_to( *bp, bpt );
+	bli_obj_toggle_trans( apt );
+	bli_obj_toggle_trans( bpt );
+
+	if ( bli_check_pack_schema_if_packed( BLIS_PACKED_ROW_PANELS, ap  ) != BLIS_SUCCESS ||
+	     bli_check_pack_schema_if_packed( BLIS_PACKED_COL_PANELS, bp  ) != BLIS_SUCCESS )
+		*resid = 1.0;
+
+	if ( bli_check_pack_schema_if_packed( BLIS_PACKED_ROW_PANELS, &apt ) == BLIS_SUCCESS ||
+	     bli_check_pack_schema_if_packed( BLIS_PACKED_COL_PANELS, &bpt ) == BLIS_SUCCESS ||
+	     bli_check_pack_schema_if_packed( BLIS_PACKED_ROW_PANELS, bp   ) == BLIS_SUCCESS ||
+	     bli_check_pack_schema_if_packed( BLIS_PACKED_COL_PANELS, ap   ) == BLIS_SUCCESS )
+		*resid = 1.0;
+}
+
+
+
+void libblis_test_gemm_pack_check_file( obj_t*  alpha,
+                                        obj_t*  ap,
+                                        obj_t*  bp,
+                                        obj_t*  beta,
+                                        obj_t*  c,
+                                        obj_t*  c_orig,
+                                        obj_t*  c_ref,
+                                        double* resid )
+{
+	obj_t      am, bm;
+	packfile_t header, h;
+	siz_t      file_size;
+	FILE*      file;
+	int        byte;
+	bool_t     failed = FALSE;
+
+	//
+	// We write ap and bp to files, map them back, and check that gemm on
+	// the mapped operands computes the same result as on the unpacked
+	// operands (the residual). We then check that
+	// - bli_gemm_pack_verify() accepts the intact data of the file for
+	//   ap, and rejects it once a byte of that data has been flipped, and
+	// - bli_gemm_pack_header_check() accepts the header of that file, and
+	//   rejects it with a bad file size, magic, version, panel dimension
+	//   (register blocksize), or data size, even when the header checksum
+	//   is recomputed.
+	// Since these are pass/fail checks, any failure produces a residual
+	// of one.
+	//
+
+	bli_gemm_pack_write( ap, file_str_a );
+	bli_gemm_pack_write( bp, file_str_b );
+
+	bli_gemm_pack_map( file_str_a, &am );
+	bli_gemm_pack_map( file_str_b, &bm );
+
+	bli_copym( c_orig, c );
+	bli_gemm( alpha, &am, &bm, beta, c );
+	libblis_test_gemm_pack_check( c, c_ref, resid );
+
+	if ( !bli_gemm_pack_verify( &am ) ) failed = TRUE;
+
+	bli_gemm_pack_unmap( &am );
+	bli_gemm_pack_unmap( &bm );
+	remove( file_str_b );
+
+	// Read the header of the file for ap, and flip a byte in the middle
+	// of its packed data.
+	file = fopen( file_str_a, "r+b" );
+	libblis_test_fopen_check_stream( file_str_a, file );
+
+	if ( fread( &header, sizeof( header ), 1, file ) != 1 )
+		libblis_test_printf_error( "Failed to read %s.\n", file_str_a );
+
+	fseek( file, 0, SEEK_END );
+	file_size = ftell( file );
+
+	fseek( file, header.data_offset + header.data_size / 2, SEEK_SET );
+	byte = fgetc( file );
+	fseek( file, header.data_offset + header.data_size / 2, SEEK_SET );
+	fputc( byte ^ 0x01, file );
+	fclose( file );
+
+	bli_gemm_pack_map( file_str_a, &am );
+
+	if ( bli_gemm_pack_verify( &am ) ) failed = TRUE;
+
+	bli_gemm_pack_unmap( &am );
+	remove( file_str_a );
+
+	// Check the header, intact and with each of the defects above.
+	if ( bli_gemm_pack_header_check( &header, file_size ) != BLIS_SUCCESS )
+		failed = TRUE;
+
+	if ( bli_gemm_pack_header_check( &header, file_size - 1 ) == BLIS_SUCCESS ||
+	     bli_gemm_pack_header_check( &header, file_size + 1 ) == BLIS_SUCCESS )
+		failed = TRUE;
+
+	h = header; h.magic[0] ^= 0x01;
+	if ( !libblis_test_gemm_pack_header_rejected( &h, file_size ) ) failed = TRUE;
+
+	h = header; h.version += 1;
+	if ( !libblis_test_gemm_pack_header_rejected( &h, file_size ) ) failed = TRUE;
+
+	h = header; h.pd *= 2; h.mr *= 2; h.nr *= 2;
+	if ( !libblis_test_gemm_pack_header_rejected( &h, file_size ) ) failed = TRUE;
+
+	h = header; h.file_size += BLIS_PACK_FILE_HEADER_SIZE;
+	if ( !libblis_test_gemm_pack_header_rejected( &h, file_size ) ) failed = TRUE;
+
+	// A data size that wraps the end of the data around to the start of
+	// the file, with a panel stride for which the size of the panels
+	// wraps to that same data size.
+	h = header; h.data_size = ( uint64_t )0 - h.data_offset;
+	h.ps = libblis_test_gemm_pack_wrapping_ps( h.data_size,
+	                                           h.m_padded / h.pd * h.elem_size );
+	if ( !libblis_test_gemm_pack_header_rejected( &h, file_size ) ) failed = TRUE;
+
+	if ( failed ) *resid = 1.0;
+}
+
+
+
+bool_t libblis_test_gemm_pack_header_rejected( packfile_t* h,
+                                               siz_t       file_size )
+{
+	// The header must be rejected both as modified and after its
+	// checksum has been recomputed to match the modification.
+	if ( bli_gemm_pack_header_check( h, file_size ) == BLIS_SUCCESS )
+		return FALSE;
+
+	h->header_checksum = bli_gemm_pack_checksum( h, offsetof( packfile_t, header_checksum ) );
+
+	return bli_gemm_pack_header_check( h, file_size ) != BLIS_SUCCESS;
+}
+
+
+
+uint64_t libblis_test_gemm_pack_wrapping_ps( uint64_t data_size,
+                                             uint64_t panels_size )
+{
+	uint64_t odd = panels_size;
+	uint64_t inv;
+	int      i;
+
+	// Return a panel stride ps for which ps * panels_size is congruent to
+	// data_size modulo 2^64. Write panels_size as 2^t * odd; such a ps
+	// exists when 2^t divides data_size, and is ( data_size / 2^t ) times
+	// the inverse of odd modulo 2^64 (computed by Newton iteration).
+	if ( panels_size == 0 ) return 0;
+
+	while ( odd % 2 == 0 )
+	{
+		odd       /= 2;
+		data_size /= 2;
+	}
+
+	for ( inv = odd, i = 0; i < 6; ++i )
+		inv *= 2 - odd * inv;
+
+	return data_size * inv;
+}
+
@@ -178,6 +178,13 @@ void libblis_test_level3_ukrs( test_params_t* params, test_ops_t* ops )
 void libblis_test_level3_ops( test_params_t* params, test_ops_t* ops )
 {
 	libblis_test_gemm( params, &(ops->gemm) );
+	libblis_test_gemm( params, &(ops->gemm_small) );
+	libblis_test_gemm( params, &(ops->gemm_skinny) );
+	libblis_test_gemm_fast( params, &(ops->gemm_fast) );
+	libblis_test_gemm_fast( params, &(ops->gemm_fast_small) );
+	libblis_test_gemm_fast( params, &(ops->gemm_fast_skinny) );
+	libblis_test_gemm_fast( params, &(ops->gemm_fast_wide) );
+	libblis_test_gemm_pack( params, &(ops->gemm_pack) );
 	libblis_test_hemm( params, &(ops->hemm) );
 	libblis_test_herk( params, &(ops->herk) );
 	libblis_test_her2k( params, &(ops->her2k) );
@@ -265,6 +272,13 @@ void libblis_test_read_ops_file( char* input_filename, test_ops_t* ops )
 
 	// Level-3
 	libblis_test_read_op_info( ops, input_stream, BLIS_TEST_DIMS_MNK, 2, &(ops->gemm) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_TEST_DIMS_MNK, 2, &(ops->gemm_small) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_TEST_DIMS_MNK, 2, &(ops->gemm_skinny) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_TEST_DIMS_MNK, 2, &(ops->gemm_fast) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_TEST_DIMS_MNK, 2, &(ops->gemm_fast_small) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_TEST_DIMS_MNK, 2, &(ops->gemm_fast_skinny) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_TEST_DIMS_MNK, 2, &(ops->gemm_fast_wide) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_TEST_DIMS_MNK, 2, &(ops->gemm_pack) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_TEST_DIMS_MN,  4, &(ops->hemm) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_TEST_DIMS_MK,  2, &(ops->herk) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_TEST_DIMS_MK,  3, &(ops->her2k) );
@@ -564,15 +578,16 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	libblis_test_fprintf_c( os, "  stride alignment           %u\n", BLIS_HEAP_STRIDE_ALIGN_SIZE );
 	libblis_test_fprintf_c( os, "\n" );
 	libblis_test_fprintf_c( os, "contiguous memory allocation   \n" );
-	libblis_test_fprintf_c( os, "  # of mc x kc blocks        %u\n", BLIS_NUM_MC_X_KC_BLOCKS );
-	libblis_test_fprintf_c( os, "  # of kc x nc blocks        %u\n", BLIS_NUM_KC_X_NC_BLOCKS );
-	libblis_test_fprintf_c( os, "  # of mc x nc blocks        %u\n", BLIS_NUM_MC_X_NC_BLOCKS );
+	libblis_test_fprintf_c( os, "  initial # of mc x kc blocks %u\n", BLIS_NUM_MC_X_KC_BLOCKS );
+	libblis_test_fprintf_c( os, "  initial # of kc x nc blocks %u\n", BLIS_NUM_KC_X_NC_BLOCKS );
+	libblis_test_fprintf_c( os, "  initial # of mc x nc blocks %u\n", BLIS_NUM_MC_X_NC_BLOCKS );
+	libblis_test_fprintf_c( os, "  max # of blocks per pool   %u\n", BLIS_POOL_MAX_NUM_BLOCKS );
 	libblis_test_fprintf_c( os, "  block address alignment    %u\n", BLIS_CONTIG_ADDR_ALIGN_SIZE );
 	libblis_test_fprintf_c( os, "  max preload byte offset    %u\n", BLIS_MAX_PRELOAD_BYTE_OFFSET );
-	libblis_test_fprintf_c( os, "  actual pool sizes (bytes)    \n" );
-	libblis_test_fprintf_c( os, "    for mc x kc blocks of A  %u\n", BLIS_MK_POOL_SIZE );
-	libblis_test_fprintf_c( os, "    for kc x nc panels of B  %u\n", BLIS_KN_POOL_SIZE );
-	libblis_test_fprintf_c( os, "    for mc x nc panels of C  %u\n", BLIS_MN_POOL_SIZE );
+	libblis_test_fprintf_c( os, "  default block sizes (bytes)  \n" );
+	libblis_test_fprintf_c( os, "    for mc x kc blocks of A  %u\n", BLIS_MK_BLOCK_SIZE );
+	libblis_test_fprintf_c( os, "    for kc x nc panels of B  %u\n", BLIS_KN_BLOCK_SIZE );
+	libblis_test_fprintf_c( os, "    for mc x nc panels of C  %u\n", BLIS_MN_BLOCK_SIZE );
 	libblis_test_fprintf_c( os, "\n" );
 	libblis_test_fprintf_c( os, "--- BLIS kernel header ---\n" );
 	libblis_test_fprintf_c( os, "\n" );
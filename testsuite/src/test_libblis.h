@@ -248,6 +248,13 @@ typedef struct test_ops_s
 
 	// level-3
 	test_op_t gemm;
+	test_op_t gemm_small;
+	test_op_t gemm_skinny;
+	test_op_t gemm_fast;
+	test_op_t gemm_fast_small;
+	test_op_t gemm_fast_skinny;
+	test_op_t gemm_fast_wide;
+	test_op_t gemm_pack;
 	test_op_t hemm;
 	test_op_t herk;
 	test_op_t her2k;
@@ -456,6 +463,8 @@ void libblis_test_check_empty_problem( obj_t* c, double* perf, double* resid );
 
 // Level-3
 #include "test_gemm.h"
+#include "test_gemm_fast.h"
+#include "test_gemm_pack.h"
 #include "test_hemm.h"
 #include "test_herk.h"
 #include "test_her2k.h"